@@ -38,7 +38,7 @@
 // FIXES for broken compilers
 #include <boost/config.hpp>
 
-#include "malloc_aligned.hpp"
+#include "../malloc_aligned.hpp"
 
 namespace nova {
 
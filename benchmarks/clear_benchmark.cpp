@@ -1,3 +1,6 @@
+/* always use non-temporal stores in the _stream functions, to show the crossover */
+#define NOVA_SIMD_STREAM_THRESHOLD 0
+
 #include "benchmark_helpers.hpp"
 #include "../simd_memory.hpp"
 
@@ -179,6 +182,32 @@ void __noinline__ bench_18(float * out, unsigned int numSamples)
         zerovec(out, remain);
 }
 
+void __noinline__ bench_zero(float * out, unsigned int numSamples)
+{
+    zerovec_simd(out, numSamples);
+}
+
+void __noinline__ bench_zero_stream(float * out, unsigned int numSamples)
+{
+    zerovec_simd_stream(out, numSamples);
+}
+
+/* 64MB, larger than the last-level cache */
+const unsigned int max_size = 1 << 24;
+nova::aligned_array<float, max_size> large_buffer;
+
+void run_size_sweep(void)
+{
+    large_buffer.assign(1.f);
+
+    /* regular vs. non-temporal stores, from 4kB to 64MB, clearing 4GB per size */
+    for (unsigned int size = 1024; size <= max_size; size *= 4) {
+        const unsigned int iterations = (1u << 30) / size;
+        std::cout << size * sizeof(float) / 1024 << "kB" << std::endl;
+        run_bench(boost::bind(bench_zero, large_buffer.begin(), size), iterations);
+        run_bench(boost::bind(bench_zero_stream, large_buffer.begin(), size), iterations);
+    }
+}
 
 int main(void)
 {
@@ -204,4 +233,7 @@ int main(void)
     run_bench(boost::bind(bench_16, buffer.begin(), 64), iterations);
     run_bench(boost::bind(bench_17, buffer.begin(), 64), iterations);
     run_bench(boost::bind(bench_18, buffer.begin(), 64), iterations);
+
+    std::cout << "zerovec_simd vs. zerovec_simd_stream" << std::endl;
+    run_size_sweep();
 }
@@ -1,3 +1,6 @@
+/* always use non-temporal stores in the _stream functions, to show the crossover */
+#define NOVA_SIMD_STREAM_THRESHOLD 0
+
 #include "benchmark_helpers.hpp"
 #include "../simd_memory.hpp"
 
@@ -186,6 +189,34 @@ void __noinline__ bench_8(float * out, float * in, unsigned int numSamples)
 }
 #endif
 
+void __noinline__ bench_copy(float * out, float * in, unsigned int numSamples)
+{
+    copyvec_simd(out, in, numSamples);
+}
+
+void __noinline__ bench_copy_stream(float * out, float * in, unsigned int numSamples)
+{
+    copyvec_simd_stream(out, in, numSamples);
+}
+
+/* 64MB per buffer, larger than the last-level cache */
+const unsigned int max_size = 1 << 24;
+aligned_array<float, max_size> large_in, large_out;
+
+void run_size_sweep(void)
+{
+    fill_container(large_in);
+    large_out.assign(0.f);
+
+    /* regular vs. non-temporal stores, from 4kB to 64MB, copying 4GB per size */
+    for (unsigned int size = 1024; size <= max_size; size *= 4) {
+        const unsigned int iterations = (1u << 30) / size;
+        std::cout << size * sizeof(float) / 1024 << "kB" << std::endl;
+        run_bench(boost::bind(bench_copy, large_out.begin(), large_in.begin(), size), iterations);
+        run_bench(boost::bind(bench_copy_stream, large_out.begin(), large_in.begin(), size), iterations);
+    }
+}
+
 int main(void)
 {
     using namespace std;
@@ -222,4 +253,7 @@ int main(void)
     run_bench(boost::bind(bench_8, out.begin(), in.begin()+2, 64), iterations);
     cout << endl;
 #endif
+
+    cout << "copyvec_simd vs. copyvec_simd_stream" << endl;
+    run_size_sweep();
 }
@@ -0,0 +1,70 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, in, in2;
+
+#define DEFINE_TIER_BENCHMARKS(NAME)                        \
+void __noinline__ bench_##NAME##_fast(unsigned int n)       \
+{                                                           \
+    fast_##NAME##_vec_simd(out.begin(), in.begin(), n);     \
+}                                                           \
+                                                            \
+void __noinline__ bench_##NAME(unsigned int n)              \
+{                                                           \
+    NAME##_vec_simd(out.begin(), in.begin(), n);            \
+}                                                           \
+                                                            \
+void __noinline__ bench_##NAME##_precise(unsigned int n)    \
+{                                                           \
+    precise_##NAME##_vec_simd(out.begin(), in.begin(), n);  \
+}
+
+DEFINE_TIER_BENCHMARKS(exp)
+DEFINE_TIER_BENCHMARKS(log)
+DEFINE_TIER_BENCHMARKS(sin)
+DEFINE_TIER_BENCHMARKS(cos)
+DEFINE_TIER_BENCHMARKS(tanh)
+
+void __noinline__ bench_pow_fast(unsigned int n)
+{
+    fast_pow_vec_simd(out.begin(), in.begin(), in2.begin(), n);
+}
+
+void __noinline__ bench_pow(unsigned int n)
+{
+    pow_vec_simd(out.begin(), in.begin(), in2.begin(), n);
+}
+
+void __noinline__ bench_pow_precise(unsigned int n)
+{
+    precise_pow_vec_simd(out.begin(), in.begin(), in2.begin(), n);
+}
+
+#define RUN_TIER_BENCHMARKS(NAME)                                   \
+    cout << #NAME ": fast, standard, precise" << endl;              \
+    run_bench(boost::bind(bench_##NAME##_fast, 64), iterations);    \
+    run_bench(boost::bind(bench_##NAME, 64), iterations);           \
+    run_bench(boost::bind(bench_##NAME##_precise, 64), iterations);
+
+int main(void)
+{
+    out.assign(0);
+
+    in.assign(0.2f);
+    in2.assign(2.3f);
+
+    const unsigned int iterations = 5000000;
+
+    RUN_TIER_BENCHMARKS(exp)
+    RUN_TIER_BENCHMARKS(log)
+    RUN_TIER_BENCHMARKS(sin)
+    RUN_TIER_BENCHMARKS(cos)
+    RUN_TIER_BENCHMARKS(tanh)
+    RUN_TIER_BENCHMARKS(pow)
+}
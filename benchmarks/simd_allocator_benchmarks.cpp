@@ -0,0 +1,60 @@
+#include "benchmark_helpers.hpp"
+#include "../simd_allocator.hpp"
+
+#include <vector>
+
+using namespace nova;
+using namespace std;
+
+/* the wire buffers of one block of a signal graph */
+static const unsigned int buffer_count = 32;
+void * buffers[buffer_count];
+
+void __noinline__ bench_malloc(size_t bytes)
+{
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        buffers[i] = malloc(bytes);
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        free(buffers[i]);
+}
+
+void __noinline__ bench_malloc_aligned(size_t bytes)
+{
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        buffers[i] = malloc_aligned(bytes);
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        free_aligned(buffers[i]);
+}
+
+void __noinline__ bench_pool(size_t bytes)
+{
+    aligned_pool & pool = aligned_pool::this_thread();
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        buffers[i] = pool.allocate(bytes);
+    for (unsigned int i = 0; i != buffer_count; ++i)
+        pool.deallocate(buffers[i], bytes);
+}
+
+template <typename Allocator>
+void __noinline__ bench_vector(size_t samples)
+{
+    vector<float, Allocator> buffer(samples);
+}
+
+int main(void)
+{
+    const unsigned int iterations = 1000000;
+    const size_t sizes[] = {64, 512, 4096};
+
+    for (int i = 0; i != 3; ++i) {
+        const size_t samples = sizes[i];
+        cout << samples << " samples, " << buffer_count << " buffers: malloc, malloc_aligned, aligned_pool" << endl;
+        run_bench(boost::bind(bench_malloc, samples * sizeof(float)), iterations);
+        run_bench(boost::bind(bench_malloc_aligned, samples * sizeof(float)), iterations);
+        run_bench(boost::bind(bench_pool, samples * sizeof(float)), iterations);
+
+        cout << samples << " samples, std::vector: aligned_allocator, pool_allocator" << endl;
+        run_bench(boost::bind(bench_vector<aligned_allocator<float> >, samples), iterations);
+        run_bench(boost::bind(bench_vector<pool_allocator<float> >, samples), iterations);
+    }
+}
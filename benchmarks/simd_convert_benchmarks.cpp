@@ -0,0 +1,120 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_convert.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> samples;
+int16_t pcm16[64];
+uint8_t pcm24[3 * 64];
+int32_t pcm32[64];
+tpdf_dither<float> dither;
+
+void __noinline__ bench_float_to_int16(unsigned int n)
+{
+    float_to_int16_vec(pcm16, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_int16_simd(unsigned int n)
+{
+    float_to_int16_vec_simd(pcm16, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_int16_dither(unsigned int n)
+{
+    float_to_int16_vec(pcm16, samples.begin(), n, dither);
+}
+
+void __noinline__ bench_float_to_int16_dither_simd(unsigned int n)
+{
+    float_to_int16_vec_simd(pcm16, samples.begin(), n, dither);
+}
+
+void __noinline__ bench_float_to_int24(unsigned int n)
+{
+    float_to_int24_vec(pcm24, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_int24_simd(unsigned int n)
+{
+    float_to_int24_vec_simd(pcm24, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_int32(unsigned int n)
+{
+    float_to_int32_vec(pcm32, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_int32_simd(unsigned int n)
+{
+    float_to_int32_vec_simd(pcm32, samples.begin(), n);
+}
+
+void __noinline__ bench_int16_to_float(unsigned int n)
+{
+    int16_to_float_vec(samples.begin(), pcm16, n);
+}
+
+void __noinline__ bench_int16_to_float_simd(unsigned int n)
+{
+    int16_to_float_vec_simd(samples.begin(), pcm16, n);
+}
+
+void __noinline__ bench_int24_to_float(unsigned int n)
+{
+    int24_to_float_vec(samples.begin(), pcm24, n);
+}
+
+void __noinline__ bench_int24_to_float_simd(unsigned int n)
+{
+    int24_to_float_vec_simd(samples.begin(), pcm24, n);
+}
+
+void __noinline__ bench_int32_to_float(unsigned int n)
+{
+    int32_to_float_vec(samples.begin(), pcm32, n);
+}
+
+void __noinline__ bench_int32_to_float_simd(unsigned int n)
+{
+    int32_to_float_vec_simd(samples.begin(), pcm32, n);
+}
+
+int main(void)
+{
+    for (int i = 0; i != 64; ++i)
+        samples[i] = std::sin(i * 0.1f);
+
+    const unsigned int iterations = 5000000;
+
+    cout << "float to int16: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_int16, 64), iterations);
+    run_bench(boost::bind(bench_float_to_int16_simd, 64), iterations);
+
+    cout << "float to int16 with tpdf dither: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_int16_dither, 64), iterations);
+    run_bench(boost::bind(bench_float_to_int16_dither_simd, 64), iterations);
+
+    cout << "float to int24: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_int24, 64), iterations);
+    run_bench(boost::bind(bench_float_to_int24_simd, 64), iterations);
+
+    cout << "float to int32: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_int32, 64), iterations);
+    run_bench(boost::bind(bench_float_to_int32_simd, 64), iterations);
+
+    cout << "int16 to float: scalar, simd" << endl;
+    run_bench(boost::bind(bench_int16_to_float, 64), iterations);
+    run_bench(boost::bind(bench_int16_to_float_simd, 64), iterations);
+
+    cout << "int24 to float: scalar, simd" << endl;
+    run_bench(boost::bind(bench_int24_to_float, 64), iterations);
+    run_bench(boost::bind(bench_int24_to_float_simd, 64), iterations);
+
+    cout << "int32 to float: scalar, simd" << endl;
+    run_bench(boost::bind(bench_int32_to_float, 64), iterations);
+    run_bench(boost::bind(bench_int32_to_float_simd, 64), iterations);
+}
@@ -0,0 +1,52 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+
+using namespace nova;
+using namespace std;
+
+/* 64 channels of 64 samples */
+const unsigned int size = 64 * 64;
+
+aligned_array<float, size> out, tmp, in1, in2, in3;
+
+/* out = tanh(in1 * in2 + in3) * gain_ramp */
+void __noinline__ bench_separate(unsigned int n)
+{
+    muladd_vec_simd(tmp.begin(), in1.begin(), in2.begin(), in3.begin(), n);
+    tanh_vec_simd(tmp.begin(), tmp.begin(), n);
+    times_vec_simd(out.begin(), tmp.begin(), slope_argument(0.5f, 0.0001f), n);
+}
+
+void __noinline__ bench_fused(unsigned int n)
+{
+    fused_vec_simd(out.begin(), times_expr(tanh_expr(muladd_expr(in1.begin(), in2.begin(), in3.begin())),
+                                           slope_argument(0.5f, 0.0001f)), n);
+}
+
+void __noinline__ bench_fused_unrolled(void)
+{
+    fused_vec_simd<64>(out.begin(), times_expr(tanh_expr(muladd_expr(in1.begin(), in2.begin(), in3.begin())),
+                                               slope_argument(0.5f, 0.0001f)));
+}
+
+int main(void)
+{
+    out.assign(0.f);
+    fill_container(in1);
+    in2.assign(0.5f);
+    in3.assign(0.1f);
+
+    const unsigned int iterations = 100000;
+
+    cout << "separate passes:" << endl;
+    run_bench(boost::bind(bench_separate, size), iterations);
+
+    cout << "fused:" << endl;
+    run_bench(boost::bind(bench_fused, size), iterations);
+
+    cout << "fused, 64 samples, compile-time unrolled:" << endl;
+    run_bench(boost::bind(bench_fused_unrolled), iterations * 64);
+}
@@ -0,0 +1,93 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_half.hpp"
+#include "../simd_binary_arithmetic.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> samples, out;
+uint16_t half[64];
+
+/* a sample cache of 16MB in single precision. the half precision caches only pay off, when the kernel
+ * is limited by the memory bandwidth */
+const unsigned int cache_size = 1 << 22;
+aligned_array<float, cache_size> cache_out, float_cache;
+aligned_array<uint16_t, cache_size> fp16_cache, bf16_cache;
+
+void __noinline__ bench_float_to_fp16(unsigned int n)
+{
+    float_to_fp16_vec(half, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_fp16_simd(unsigned int n)
+{
+    float_to_fp16_vec_simd(half, samples.begin(), n);
+}
+
+void __noinline__ bench_fp16_to_float(unsigned int n)
+{
+    fp16_to_float_vec(out.begin(), half, n);
+}
+
+void __noinline__ bench_fp16_to_float_simd(unsigned int n)
+{
+    fp16_to_float_vec_simd(out.begin(), half, n);
+}
+
+void __noinline__ bench_float_to_bf16(unsigned int n)
+{
+    float_to_bf16_vec(half, samples.begin(), n);
+}
+
+void __noinline__ bench_float_to_bf16_simd(unsigned int n)
+{
+    float_to_bf16_vec_simd(half, samples.begin(), n);
+}
+
+void __noinline__ bench_plus_float_cache(unsigned int n)
+{
+    plus_vec_simd(cache_out.begin(), float_cache.begin(), cache_out.begin(), n);
+}
+
+void __noinline__ bench_plus_fp16_cache(unsigned int n)
+{
+    plus_vec_simd(cache_out.begin(), fp16_argument(fp16_cache.begin()), cache_out.begin(), n);
+}
+
+void __noinline__ bench_plus_bf16_cache(unsigned int n)
+{
+    plus_vec_simd(cache_out.begin(), bf16_argument(bf16_cache.begin()), cache_out.begin(), n);
+}
+
+int main(void)
+{
+    for (int i = 0; i != 64; ++i)
+        samples[i] = std::sin(i * 0.1f);
+
+    for (unsigned int i = 0; i != cache_size; ++i)
+        float_cache[i] = std::sin(i * 0.1f);
+    float_to_fp16_vec(fp16_cache.begin(), float_cache.begin(), cache_size);
+    float_to_bf16_vec(bf16_cache.begin(), float_cache.begin(), cache_size);
+
+    const unsigned int iterations = 5000000;
+
+    cout << "float to fp16: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_fp16, 64), iterations);
+    run_bench(boost::bind(bench_float_to_fp16_simd, 64), iterations);
+
+    cout << "fp16 to float: scalar, simd" << endl;
+    run_bench(boost::bind(bench_fp16_to_float, 64), iterations);
+    run_bench(boost::bind(bench_fp16_to_float_simd, 64), iterations);
+
+    cout << "float to bf16: scalar, simd" << endl;
+    run_bench(boost::bind(bench_float_to_bf16, 64), iterations);
+    run_bench(boost::bind(bench_float_to_bf16_simd, 64), iterations);
+
+    cout << "adding a large sample cache: float, fp16, bf16" << endl;
+    run_bench(boost::bind(bench_plus_float_cache, cache_size), 100);
+    run_bench(boost::bind(bench_plus_fp16_cache, cache_size), 100);
+    run_bench(boost::bind(bench_plus_bf16_cache, cache_size), 100);
+}
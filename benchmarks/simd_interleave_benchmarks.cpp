@@ -0,0 +1,49 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_interleave.hpp"
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 12 * 64> interleaved, planar;
+float * channels[12];
+
+void __noinline__ bench_interleave(unsigned int channel_count, unsigned int n)
+{
+    interleave_vec(interleaved.begin(), channels, channel_count, n);
+}
+
+void __noinline__ bench_interleave_simd(unsigned int channel_count, unsigned int n)
+{
+    interleave_simd(interleaved.begin(), channels, channel_count, n);
+}
+
+void __noinline__ bench_deinterleave(unsigned int channel_count, unsigned int n)
+{
+    deinterleave_vec(channels, interleaved.begin(), channel_count, n);
+}
+
+void __noinline__ bench_deinterleave_simd(unsigned int channel_count, unsigned int n)
+{
+    deinterleave_simd(channels, interleaved.begin(), channel_count, n);
+}
+
+int main(void)
+{
+    interleaved.assign(0.f);
+    planar.assign(0.f);
+    for (int i = 0; i != 12; ++i)
+        channels[i] = planar.begin() + i * 64;
+
+    const unsigned int iterations = 5000000;
+
+    for (unsigned int channel_count = 2; channel_count <= 12; channel_count += 2) {
+        cout << channel_count << " channels, interleave: scalar, simd" << endl;
+        run_bench(boost::bind(bench_interleave, channel_count, 64), iterations);
+        run_bench(boost::bind(bench_interleave_simd, channel_count, 64), iterations);
+
+        cout << channel_count << " channels, deinterleave: scalar, simd" << endl;
+        run_bench(boost::bind(bench_deinterleave, channel_count, 64), iterations);
+        run_bench(boost::bind(bench_deinterleave_simd, channel_count, 64), iterations);
+    }
+}
@@ -0,0 +1,45 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, in;
+
+void __noinline__ bench_1(unsigned int n)
+{
+    log_vec(out.begin(), in.begin(), n);
+}
+
+void __noinline__ bench_1_simd(unsigned int n)
+{
+    log_vec_simd(out.begin(), in.begin(), n);
+}
+
+void __noinline__ bench_1_simd_mp(void)
+{
+    log_vec_simd<64>(out.begin(), in.begin());
+}
+
+int main(void)
+{
+    out.assign(0.f);
+
+    const unsigned int iterations = 5000000;
+
+    in.assign(0.2f);
+    cout << "log(0.2):" << endl;
+    run_bench(boost::bind(bench_1, 64), iterations);
+    run_bench(boost::bind(bench_1_simd, 64), iterations);
+    run_bench(boost::bind(bench_1_simd_mp), iterations);
+
+    for (unsigned int i = 0; i != in.size(); ++i)
+        in[i] = 0.01f + i / 64.f;
+    cout << "log([0.01..1]):" << endl;
+    run_bench(boost::bind(bench_1, 64), iterations);
+    run_bench(boost::bind(bench_1_simd, 64), iterations);
+    run_bench(boost::bind(bench_1_simd_mp), iterations);
+}
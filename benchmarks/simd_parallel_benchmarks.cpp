@@ -0,0 +1,72 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_horizontal_functions.hpp"
+#include "../simd_peakmeter.hpp"
+#include "../simd_parallel.hpp"
+
+using namespace nova;
+using namespace std;
+
+/* about 95 seconds at 44.1kHz */
+const unsigned int size = 1 << 22;
+
+aligned_array<float, size> out, in1, in2, in3;
+
+void __noinline__ bench_muladd(unsigned int n)
+{
+    muladd_vec_simd(out.begin(), in1.begin(), in2.begin(), in3.begin(), n);
+}
+
+void __noinline__ bench_muladd_parallel(parallel::policy const & policy, unsigned int n)
+{
+    muladd_vec_simd(policy, out.begin(), in1.begin(), in2.begin(), in3.begin(), n);
+}
+
+void __noinline__ bench_peak_rms(unsigned int n)
+{
+    float peak = 0, squared_sum = 0;
+    peak_rms_vec_simd(in1.begin(), &peak, &squared_sum, n);
+}
+
+void __noinline__ bench_peak_rms_parallel(parallel::policy const & policy, unsigned int n)
+{
+    float peak = 0, squared_sum = 0;
+    peak_rms_vec_simd(policy, in1.begin(), &peak, &squared_sum, n);
+}
+
+void __noinline__ bench_sum(unsigned int n)
+{
+    horizontal_sum_vec_simd(in1.begin(), n);
+}
+
+void __noinline__ bench_sum_parallel(parallel::policy const & policy, unsigned int n)
+{
+    horizontal_sum_vec_simd(policy, in1.begin(), n);
+}
+
+int main(void)
+{
+    out.assign(0.f);
+    fill_container(in1);
+    in2.assign(0.5f);
+    in3.assign(0.1f);
+
+    const unsigned int iterations = 100;
+
+    parallel::thread_pool pool;
+    parallel::policy policy(pool);
+    cout << "threads: " << pool.size() << endl;
+
+    cout << "muladd:" << endl;
+    run_bench(boost::bind(bench_muladd, size), iterations);
+    run_bench(boost::bind(bench_muladd_parallel, boost::cref(policy), size), iterations);
+
+    cout << "peak_rms:" << endl;
+    run_bench(boost::bind(bench_peak_rms, size), iterations);
+    run_bench(boost::bind(bench_peak_rms_parallel, boost::cref(policy), size), iterations);
+
+    cout << "horizontal_sum:" << endl;
+    run_bench(boost::bind(bench_sum, size), iterations);
+    run_bench(boost::bind(bench_sum_parallel, boost::cref(policy), size), iterations);
+}
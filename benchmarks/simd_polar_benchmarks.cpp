@@ -0,0 +1,87 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, out2, real, imag;
+
+void __noinline__ bench_atan2_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = std::atan2(imag[i], real[i]);
+}
+
+void __noinline__ bench_atan2_simd(unsigned int n)
+{
+    atan2_vec_simd(out.begin(), imag.begin(), real.begin(), n);
+}
+
+void __noinline__ bench_hypot_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = std::hypot(real[i], imag[i]);
+}
+
+void __noinline__ bench_hypot_simd(unsigned int n)
+{
+    hypot_vec_simd(out.begin(), real.begin(), imag.begin(), n);
+}
+
+void __noinline__ bench_cartesian_to_polar_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i) {
+        out[i]  = std::hypot(real[i], imag[i]);
+        out2[i] = std::atan2(imag[i], real[i]);
+    }
+}
+
+void __noinline__ bench_cartesian_to_polar_simd(unsigned int n)
+{
+    cartesian_to_polar_vec_simd(out.begin(), out2.begin(), real.begin(), imag.begin(), n);
+}
+
+void __noinline__ bench_polar_to_cartesian_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i) {
+        out[i]  = real[i] * std::cos(imag[i]);
+        out2[i] = real[i] * std::sin(imag[i]);
+    }
+}
+
+void __noinline__ bench_polar_to_cartesian_simd(unsigned int n)
+{
+    polar_to_cartesian_vec_simd(out.begin(), out2.begin(), real.begin(), imag.begin(), n);
+}
+
+int main(void)
+{
+    out.assign(0.f);
+    out2.assign(0.f);
+
+    for (int i = 0; i != 64; ++i) {
+        real[i] = std::cos(i * 0.1f) * (i + 1);
+        imag[i] = std::sin(i * 0.1f) * (i + 1);
+    }
+
+    const unsigned int iterations = 5000000;
+
+    cout << "atan2: libm, simd" << endl;
+    run_bench(boost::bind(bench_atan2_libm, 64), iterations);
+    run_bench(boost::bind(bench_atan2_simd, 64), iterations);
+
+    cout << "hypot: libm, simd" << endl;
+    run_bench(boost::bind(bench_hypot_libm, 64), iterations);
+    run_bench(boost::bind(bench_hypot_simd, 64), iterations);
+
+    cout << "cartesian to polar: libm, simd" << endl;
+    run_bench(boost::bind(bench_cartesian_to_polar_libm, 64), iterations);
+    run_bench(boost::bind(bench_cartesian_to_polar_simd, 64), iterations);
+
+    cout << "polar to cartesian: libm, simd" << endl;
+    run_bench(boost::bind(bench_polar_to_cartesian_libm, 64), iterations);
+    run_bench(boost::bind(bench_polar_to_cartesian_simd, 64), iterations);
+}
@@ -0,0 +1,49 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../vec.hpp"
+#include "../simd_polynomial.hpp"
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, in;
+
+struct degree_8
+{
+    static constexpr double coefficients[] = { 1.0, 1.0, 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040,
+                                               1.0/40320 };
+};
+
+struct degree_16
+{
+    static constexpr double coefficients[] = { 1.0, 1.0, 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040,
+                                               1.0/40320, 1.0/362880, 1.0/3628800, 1.0/39916800,
+                                               1.0/479001600, 1.0/6227020800, 1.0/87178291200,
+                                               1.0/1307674368000, 1.0/20922789888000 };
+};
+
+template <typename Coefficients, typename Scheme>
+void __noinline__ bench_polynomial(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; i += vec<float>::size) {
+        vec<float> arg;
+        arg.load_aligned(in.begin() + i);
+        Scheme::template evaluate<Coefficients, true>(arg).store_aligned(out.begin() + i);
+    }
+}
+
+int main(void)
+{
+    out.assign(0.f);
+    in.assign(0.3f);
+
+    const unsigned int iterations = 5000000;
+
+    cout << "degree 8: horner, estrin" << endl;
+    run_bench(boost::bind(bench_polynomial<degree_8, horner_scheme>, 64), iterations);
+    run_bench(boost::bind(bench_polynomial<degree_8, estrin_scheme>, 64), iterations);
+
+    cout << "degree 16: horner, estrin" << endl;
+    run_bench(boost::bind(bench_polynomial<degree_16, horner_scheme>, 64), iterations);
+    run_bench(boost::bind(bench_polynomial<degree_16, estrin_scheme>, 64), iterations);
+}
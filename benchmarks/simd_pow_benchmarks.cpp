@@ -19,6 +19,16 @@ void __noinline__ bench_1_simd(unsigned int n)
     spow_vec_simd(out.begin(), in.begin(), 2.3f, n);
 }
 
+void __noinline__ bench_3(unsigned int n)
+{
+    pow_vec(out.begin(), in.begin(), in2.begin(), n);
+}
+
+void __noinline__ bench_3_simd(unsigned int n)
+{
+    pow_vec_simd(out.begin(), in.begin(), in2.begin(), n);
+}
+
 void __noinline__ bench_2(unsigned int n)
 {
     spow_vec(out.begin(), in.begin(), in2.begin(), n);
@@ -45,4 +55,7 @@ int main(void)
 
     run_bench(boost::bind(bench_2, 64), iterations);
     run_bench(boost::bind(bench_2_simd, 64), iterations);
+
+    run_bench(boost::bind(bench_3, 64), iterations);
+    run_bench(boost::bind(bench_3_simd, 64), iterations);
 }
@@ -0,0 +1,70 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_mix.hpp"
+
+using namespace nova;
+using namespace std;
+
+/* 16MB per stream */
+const unsigned int max_size = 1 << 22;
+
+aligned_array<float, max_size> out, in1, in2, in3, in4;
+
+/* the prefetch distance is a template argument of the unroller, so each distance is a separate kernel */
+template <unsigned int distance>
+void __noinline__ bench_sum2(unsigned int n)
+{
+    detail::generate_simd_loop<true, false, distance>(out.begin(), detail::wrap_vector_arg(wrap_argument(in1.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in2.begin())),
+                                                      n, detail::sum());
+}
+
+template <unsigned int distance>
+void __noinline__ bench_sum3(unsigned int n)
+{
+    detail::generate_simd_loop<true, false, distance>(out.begin(), detail::wrap_vector_arg(wrap_argument(in1.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in2.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in3.begin())),
+                                                      n, detail::sum());
+}
+
+template <unsigned int distance>
+void __noinline__ bench_sum4(unsigned int n)
+{
+    detail::generate_simd_loop<true, false, distance>(out.begin(), detail::wrap_vector_arg(wrap_argument(in1.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in2.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in3.begin())),
+                                                      detail::wrap_vector_arg(wrap_argument(in4.begin())),
+                                                      n, detail::sum());
+}
+
+template <unsigned int distance>
+void run_sizes(void)
+{
+    cout << "prefetch distance: " << distance << " bytes" << endl;
+
+    /* from 4kB to 16MB per stream, reading 1GB per stream and size */
+    for (unsigned int size = 1024; size <= max_size; size *= 4) {
+        const unsigned int iterations = (1u << 28) / size;
+        cout << size * sizeof(float) / 1024 << "kB, 2/3/4 streams" << endl;
+        run_bench(boost::bind(bench_sum2<distance>, size), iterations);
+        run_bench(boost::bind(bench_sum3<distance>, size), iterations);
+        run_bench(boost::bind(bench_sum4<distance>, size), iterations);
+    }
+    cout << endl;
+}
+
+int main(void)
+{
+    out.assign(0.f);
+    fill_container(in1);
+    fill_container(in2);
+    fill_container(in3);
+    fill_container(in4);
+
+    run_sizes<0>();
+    run_sizes<256>();
+    run_sizes<512>();
+    run_sizes<1024>();
+    run_sizes<2048>();
+}
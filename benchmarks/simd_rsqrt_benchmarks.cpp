@@ -0,0 +1,81 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_unary_arithmetic.hpp"
+#include "../simd_math.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, in;
+
+void __noinline__ bench_rsqrt_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = 1.f / std::sqrt(in[i]);
+}
+
+void __noinline__ bench_rsqrt_estimate(unsigned int n)
+{
+    fast_rsqrt_vec_simd(out.begin(), in.begin(), n);
+}
+
+template <unsigned int NewtonSteps>
+void __noinline__ bench_rsqrt_newton(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; i += vec<float>::size) {
+        vec<float> arg;
+        arg.load_aligned(in.begin() + i);
+        detail::vec_rsqrt_newton<NewtonSteps>(arg).store_aligned(out.begin() + i);
+    }
+}
+
+void __noinline__ bench_rsqrt_sqrt(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; i += vec<float>::size) {
+        vec<float> arg;
+        arg.load_aligned(in.begin() + i);
+        (vec<float>(1.f) / sqrt(arg)).store_aligned(out.begin() + i);
+    }
+}
+
+void __noinline__ bench_sqrt(unsigned int n)
+{
+    sqrt_vec_simd(out.begin(), in.begin(), n);
+}
+
+void __noinline__ bench_cbrt_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = std::cbrt(in[i]);
+}
+
+void __noinline__ bench_cbrt(unsigned int n)
+{
+    cbrt_vec_simd(out.begin(), in.begin(), n);
+}
+
+int main(void)
+{
+    out.assign(0.f);
+
+    for (int i = 0; i != 64; ++i)
+        in[i] = 0.5f + i;
+
+    const unsigned int iterations = 5000000;
+
+    cout << "rsqrt: libm, estimate, 1 newton step, 2 newton steps, 1/sqrt" << endl;
+    run_bench(boost::bind(bench_rsqrt_libm, 64), iterations);
+    run_bench(boost::bind(bench_rsqrt_estimate, 64), iterations);
+    run_bench(boost::bind(bench_rsqrt_newton<1>, 64), iterations);
+    run_bench(boost::bind(bench_rsqrt_newton<2>, 64), iterations);
+    run_bench(boost::bind(bench_rsqrt_sqrt, 64), iterations);
+
+    cout << "sqrt:" << endl;
+    run_bench(boost::bind(bench_sqrt, 64), iterations);
+
+    cout << "cbrt: libm, simd" << endl;
+    run_bench(boost::bind(bench_cbrt_libm, 64), iterations);
+    run_bench(boost::bind(bench_cbrt, 64), iterations);
+}
@@ -0,0 +1,103 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../softclip.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, args;
+
+void __noinline__ bench_erf_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = std::erf(args[i]);
+}
+
+void __noinline__ bench_erf_simd(unsigned int n)
+{
+    erf_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_erfc_libm(unsigned int n)
+{
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = std::erfc(args[i]);
+}
+
+void __noinline__ bench_erfc_simd(unsigned int n)
+{
+    erfc_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_tanh_simd(unsigned int n)
+{
+    tanh_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_softclip_simd(unsigned int n)
+{
+    softclip_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid1(unsigned int n)
+{
+    algebraic_sigmoid1_vec(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid1_simd(unsigned int n)
+{
+    algebraic_sigmoid1_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid2(unsigned int n)
+{
+    algebraic_sigmoid2_vec(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid2_simd(unsigned int n)
+{
+    algebraic_sigmoid2_vec_simd(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid4(unsigned int n)
+{
+    algebraic_sigmoid4_vec(out.begin(), args.begin(), n);
+}
+
+void __noinline__ bench_sigmoid4_simd(unsigned int n)
+{
+    algebraic_sigmoid4_vec_simd(out.begin(), args.begin(), n);
+}
+
+int main(void)
+{
+    out.assign(0.f);
+
+    for (int i = 0; i != 64; ++i)
+        args[i] = float(i - 32) / 8.f;
+
+    const unsigned int iterations = 5000000;
+
+    cout << "erf: libm, simd" << endl;
+    run_bench(boost::bind(bench_erf_libm, 64), iterations);
+    run_bench(boost::bind(bench_erf_simd, 64), iterations);
+
+    cout << "erfc: libm, simd" << endl;
+    run_bench(boost::bind(bench_erfc_libm, 64), iterations);
+    run_bench(boost::bind(bench_erfc_simd, 64), iterations);
+
+    cout << "tanh, softclip: simd" << endl;
+    run_bench(boost::bind(bench_tanh_simd, 64), iterations);
+    run_bench(boost::bind(bench_softclip_simd, 64), iterations);
+
+    cout << "algebraic sigmoids, order 1, 2, 4: scalar, simd" << endl;
+    run_bench(boost::bind(bench_sigmoid1, 64), iterations);
+    run_bench(boost::bind(bench_sigmoid1_simd, 64), iterations);
+    run_bench(boost::bind(bench_sigmoid2, 64), iterations);
+    run_bench(boost::bind(bench_sigmoid2_simd, 64), iterations);
+    run_bench(boost::bind(bench_sigmoid4, 64), iterations);
+    run_bench(boost::bind(bench_sigmoid4_simd, 64), iterations);
+}
@@ -0,0 +1,54 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out_sin, out_cos, in;
+aligned_array<double, 64> out_sin_d, out_cos_d, in_d;
+
+void __noinline__ bench_separate(unsigned int n)
+{
+    sin_vec_simd(out_sin.begin(), in.begin(), n);
+    cos_vec_simd(out_cos.begin(), in.begin(), n);
+}
+
+void __noinline__ bench_sincos(unsigned int n)
+{
+    sincos_vec_simd(out_sin.begin(), out_cos.begin(), in.begin(), n);
+}
+
+void __noinline__ bench_separate_double(unsigned int n)
+{
+    sin_vec_simd(out_sin_d.begin(), in_d.begin(), n);
+    cos_vec_simd(out_cos_d.begin(), in_d.begin(), n);
+}
+
+void __noinline__ bench_sincos_double(unsigned int n)
+{
+    sincos_vec_simd(out_sin_d.begin(), out_cos_d.begin(), in_d.begin(), n);
+}
+
+int main(void)
+{
+    out_sin.assign(0.f);
+    out_cos.assign(0.f);
+    out_sin_d.assign(0.0);
+    out_cos_d.assign(0.0);
+
+    const unsigned int iterations = 5000000;
+
+    in.assign(0.2f);
+    in_d.assign(0.2);
+
+    cout << "sin + cos vs. sincos, float:" << endl;
+    run_bench(boost::bind(bench_separate, 64), iterations);
+    run_bench(boost::bind(bench_sincos, 64), iterations);
+
+    cout << "sin + cos vs. sincos, double:" << endl;
+    run_bench(boost::bind(bench_separate_double, 64), iterations);
+    run_bench(boost::bind(bench_sincos_double, 64), iterations);
+}
@@ -0,0 +1,53 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_transpose.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 1024;
+
+aligned_array<float, size * size> src, dest;
+
+void __noinline__ bench_transpose(unsigned int rows, unsigned int columns)
+{
+    transpose_vec(dest.begin(), src.begin(), rows, columns);
+}
+
+void __noinline__ bench_transpose_simd(unsigned int rows, unsigned int columns)
+{
+    transpose_vec_simd(dest.begin(), src.begin(), rows, columns);
+}
+
+template <unsigned int n>
+void __noinline__ bench_transpose_block(void)
+{
+    transpose_block<n>(dest.begin(), 16, src.begin(), 16);
+}
+
+template <unsigned int n>
+void __noinline__ bench_transpose_block_scalar(void)
+{
+    transpose_vec(dest.begin(), src.begin(), n, n);
+}
+
+int main(void)
+{
+    src.assign(0.f);
+    dest.assign(0.f);
+
+    cout << "4x4, 8x8 and 16x16 blocks: scalar, simd" << endl;
+    run_bench(bench_transpose_block_scalar<4>, 50000000);
+    run_bench(bench_transpose_block<4>, 50000000);
+    run_bench(bench_transpose_block_scalar<8>, 20000000);
+    run_bench(bench_transpose_block<8>, 20000000);
+    run_bench(bench_transpose_block_scalar<16>, 5000000);
+    run_bench(bench_transpose_block<16>, 5000000);
+
+    for (unsigned int n = 64; n <= size; n *= 4) {
+        const unsigned int iterations = 200000000 / (n * n);
+        cout << n << "x" << n << " matrix: scalar, simd" << endl;
+        run_bench(boost::bind(bench_transpose, n, n), iterations);
+        run_bench(boost::bind(bench_transpose_simd, n, n), iterations);
+    }
+}
@@ -0,0 +1,48 @@
+#include "benchmark_helpers.hpp"
+#include "cache_aligned_array.hpp"
+#include "../simd_wavetable.hpp"
+
+#include <cmath>
+
+using namespace nova;
+using namespace std;
+
+aligned_array<float, 64> out, phase;
+aligned_array<float, 4096> table;
+
+template <typename Interpolation>
+void __noinline__ bench_table_read(unsigned int n)
+{
+    table_read_vec<Interpolation>(out.begin(), table.begin(), 4096, phase.begin(), n);
+}
+
+template <typename Interpolation>
+void __noinline__ bench_table_read_simd(unsigned int n)
+{
+    table_read_vec_simd<Interpolation>(out.begin(), table.begin(), 4096, phase.begin(), n);
+}
+
+int main(void)
+{
+    out.assign(0.f);
+
+    for (int i = 0; i != 4096; ++i)
+        table[i] = std::sin(i * (2 * M_PI / 4096));
+
+    for (int i = 0; i != 64; ++i)
+        phase[i] = std::fmod(i * 97.31f, 4096.f);
+
+    const unsigned int iterations = 5000000;
+
+    cout << "no interpolation: scalar, simd" << endl;
+    run_bench(boost::bind(bench_table_read<interpolation::none>, 64), iterations);
+    run_bench(boost::bind(bench_table_read_simd<interpolation::none>, 64), iterations);
+
+    cout << "linear interpolation: scalar, simd" << endl;
+    run_bench(boost::bind(bench_table_read<interpolation::linear>, 64), iterations);
+    run_bench(boost::bind(bench_table_read_simd<interpolation::linear>, 64), iterations);
+
+    cout << "cubic interpolation: scalar, simd" << endl;
+    run_bench(boost::bind(bench_table_read<interpolation::cubic>, 64), iterations);
+    run_bench(boost::bind(bench_table_read_simd<interpolation::cubic>, 64), iterations);
+}
@@ -21,6 +21,7 @@
 
 #include "wrap_argument_vector.hpp"
 #include "unroll_helpers.hpp"
+#include "expression.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -30,8 +31,15 @@
 
 
 namespace nova {
+
+namespace parallel { class policy; }
+
 namespace detail {
 
+/* defined in simd_parallel.hpp */
+template <typename Functor, typename FloatType>
+struct parallel_functor;
+
 template <typename Functor>
 struct unary_functor
 {
@@ -47,12 +55,43 @@ struct unary_functor
         nova::detail::generate_simd_loop(out, nova::detail::wrap_vector_arg(wrap_argument(arg)), n, Functor());
     }
 
+    template <typename FloatType>
+    static always_inline void perform_vec_simd_any(FloatType * out, const FloatType * arg, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_any(out, nova::detail::wrap_vector_arg(wrap_argument(arg)), n, Functor());
+    }
+
+    template <typename FloatType>
+    static always_inline void perform_vec_simd_stream(FloatType * out, const FloatType * arg, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_stream(out, nova::detail::wrap_vector_arg(wrap_argument(arg)), n, Functor());
+    }
+
     template <unsigned int n, typename FloatType>
     static always_inline void perform_vec_simd(FloatType * out, const FloatType * arg)
     {
         nova::detail::vector_pointer_argument<FloatType> varg(arg);
         nova::detail::compile_time_unroller<FloatType, n>::run(out, varg, Functor());
     }
+
+    template <typename FloatType, typename ArgType>
+    static always_inline void perform_vec_na_simd(FloatType * out, ArgType arg, unsigned int n)
+    {
+        nova::detail::generate_simd_loop<false>(out, nova::detail::wrap_vector_arg(wrap_na_argument(arg)), n, Functor());
+    }
+
+    template <unsigned int n, typename FloatType, typename ArgType>
+    static always_inline void perform_vec_na_simd(FloatType * out, ArgType arg)
+    {
+        perform_vec_simd_<n, false, FloatType>(out, nova::detail::wrap_vector_arg(wrap_na_argument(arg)));
+    }
+
+private:
+    template <unsigned int n, bool aligned, typename FloatType, typename ArgType>
+    static always_inline void perform_vec_simd_(FloatType * out, ArgType arg)
+    {
+        nova::detail::compile_time_unroller<FloatType, n, aligned>::run(out, arg, Functor());
+    }
 };
 
 template <typename Functor>
@@ -73,19 +112,54 @@ struct binary_functor
                                          n, Functor());
     }
 
+    template <typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_simd_any(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_any(out,
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                             n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_simd_stream(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_stream(out,
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                                n, Functor());
+    }
+
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type>
     static always_inline void perform_vec_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2)
     {
-        perform_vec_simd_<n, FloatType>(out,
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)));
+        perform_vec_simd_<n, true, FloatType>(out,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)));
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n)
+    {
+        nova::detail::generate_simd_loop<false>(out,
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg2)),
+                                                n, Functor());
     }
 
-private:
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2)
+    {
+        perform_vec_simd_<n, false, FloatType>(out,
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg2)));
+    }
+
+private:
+    template <unsigned int n, bool aligned, typename FloatType, typename Arg1Type, typename Arg2Type>
     static always_inline void perform_vec_simd_(FloatType * out, Arg1Type arg1, Arg2Type arg2)
     {
-        nova::detail::compile_time_unroller<FloatType, n>::run(out, arg1, arg2, Functor());
+        nova::detail::compile_time_unroller<FloatType, n, aligned>::run(out, arg1, arg2, Functor());
     }
 };
 
@@ -108,20 +182,59 @@ struct ternary_functor
                                          n, Functor());
     }
 
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
+    static always_inline void perform_vec_simd_any(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_any(out,
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                             n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
+    static always_inline void perform_vec_simd_stream(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_stream(out,
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                                n, Functor());
+    }
+
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
     static always_inline void perform_vec_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3)
     {
-        perform_vec_simd_<n, FloatType>(out,
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg3)));
+        perform_vec_simd_<n, true, FloatType>(out,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg3)));
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, unsigned int n)
+    {
+        nova::detail::generate_simd_loop<false>(out,
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg2)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg3)),
+                                                n, Functor());
     }
 
-private:
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3)
+    {
+        perform_vec_simd_<n, false, FloatType>(out,
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg2)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg3)));
+    }
+
+private:
+    template <unsigned int n, bool aligned, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type>
     static always_inline void perform_vec_simd_(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3)
     {
-        nova::detail::compile_time_unroller<FloatType, n>::run(out, arg1, arg2, arg3, Functor());
+        nova::detail::compile_time_unroller<FloatType, n, aligned>::run(out, arg1, arg2, arg3, Functor());
     }
 };
 
@@ -146,21 +259,64 @@ struct quarternary_functor
                                          n, Functor());
     }
 
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_simd_any(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_any(out,
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                             nova::detail::wrap_vector_arg(wrap_argument(arg4)),
+                                             n, Functor());
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_simd_stream(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        nova::detail::generate_simd_loop_stream(out,
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                                nova::detail::wrap_vector_arg(wrap_argument(arg4)),
+                                                n, Functor());
+    }
+
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
     static always_inline void perform_vec_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4)
     {
-        perform_vec_simd_<n, FloatType>(out,
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg1)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg2)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg3)),
-                                        nova::detail::wrap_vector_arg(wrap_argument(arg4)));
+        perform_vec_simd_<n, true, FloatType>(out,
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg1)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg2)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg3)),
+                                              nova::detail::wrap_vector_arg(wrap_argument(arg4)));
+    }
+
+    template <typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        nova::detail::generate_simd_loop<false>(out,
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg2)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg3)),
+                                                nova::detail::wrap_vector_arg(wrap_na_argument(arg4)),
+                                                n, Functor());
     }
 
-private:
     template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static always_inline void perform_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4)
+    {
+        perform_vec_simd_<n, false, FloatType>(out,
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg1)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg2)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg3)),
+                                               nova::detail::wrap_vector_arg(wrap_na_argument(arg4)));
+    }
+
+private:
+    template <unsigned int n, bool aligned, typename FloatType, typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
     static always_inline void perform_vec_simd_(FloatType * out, Arg1Type arg1, Arg2Type arg2, Arg3Type arg3, Arg4Type arg4)
     {
-        nova::detail::compile_time_unroller<FloatType, n>::run(out, arg1, arg2, arg3, arg4, Functor());
+        nova::detail::compile_time_unroller<FloatType, n, aligned>::run(out, arg1, arg2, arg3, arg4, Functor());
     }
 };
 
@@ -187,6 +343,43 @@ template <unsigned int n, typename FloatType>                           \
 inline void NAME##_vec_simd(FloatType * out, const FloatType * arg)     \
 {                                                                       \
     nova::detail::unary_functor<FUNCTOR>::perform_vec_simd<n, FloatType>(out, arg); \
+}                                                                       \
+                                                                        \
+template <typename FloatType>                                           \
+inline void NAME##_vec_simd(nova::parallel::policy const & policy, FloatType * out, const FloatType * arg, unsigned int n) \
+{                                                                       \
+    nova::detail::parallel_functor<FUNCTOR, FloatType>::perform_vec_simd(policy, out, arg, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType>                                           \
+inline void NAME##_vec_simd_any(FloatType * out, const FloatType * arg, unsigned int n) \
+{                                                                       \
+    nova::detail::unary_functor<FUNCTOR>::perform_vec_simd_any<FloatType>(out, arg, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType>                                           \
+inline void NAME##_vec_simd_stream(FloatType * out, const FloatType * arg, unsigned int n) \
+{                                                                       \
+    nova::detail::unary_functor<FUNCTOR>::perform_vec_simd_stream<FloatType>(out, arg, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename ArgType>                         \
+inline void NAME##_vec_na_simd(FloatType * out, ArgType arg, unsigned int n) \
+{                                                                       \
+    nova::detail::unary_functor<FUNCTOR>::perform_vec_na_simd<FloatType>(out, arg, n); \
+}                                                                       \
+                                                                        \
+template <unsigned int n, typename FloatType, typename ArgType>         \
+inline void NAME##_vec_na_simd(FloatType * out, ArgType arg)            \
+{                                                                       \
+    nova::detail::unary_functor<FUNCTOR>::perform_vec_na_simd<n, FloatType>(out, arg); \
+}                                                                       \
+                                                                        \
+template <typename ArgType>                                             \
+inline auto NAME##_expr(ArgType arg)                                    \
+    -> decltype(nova::detail::make_unary_expression<FUNCTOR>(arg))      \
+{                                                                       \
+    return nova::detail::make_unary_expression<FUNCTOR>(arg);           \
 }
 
 #define NOVA_SIMD_DEFINE_BINARY_WRAPPER(NAME, FUNCTOR)                  \
@@ -207,6 +400,43 @@ template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Ty
 inline void NAME##_vec_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2) \
 {                                                                       \
     nova::detail::binary_functor<FUNCTOR>::perform_vec_simd<n, FloatType>(out, arg1, arg2); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename Arg1Type, typename Arg2Type>     \
+inline void NAME##_vec_simd(nova::parallel::policy const & policy, FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::parallel_functor<FUNCTOR, FloatType>::perform_vec_simd(policy, out, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename Arg1Type, typename Arg2Type>     \
+inline void NAME##_vec_simd_any(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::binary_functor<FUNCTOR>::perform_vec_simd_any<FloatType>(out, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename Arg1Type, typename Arg2Type>     \
+inline void NAME##_vec_simd_stream(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::binary_functor<FUNCTOR>::perform_vec_simd_stream<FloatType>(out, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType, typename Arg1Type, typename Arg2Type>     \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2, unsigned int n) \
+{                                                                       \
+    nova::detail::binary_functor<FUNCTOR>::perform_vec_na_simd<FloatType>(out, arg1, arg2, n); \
+}                                                                       \
+                                                                        \
+template <unsigned int n, typename FloatType, typename Arg1Type, typename Arg2Type> \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1Type arg1, Arg2Type arg2) \
+{                                                                       \
+    nova::detail::binary_functor<FUNCTOR>::perform_vec_na_simd<n, FloatType>(out, arg1, arg2); \
+}                                                                       \
+                                                                        \
+template <typename Arg1Type, typename Arg2Type>                         \
+inline auto NAME##_expr(Arg1Type arg1, Arg2Type arg2)                   \
+    -> decltype(nova::detail::make_binary_expression<FUNCTOR>(arg1, arg2)) \
+{                                                                       \
+    return nova::detail::make_binary_expression<FUNCTOR>(arg1, arg2);   \
 }
 
 
@@ -241,6 +471,64 @@ template <int N,                                                        \
 inline void NAME##_vec_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3) \
 {                                                                       \
     nova::detail::ternary_functor<FUNCTOR>::perform_vec_simd<N, FloatType>(out, arg1, arg2, arg3); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(nova::parallel::policy const & policy, FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n) \
+{                                                                       \
+    nova::detail::parallel_functor<FUNCTOR, FloatType>::perform_vec_simd(policy, out, arg1, arg2, arg3, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3                                                 \
+         >                                                              \
+inline void NAME##_vec_simd_any(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n) \
+{                                                                       \
+    nova::detail::ternary_functor<FUNCTOR>::perform_vec_simd_any<FloatType>(out, arg1, arg2, arg3, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3                                                 \
+         >                                                              \
+inline void NAME##_vec_simd_stream(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n) \
+{                                                                       \
+    nova::detail::ternary_functor<FUNCTOR>::perform_vec_simd_stream<FloatType>(out, arg1, arg2, arg3, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3                                                 \
+         >                                                              \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n) \
+{                                                                       \
+    nova::detail::ternary_functor<FUNCTOR>::perform_vec_na_simd<FloatType>(out, arg1, arg2, arg3, n); \
+}                                                                       \
+                                                                        \
+template <int N,                                                        \
+          typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3                                                 \
+         >                                                              \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3) \
+{                                                                       \
+    nova::detail::ternary_functor<FUNCTOR>::perform_vec_na_simd<N, FloatType>(out, arg1, arg2, arg3); \
+}                                                                       \
+                                                                        \
+template <typename Arg1, typename Arg2, typename Arg3>                  \
+inline auto NAME##_expr(Arg1 arg1, Arg2 arg2, Arg3 arg3)                \
+    -> decltype(nova::detail::make_ternary_expression<FUNCTOR>(arg1, arg2, arg3)) \
+{                                                                       \
+    return nova::detail::make_ternary_expression<FUNCTOR>(arg1, arg2, arg3); \
 }
 
 
@@ -278,6 +566,62 @@ template <int N,                                                        \
 inline void NAME##_vec_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4) \
 {                                                                       \
     nova::detail::quarternary_functor<FUNCTOR>::perform_vec_simd<N, FloatType>(out, arg1, arg2, arg3, arg4); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_simd(nova::parallel::policy const & policy, FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n) \
+{                                                                       \
+    nova::detail::parallel_functor<FUNCTOR, FloatType>::perform_vec_simd(policy, out, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_simd_any(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n) \
+{                                                                       \
+    nova::detail::quarternary_functor<FUNCTOR>::perform_vec_simd_any<FloatType>(out, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_simd_stream(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n) \
+{                                                                       \
+    nova::detail::quarternary_functor<FUNCTOR>::perform_vec_simd_stream<FloatType>(out, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n) \
+{                                                                       \
+    nova::detail::quarternary_functor<FUNCTOR>::perform_vec_na_simd<FloatType>(out, arg1, arg2, arg3, arg4, n); \
+}                                                                       \
+                                                                        \
+template <int N,                                                        \
+          typename FloatType,                                           \
+          typename Arg1,                                                \
+          typename Arg2,                                                \
+          typename Arg3,                                                \
+          typename Arg4                                                 \
+         >                                                              \
+inline void NAME##_vec_na_simd(FloatType * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4) \
+{                                                                       \
+    nova::detail::quarternary_functor<FUNCTOR>::perform_vec_na_simd<N, FloatType>(out, arg1, arg2, arg3, arg4); \
 }
 
 
@@ -0,0 +1,120 @@
+//  function pointer tables for runtime cpu dispatching
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef NOVA_SIMD_DETAIL_DISPATCH_TABLE_HPP
+#define NOVA_SIMD_DETAIL_DISPATCH_TABLE_HPP
+
+/* this header only declares types: it is included by the per-target translation units, which are
+ * compiled with different instruction sets, so it must not define any inline functions */
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define NOVA_SIMD_DISPATCH_X86
+#endif
+
+/* kernels, which are compiled for each target */
+#define NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(X)   \
+    X(sin) X(cos) X(tan)                        \
+    X(asin) X(acos) X(atan)                     \
+    X(tanh) X(sinh) X(cosh)                     \
+    X(asinh) X(acosh) X(atanh)                  \
+    X(log) X(log2) X(log10) X(exp) X(exp2)      \
+    X(expm1) X(log1p) X(erf) X(erfc)            \
+    X(sqrt) X(rsqrt) X(cbrt) X(signed_sqrt)     \
+    X(abs) X(sgn) X(square) X(cube)             \
+    X(round) X(frac) X(ceil) X(floor) X(trunc)  \
+    X(undenormalize) X(reciprocal)              \
+    X(midi2freq) X(freq2midi)                   \
+    X(midi2ratio) X(ratio2midi)                 \
+    X(oct2freq) X(freq2oct)                     \
+    X(amp2db) X(db2amp)                         \
+    X(softclip)                                 \
+    X(algebraic_sigmoid1) X(algebraic_sigmoid2) \
+    X(algebraic_sigmoid4)
+
+#define NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(X)  \
+    X(plus) X(minus) X(times) X(over)           \
+    X(min) X(max)                               \
+    X(less) X(less_equal)                       \
+    X(greater) X(greater_equal)                 \
+    X(equal) X(notequal)                        \
+    X(clip2)                                    \
+    X(pow) X(spow)                              \
+    X(atan2) X(hypot)
+
+#define NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(X) \
+    X(clip) X(muladd) X(ampmod)
+
+
+namespace nova     {
+namespace dispatch {
+
+enum simd_target
+{
+    target_default, // instruction set of the compiler's default flags
+#ifdef NOVA_SIMD_DISPATCH_X86
+    target_avx,
+    target_avx2,    // avx2 and fma
+    target_avx512,  // avx512f and fma
+#endif
+    target_count
+};
+
+namespace detail {
+
+template <typename FloatType>
+struct kernel_table
+{
+    typedef void (*unary_kernel)(FloatType *, const FloatType *, unsigned int);
+    typedef void (*binary_kernel)(FloatType *, const FloatType *, const FloatType *, unsigned int);
+    typedef void (*binary_scalar_kernel)(FloatType *, const FloatType *, FloatType, unsigned int);
+    typedef void (*ternary_kernel)(FloatType *, const FloatType *, const FloatType *, const FloatType *, unsigned int);
+
+#define NOVA_SIMD_DISPATCH_UNARY_MEMBER(NAME) unary_kernel NAME;
+#define NOVA_SIMD_DISPATCH_BINARY_MEMBER(NAME) binary_kernel NAME; binary_scalar_kernel NAME##_scalar;
+#define NOVA_SIMD_DISPATCH_TERNARY_MEMBER(NAME) ternary_kernel NAME;
+
+    NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_UNARY_MEMBER)
+    NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(NOVA_SIMD_DISPATCH_BINARY_MEMBER)
+    NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_TERNARY_MEMBER)
+
+#undef NOVA_SIMD_DISPATCH_UNARY_MEMBER
+#undef NOVA_SIMD_DISPATCH_BINARY_MEMBER
+#undef NOVA_SIMD_DISPATCH_TERNARY_MEMBER
+};
+
+struct kernel_tables
+{
+    simd_target target;
+    kernel_table<float> float_kernels;
+    kernel_table<double> double_kernels;
+};
+
+/* defined in dispatch/simd_dispatch_*.cpp */
+kernel_tables const & kernel_tables_default(void);
+
+#ifdef NOVA_SIMD_DISPATCH_X86
+kernel_tables const & kernel_tables_avx(void);
+kernel_tables const & kernel_tables_avx2(void);
+kernel_tables const & kernel_tables_avx512(void);
+#endif
+
+} /* namespace detail */
+} /* namespace dispatch */
+} /* namespace nova */
+
+#endif /* NOVA_SIMD_DETAIL_DISPATCH_TABLE_HPP */
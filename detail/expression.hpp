@@ -0,0 +1,341 @@
+//  expression templates for fusing several functions into a single loop
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef NOVA_SIMD_DETAIL_EXPRESSION_HPP
+#define NOVA_SIMD_DETAIL_EXPRESSION_HPP
+
+#include "wrap_arguments.hpp"
+#include "wrap_argument_vector.hpp"
+#include "unroll_helpers.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* an expression node applies a functor to its arguments and behaves like an argument itself, so
+ * expression trees can be passed to the unroller like a single argument. the tree is built from
+ * scalar arguments and converted to vector arguments with wrap_vector_arg, like any other argument.
+ */
+
+namespace nova {
+namespace detail {
+
+template <typename Functor, typename Arg1>
+struct unary_expression
+{
+    typedef typename Arg1::value_type value_type;
+
+    always_inline explicit unary_expression(Arg1 const & arg1):
+        arg1(arg1)
+    {}
+
+    always_inline void increment(void)
+    {
+        arg1.increment();
+    }
+
+    always_inline value_type get(void) const
+    {
+        return Functor()(arg1.get());
+    }
+
+    always_inline value_type consume(void)
+    {
+        return Functor()(arg1.consume());
+    }
+
+    always_inline value_type consume_tail(unsigned int count)
+    {
+        return Functor()(arg1.consume_tail(count));
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return arg1.is_aligned();
+    }
+
+    always_inline void prefetch(std::size_t distance) const
+    {
+        arg1.prefetch(distance);
+    }
+
+    Arg1 arg1;
+};
+
+template <typename Functor, typename Arg1, typename Arg2>
+struct binary_expression
+{
+    typedef typename Arg1::value_type value_type;
+
+    always_inline binary_expression(Arg1 const & arg1, Arg2 const & arg2):
+        arg1(arg1), arg2(arg2)
+    {}
+
+    always_inline void increment(void)
+    {
+        arg1.increment();
+        arg2.increment();
+    }
+
+    always_inline value_type get(void) const
+    {
+        return Functor()(arg1.get(), arg2.get());
+    }
+
+    always_inline value_type consume(void)
+    {
+        value_type loaded1 = arg1.consume();
+        value_type loaded2 = arg2.consume();
+        return Functor()(loaded1, loaded2);
+    }
+
+    always_inline value_type consume_tail(unsigned int count)
+    {
+        value_type loaded1 = arg1.consume_tail(count);
+        value_type loaded2 = arg2.consume_tail(count);
+        return Functor()(loaded1, loaded2);
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return arg1.is_aligned() && arg2.is_aligned();
+    }
+
+    always_inline void prefetch(std::size_t distance) const
+    {
+        arg1.prefetch(distance);
+        arg2.prefetch(distance);
+    }
+
+    Arg1 arg1;
+    Arg2 arg2;
+};
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+struct ternary_expression
+{
+    typedef typename Arg1::value_type value_type;
+
+    always_inline ternary_expression(Arg1 const & arg1, Arg2 const & arg2, Arg3 const & arg3):
+        arg1(arg1), arg2(arg2), arg3(arg3)
+    {}
+
+    always_inline void increment(void)
+    {
+        arg1.increment();
+        arg2.increment();
+        arg3.increment();
+    }
+
+    always_inline value_type get(void) const
+    {
+        return Functor()(arg1.get(), arg2.get(), arg3.get());
+    }
+
+    always_inline value_type consume(void)
+    {
+        value_type loaded1 = arg1.consume();
+        value_type loaded2 = arg2.consume();
+        value_type loaded3 = arg3.consume();
+        return Functor()(loaded1, loaded2, loaded3);
+    }
+
+    always_inline value_type consume_tail(unsigned int count)
+    {
+        value_type loaded1 = arg1.consume_tail(count);
+        value_type loaded2 = arg2.consume_tail(count);
+        value_type loaded3 = arg3.consume_tail(count);
+        return Functor()(loaded1, loaded2, loaded3);
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return arg1.is_aligned() && arg2.is_aligned() && arg3.is_aligned();
+    }
+
+    always_inline void prefetch(std::size_t distance) const
+    {
+        arg1.prefetch(distance);
+        arg2.prefetch(distance);
+        arg3.prefetch(distance);
+    }
+
+    Arg1 arg1;
+    Arg2 arg2;
+    Arg3 arg3;
+};
+
+/* the root of the expression tree is passed to the unroller as single argument */
+struct evaluate_expression
+{
+    template <typename ValueType>
+    always_inline ValueType operator()(ValueType const & arg) const
+    {
+        return arg;
+    }
+};
+
+} /* namespace detail */
+
+/* expressions can be nested in other expressions */
+template <typename Functor, typename Arg1>
+always_inline detail::unary_expression<Functor, Arg1>
+wrap_argument(detail::unary_expression<Functor, Arg1> const & e)
+{
+    return e;
+}
+
+template <typename Functor, typename Arg1, typename Arg2>
+always_inline detail::binary_expression<Functor, Arg1, Arg2>
+wrap_argument(detail::binary_expression<Functor, Arg1, Arg2> const & e)
+{
+    return e;
+}
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+always_inline detail::ternary_expression<Functor, Arg1, Arg2, Arg3>
+wrap_argument(detail::ternary_expression<Functor, Arg1, Arg2, Arg3> const & e)
+{
+    return e;
+}
+
+namespace detail {
+
+/* used by the NAME_expr functions */
+template <typename Functor, typename Arg1>
+always_inline auto make_unary_expression(Arg1 const & arg1)
+    -> unary_expression<Functor, decltype(wrap_argument(arg1))>
+{
+    return unary_expression<Functor, decltype(wrap_argument(arg1))>(wrap_argument(arg1));
+}
+
+template <typename Functor, typename Arg1, typename Arg2>
+always_inline auto make_binary_expression(Arg1 const & arg1, Arg2 const & arg2)
+    -> binary_expression<Functor, decltype(wrap_argument(arg1)), decltype(wrap_argument(arg2))>
+{
+    return binary_expression<Functor, decltype(wrap_argument(arg1)), decltype(wrap_argument(arg2))>
+        (wrap_argument(arg1), wrap_argument(arg2));
+}
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+always_inline auto make_ternary_expression(Arg1 const & arg1, Arg2 const & arg2, Arg3 const & arg3)
+    -> ternary_expression<Functor, decltype(wrap_argument(arg1)), decltype(wrap_argument(arg2)),
+                          decltype(wrap_argument(arg3))>
+{
+    return ternary_expression<Functor, decltype(wrap_argument(arg1)), decltype(wrap_argument(arg2)),
+                              decltype(wrap_argument(arg3))>
+        (wrap_argument(arg1), wrap_argument(arg2), wrap_argument(arg3));
+}
+
+/* convert scalar expressions to vector expressions */
+template <typename Functor, typename Arg1>
+always_inline auto wrap_vector_arg(unary_expression<Functor, Arg1> const & e)
+    -> unary_expression<Functor, decltype(wrap_vector_arg(e.arg1))>
+{
+    return unary_expression<Functor, decltype(wrap_vector_arg(e.arg1))>(wrap_vector_arg(e.arg1));
+}
+
+template <typename Functor, typename Arg1, typename Arg2>
+always_inline auto wrap_vector_arg(binary_expression<Functor, Arg1, Arg2> const & e)
+    -> binary_expression<Functor, decltype(wrap_vector_arg(e.arg1)), decltype(wrap_vector_arg(e.arg2))>
+{
+    return binary_expression<Functor, decltype(wrap_vector_arg(e.arg1)), decltype(wrap_vector_arg(e.arg2))>
+        (wrap_vector_arg(e.arg1), wrap_vector_arg(e.arg2));
+}
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+always_inline auto wrap_vector_arg(ternary_expression<Functor, Arg1, Arg2, Arg3> const & e)
+    -> ternary_expression<Functor, decltype(wrap_vector_arg(e.arg1)), decltype(wrap_vector_arg(e.arg2)),
+                          decltype(wrap_vector_arg(e.arg3))>
+{
+    return ternary_expression<Functor, decltype(wrap_vector_arg(e.arg1)), decltype(wrap_vector_arg(e.arg2)),
+                              decltype(wrap_vector_arg(e.arg3))>
+        (wrap_vector_arg(e.arg1), wrap_vector_arg(e.arg2), wrap_vector_arg(e.arg3));
+}
+
+/* use unaligned loads for all vector arguments of the expression */
+template <typename Functor, typename Arg1>
+always_inline auto unaligned_vector_arg(unary_expression<Functor, Arg1> const & e)
+    -> unary_expression<Functor, decltype(unaligned_vector_arg(e.arg1))>
+{
+    return unary_expression<Functor, decltype(unaligned_vector_arg(e.arg1))>(unaligned_vector_arg(e.arg1));
+}
+
+template <typename Functor, typename Arg1, typename Arg2>
+always_inline auto unaligned_vector_arg(binary_expression<Functor, Arg1, Arg2> const & e)
+    -> binary_expression<Functor, decltype(unaligned_vector_arg(e.arg1)), decltype(unaligned_vector_arg(e.arg2))>
+{
+    return binary_expression<Functor, decltype(unaligned_vector_arg(e.arg1)), decltype(unaligned_vector_arg(e.arg2))>
+        (unaligned_vector_arg(e.arg1), unaligned_vector_arg(e.arg2));
+}
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+always_inline auto unaligned_vector_arg(ternary_expression<Functor, Arg1, Arg2, Arg3> const & e)
+    -> ternary_expression<Functor, decltype(unaligned_vector_arg(e.arg1)), decltype(unaligned_vector_arg(e.arg2)),
+                          decltype(unaligned_vector_arg(e.arg3))>
+{
+    return ternary_expression<Functor, decltype(unaligned_vector_arg(e.arg1)), decltype(unaligned_vector_arg(e.arg2)),
+                              decltype(unaligned_vector_arg(e.arg3))>
+        (unaligned_vector_arg(e.arg1), unaligned_vector_arg(e.arg2), unaligned_vector_arg(e.arg3));
+}
+
+} /* namespace detail */
+
+/* evaluate an expression in a single pass. the functions follow the conventions of the _vec,
+ * _vec_simd, _vec_simd_stream and _vec_simd_any functions */
+template <typename Expression>
+inline void fused_vec(typename Expression::value_type * out, Expression expr, unsigned int n)
+{
+    do {
+        *out++ = expr.consume();
+    } while (--n);
+}
+
+template <typename Expression>
+inline void fused_vec_simd(typename Expression::value_type * out, Expression expr, unsigned int n)
+{
+    detail::generate_simd_loop(out, detail::wrap_vector_arg(expr), n, detail::evaluate_expression());
+}
+
+template <unsigned int n, typename Expression>
+inline void fused_vec_simd(typename Expression::value_type * out, Expression expr)
+{
+    typedef typename Expression::value_type float_type;
+    auto vexpr = detail::wrap_vector_arg(expr);
+    detail::compile_time_unroller<float_type, n>::run(out, vexpr, detail::evaluate_expression());
+}
+
+template <typename Expression>
+inline void fused_vec_simd_stream(typename Expression::value_type * out, Expression expr, unsigned int n)
+{
+    detail::generate_simd_loop_stream(out, detail::wrap_vector_arg(expr), n, detail::evaluate_expression());
+}
+
+template <typename Expression>
+inline void fused_vec_simd_any(typename Expression::value_type * out, Expression expr, unsigned int n)
+{
+    detail::generate_simd_loop_any(out, detail::wrap_vector_arg(expr), n, detail::evaluate_expression());
+}
+
+} /* namespace nova */
+
+#undef always_inline
+
+#endif /* NOVA_SIMD_DETAIL_EXPRESSION_HPP */
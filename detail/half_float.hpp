@@ -0,0 +1,140 @@
+//  conversion between single and half precision floats
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef NOVA_SIMD_DETAIL_HALF_FLOAT_HPP
+#define NOVA_SIMD_DETAIL_HALF_FLOAT_HPP
+
+#include <cstring>
+
+#include "stdint.h"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* fp16 is ieee754 binary16 (1 sign, 5 exponent, 10 mantissa bits), bf16 is the upper half of a
+ * binary32 (1 sign, 8 exponent, 7 mantissa bits). both are stored as uint16_t. conversions from float
+ * round to nearest even, nans are quieted and keep the upper bits of their payload (like f16c) */
+
+namespace nova {
+namespace detail {
+
+always_inline uint32_t float_bits(float arg)
+{
+    uint32_t ret;
+    std::memcpy(&ret, &arg, sizeof(ret));
+    return ret;
+}
+
+always_inline float bits_float(uint32_t arg)
+{
+    float ret;
+    std::memcpy(&ret, &arg, sizeof(ret));
+    return ret;
+}
+
+inline float fp16_to_float(uint16_t arg)
+{
+    const uint32_t shifted_exponent = 0x7c00 << 13;
+
+    uint32_t bits = uint32_t(arg & 0x7fff) << 13;
+    const uint32_t exponent = bits & shifted_exponent;
+    bits += (127 - 15) << 23;
+
+    if (exponent == shifted_exponent)
+        bits += (128 - 16) << 23;                      /* inf / nan */
+    else if (exponent == 0)                            /* zero / subnormal: renormalize */
+        bits = float_bits(bits_float(bits + (1 << 23)) - bits_float(113 << 23));
+
+    return bits_float(bits | (uint32_t(arg & 0x8000) << 16));
+}
+
+inline uint16_t float_to_fp16(float arg)
+{
+    uint32_t bits = float_bits(arg);
+    const uint32_t sign = bits & 0x80000000;
+    bits ^= sign;
+
+    uint32_t ret;
+    if (bits >= (127 + 16) << 23)                      /* overflow, inf or nan */
+        ret = bits > 0x7f800000 ? 0x7e00 | ((bits >> 13) & 0x3ff) : 0x7c00;
+    else if (bits < (127 - 14) << 23) {
+        /* subnormal or zero: adding 0.5 aligns the mantissa, the fpu rounds to nearest even */
+        const uint32_t magic = (127 - 1) << 23;
+        ret = float_bits(bits_float(bits) + bits_float(magic)) - magic;
+    } else {
+        const uint32_t mantissa_odd = (bits >> 13) & 1;
+        bits = bits - ((127u - 15) << 23) + 0xfff + mantissa_odd;
+        ret = bits >> 13;                              /* a carry out of the mantissa may give inf */
+    }
+
+    return uint16_t(ret | (sign >> 16));
+}
+
+always_inline float bf16_to_float(uint16_t arg)
+{
+    return bits_float(uint32_t(arg) << 16);
+}
+
+inline uint16_t float_to_bf16(float arg)
+{
+    const uint32_t bits = float_bits(arg);
+    if ((bits & 0x7fffffff) > 0x7f800000)
+        return uint16_t((bits >> 16) | 0x40);
+
+    const uint32_t mantissa_odd = (bits >> 16) & 1;
+    return uint16_t((bits + 0x7fff + mantissa_odd) >> 16);
+}
+
+/* storage formats of the half precision argument wrappers */
+struct fp16_format
+{
+    static always_inline float to_float(uint16_t arg)
+    {
+        return fp16_to_float(arg);
+    }
+
+    template <typename VecType>
+    static always_inline void load(VecType & ret, const uint16_t * src)
+    {
+        ret.load_fp16(src);
+    }
+};
+
+struct bf16_format
+{
+    static always_inline float to_float(uint16_t arg)
+    {
+        return bf16_to_float(arg);
+    }
+
+    template <typename VecType>
+    static always_inline void load(VecType & ret, const uint16_t * src)
+    {
+        ret.load_bf16(src);
+    }
+};
+
+}
+}
+
+#undef always_inline
+
+#endif /* NOVA_SIMD_DETAIL_HALF_FLOAT_HPP */
@@ -27,6 +27,16 @@
 
 namespace nova {
 
+/* accuracy tiers of the math functions: fast trades accuracy for speed, precise keeps the error below
+ * 1 ulp. the standard tier is used by default */
+namespace accuracy {
+
+struct fast {};
+struct standard {};
+struct precise {};
+
+}
+
 namespace detail {
 
 ///@{
@@ -172,6 +182,7 @@ inline float_type NAME(float_type const & x)    \
 }
 
 DEFINE_STD_UNARY_WRAPPER(fabs)
+DEFINE_STD_UNARY_WRAPPER(sqrt)
 DEFINE_STD_UNARY_WRAPPER(floor)
 DEFINE_STD_UNARY_WRAPPER(ceil)
 
@@ -183,6 +194,8 @@ DEFINE_STD_UNARY_WRAPPER(acos)
 DEFINE_STD_UNARY_WRAPPER(atan)
 
 DEFINE_STD_UNARY_WRAPPER(tanh)
+DEFINE_STD_UNARY_WRAPPER(sinh)
+DEFINE_STD_UNARY_WRAPPER(cosh)
 
 DEFINE_STD_UNARY_WRAPPER(log)
 DEFINE_STD_UNARY_WRAPPER(log10)
@@ -197,6 +210,13 @@ inline float_type NAME(float_type const & lhs, float_type const & rhs)  \
 }
 
 DEFINE_STD_BINARY_WRAPPER(pow)
+DEFINE_STD_BINARY_WRAPPER(atan2)
+
+template <typename float_type>
+inline float_type hypot(float_type const & x, float_type const & y)
+{
+    return std::hypot(x, y);
+}
 
 template<typename float_type>
 inline float_type sign(float_type const & f)
@@ -221,6 +241,29 @@ inline float_type cube(float_type const & f)
     return f*f*f;
 }
 
+/* fused multiply-add, if the hardware provides it. otherwise std::fma would be emulated in software */
+template<typename float_type>
+inline float_type madd(float_type const & arg1, float_type const & arg2, float_type const & arg3)
+{
+    return arg1 * arg2 + arg3;
+}
+
+#ifdef FP_FAST_FMAF
+template<>
+inline float madd<float>(float const & arg1, float const & arg2, float const & arg3)
+{
+    return std::fma(arg1, arg2, arg3);
+}
+#endif
+
+#ifdef FP_FAST_FMA
+template<>
+inline double madd<double>(double const & arg1, double const & arg2, double const & arg3)
+{
+    return std::fma(arg1, arg2, arg3);
+}
+#endif
+
 
 template<typename float_type>
 inline float_type min(float_type const & x, float_type const & y)
@@ -265,31 +308,74 @@ inline float_type frac(float_type const & arg)
 template <typename float_type>
 inline float_type log2(float_type arg)
 {
-#if __cplusplus >= 201103L
     return std::log2(arg);
-#else
-    const float rlog2 = 1.f/std::log(2.f);
-    return std::log(arg) * rlog2;
-#endif
 }
 
-#if !(__cplusplus >= 201103L) // C++11
+template <typename float_type>
+inline float_type exp2(float_type arg)
+{
+    return std::exp2(arg);
+}
 
-#if __STDC_VERSION__ >= 199901L // C99
-template <>
-inline float log2(float arg)
+template <typename float_type>
+inline float_type rsqrt(float_type arg)
 {
-    return ::log2f(arg);
+    return float_type(1) / std::sqrt(arg);
 }
 
-template <>
-inline double log2(double arg)
+template <typename float_type>
+inline float_type fast_rsqrt(float_type arg)
 {
-    return ::log2(arg);
+    return rsqrt(arg);
 }
-#endif
 
-#endif
+template <typename float_type>
+inline float_type cbrt(float_type arg)
+{
+    return std::cbrt(arg);
+}
+
+template <typename float_type>
+inline float_type expm1(float_type arg)
+{
+    return std::expm1(arg);
+}
+
+template <typename float_type>
+inline float_type log1p(float_type arg)
+{
+    return std::log1p(arg);
+}
+
+template <typename float_type>
+inline float_type asinh(float_type arg)
+{
+    return std::asinh(arg);
+}
+
+template <typename float_type>
+inline float_type acosh(float_type arg)
+{
+    return std::acosh(arg);
+}
+
+template <typename float_type>
+inline float_type atanh(float_type arg)
+{
+    return std::atanh(arg);
+}
+
+template <typename float_type>
+inline float_type erf(float_type arg)
+{
+    return std::erf(arg);
+}
+
+template <typename float_type>
+inline float_type erfc(float_type arg)
+{
+    return std::erfc(arg);
+}
 
 template<typename float_type>
 inline float_type trunc(float_type const & arg)
@@ -339,6 +425,35 @@ inline float_type reciprocal(float_type in)
     return float_type(1) / in;
 }
 
+}
+
+namespace accuracy {
+
+/* the scalar functions use the c library for all tiers, vec classes overload the fast and precise
+ * tiers. the fallbacks are found by argument-dependent lookup of the tag */
+#define DEFINE_ACCURACY_UNARY_WRAPPER(NAME)                         \
+template<typename float_type, typename Accuracy>                    \
+inline float_type NAME(float_type const & x, Accuracy)              \
+{                                                                   \
+    using detail::NAME;                                             \
+    return NAME(x);                                                 \
+}
+
+DEFINE_ACCURACY_UNARY_WRAPPER(sin)
+DEFINE_ACCURACY_UNARY_WRAPPER(cos)
+DEFINE_ACCURACY_UNARY_WRAPPER(tanh)
+DEFINE_ACCURACY_UNARY_WRAPPER(log)
+DEFINE_ACCURACY_UNARY_WRAPPER(exp)
+
+#undef DEFINE_ACCURACY_UNARY_WRAPPER
+
+template<typename float_type, typename Accuracy>
+inline float_type pow(float_type const & lhs, float_type const & rhs, Accuracy)
+{
+    using detail::pow;
+    return pow(lhs, rhs);
+}
+
 }
 }
 
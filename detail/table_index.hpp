@@ -0,0 +1,112 @@
+//  integer indices of vector lanes
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef NOVA_SIMD_DETAIL_TABLE_INDEX_HPP
+#define NOVA_SIMD_DETAIL_TABLE_INDEX_HPP
+
+/* table_index<VecType> is the int_vec of VecType, or lane_indices for backends without int_vec. it is
+ * used to read vectors from per-lane offsets of a float array with vec::gather */
+
+namespace nova {
+namespace detail {
+
+/* indices of the lanes for backends without int_vec (the generic backend), the table is read lane by
+ * lane with vec::gather */
+template <typename VecType>
+struct lane_indices
+{
+    static const int size = VecType::size;
+
+    lane_indices(int index)
+    {
+        for (int i = 0; i != size; ++i)
+            data[i] = index;
+    }
+
+    lane_indices operator+(lane_indices const & rhs) const
+    {
+        lane_indices ret(*this);
+        for (int i = 0; i != size; ++i)
+            ret.data[i] += rhs.data[i];
+        return ret;
+    }
+
+    lane_indices operator&(lane_indices const & rhs) const
+    {
+        lane_indices ret(*this);
+        for (int i = 0; i != size; ++i)
+            ret.data[i] &= rhs.data[i];
+        return ret;
+    }
+
+    VecType convert_to_float(void) const
+    {
+        VecType ret;
+        for (int i = 0; i != size; ++i)
+            ret.set(i, typename VecType::float_type(data[i]));
+        return ret;
+    }
+
+    int data[size];
+};
+
+template <typename T>
+struct void_type
+{
+    typedef void type;
+};
+
+template <typename VecType, typename Enable = void>
+struct table_index
+{
+    typedef lane_indices<VecType> type;
+
+    static type truncate(VecType const & phase)
+    {
+        type ret(0);
+        for (int i = 0; i != VecType::size; ++i)
+            ret.data[i] = int(phase.get(i));
+        return ret;
+    }
+
+    static VecType gather(const typename VecType::float_type * table, type const & index)
+    {
+        return VecType::gather(table, index.data);
+    }
+};
+
+template <typename VecType>
+struct table_index<VecType, typename void_type<typename VecType::int_vec>::type>
+{
+    typedef typename VecType::int_vec type;
+
+    static type truncate(VecType const & phase)
+    {
+        return phase.truncate_to_int();
+    }
+
+    static VecType gather(const typename VecType::float_type * table, type const & index)
+    {
+        return VecType::gather(table, index);
+    }
+};
+
+}
+}
+
+#endif /* NOVA_SIMD_DETAIL_TABLE_INDEX_HPP */
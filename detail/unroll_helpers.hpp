@@ -19,7 +19,12 @@
 #ifndef NOVA_SIMD_DETAIL_UNROLL_HELPERS_HPP
 #define NOVA_SIMD_DETAIL_UNROLL_HELPERS_HPP
 
+#include <algorithm>
+#include <cstddef>
+
 #include "../vec.hpp"
+#include "../simd_unroll_constraints.hpp"
+#include "wrap_argument_vector.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -30,8 +35,13 @@
 namespace nova {
 namespace detail {
 
+/* stream: use non-temporal stores, requires aligned
+ * prefetch_distance: prefetch the input buffers this many bytes ahead, once per cache line */
 template <typename FloatType,
-          int N
+          int N,
+          bool aligned = true,
+          bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE
          >
 struct compile_time_unroller
 {
@@ -44,7 +54,7 @@ struct compile_time_unroller
              >
     static always_inline void run(FloatType * out, arg1_type & in1, Functor const & f)
     {
-        compile_time_unroller<FloatType, N>::mp_iteration_1(out, in1.consume(), in1, f);
+        compile_time_unroller<FloatType, N, aligned, stream, prefetch_distance>::mp_iteration_1(out, in1.consume(), in1, f);
     }
 
     template <typename arg1_type,
@@ -53,7 +63,7 @@ struct compile_time_unroller
              >
     static always_inline void run(FloatType * out, arg1_type & in1, arg2_type & in2, Functor const & f)
     {
-        compile_time_unroller<FloatType, N>::mp_iteration_2(out, in1.consume(), in1, in2.consume(), in2, f);
+        compile_time_unroller<FloatType, N, aligned, stream, prefetch_distance>::mp_iteration_2(out, in1.consume(), in1, in2.consume(), in2, f);
     }
 
     template <typename arg1_type,
@@ -64,7 +74,7 @@ struct compile_time_unroller
     static always_inline void run(FloatType * out, arg1_type & in1, arg2_type & in2,
                                   arg3_type & in3, Functor const & f)
     {
-        compile_time_unroller<FloatType, N>::mp_iteration_3(out, in1.consume(), in1, in2.consume(), in2, in3.consume(), in3, f);
+        compile_time_unroller<FloatType, N, aligned, stream, prefetch_distance>::mp_iteration_3(out, in1.consume(), in1, in2.consume(), in2, in3.consume(), in3, f);
     }
 
     template <typename arg1_type,
@@ -76,25 +86,40 @@ struct compile_time_unroller
     static always_inline void run(FloatType * out, arg1_type & in1, arg2_type & in2,
                                   arg3_type & in3, arg4_type & in4, Functor const & f)
     {
-        compile_time_unroller<FloatType, N>::mp_iteration_4(out, in1.consume(), in1, in2.consume(), in2,
+        compile_time_unroller<FloatType, N, aligned, stream, prefetch_distance>::mp_iteration_4(out, in1.consume(), in1, in2.consume(), in2,
                                                             in3.consume(), in3, in4.consume(), in4, f);
     }
 
 private:
-    friend struct compile_time_unroller<FloatType, vec_type::size + N>;
+    friend struct compile_time_unroller<FloatType, vec_type::size + N, aligned, stream, prefetch_distance>;
+
+    static const bool cacheline_start = N % vec_type::objects_per_cacheline == 0;
+
+    static always_inline void store(vec_type const & result, FloatType * out)
+    {
+        if (stream)
+            result.store_aligned_stream(out);
+        else if (aligned)
+            result.store_aligned(out);
+        else
+            result.store(out);
+    }
 
     template <typename arg1_type,
               typename Functor
              >
     static always_inline void mp_iteration_1(FloatType * out, vec_type loaded_in1, arg1_type & in1, Functor const & f)
     {
+        if (prefetch_distance && cacheline_start)
+            in1.prefetch(prefetch_distance);
+
         vec_type loaded_next_in1;
         if (N != offset)
             loaded_next_in1 = in1.consume();
 
         vec_type result = f(loaded_in1);
-        result.store_aligned(out);
-        compile_time_unroller<FloatType, N-offset>::mp_iteration_1(out+offset, loaded_next_in1, in1, f);
+        store(result, out);
+        compile_time_unroller<FloatType, N-offset, aligned, stream, prefetch_distance>::mp_iteration_1(out+offset, loaded_next_in1, in1, f);
     }
 
     template <typename arg1_type,
@@ -104,6 +129,11 @@ private:
     static always_inline void mp_iteration_2(FloatType * out, vec_type loaded_in1, arg1_type & in1,
                                              vec_type loaded_in2, arg2_type & in2, Functor const & f)
     {
+        if (prefetch_distance && cacheline_start) {
+            in1.prefetch(prefetch_distance);
+            in2.prefetch(prefetch_distance);
+        }
+
         vec_type loaded_next_in1;
         if (N != offset)
             loaded_next_in1 = in1.consume();
@@ -113,8 +143,8 @@ private:
             loaded_next_in2 = in2.consume();
 
         vec_type result = f(loaded_in1, loaded_in2);
-        result.store_aligned(out);
-        compile_time_unroller<FloatType, N-offset>::mp_iteration_2(out+offset, loaded_next_in1, in1, loaded_next_in2, in2, f);
+        store(result, out);
+        compile_time_unroller<FloatType, N-offset, aligned, stream, prefetch_distance>::mp_iteration_2(out+offset, loaded_next_in1, in1, loaded_next_in2, in2, f);
     }
 
     template <typename arg1_type,
@@ -126,6 +156,12 @@ private:
                                              vec_type loaded_in2, arg2_type & in2,
                                              vec_type loaded_in3, arg3_type & in3, Functor const & f)
     {
+        if (prefetch_distance && cacheline_start) {
+            in1.prefetch(prefetch_distance);
+            in2.prefetch(prefetch_distance);
+            in3.prefetch(prefetch_distance);
+        }
+
         vec_type loaded_next_in1;
         if (N != offset)
             loaded_next_in1 = in1.consume();
@@ -139,8 +175,8 @@ private:
             loaded_next_in3 = in3.consume();
 
         vec_type result = f(loaded_in1, loaded_in2, loaded_in3);
-        result.store_aligned(out);
-        compile_time_unroller<FloatType, N-offset>::mp_iteration_3(out+offset, loaded_next_in1, in1, loaded_next_in2, in2,
+        store(result, out);
+        compile_time_unroller<FloatType, N-offset, aligned, stream, prefetch_distance>::mp_iteration_3(out+offset, loaded_next_in1, in1, loaded_next_in2, in2,
                                                                    loaded_next_in3, in3, f);
     }
 
@@ -153,6 +189,13 @@ private:
     static always_inline void mp_iteration_4(FloatType * out, vec_type loaded_in1, arg1_type & in1, vec_type loaded_in2, arg2_type & in2,
                                              vec_type loaded_in3, arg3_type & in3, vec_type loaded_in4, arg4_type & in4, Functor const & f)
     {
+        if (prefetch_distance && cacheline_start) {
+            in1.prefetch(prefetch_distance);
+            in2.prefetch(prefetch_distance);
+            in3.prefetch(prefetch_distance);
+            in4.prefetch(prefetch_distance);
+        }
+
         vec_type loaded_next_in1;
         if (N != offset)
             loaded_next_in1 = in1.consume();
@@ -170,17 +213,17 @@ private:
             loaded_next_in4 = in4.consume();
 
         vec_type result = f(loaded_in1, loaded_in2, loaded_in3, loaded_in4);
-        result.store_aligned(out);
+        store(result, out);
 
-        compile_time_unroller<FloatType, N-offset>::mp_iteration_4(out+offset, loaded_next_in1, in1, loaded_next_in2, in2,
+        compile_time_unroller<FloatType, N-offset, aligned, stream, prefetch_distance>::mp_iteration_4(out+offset, loaded_next_in1, in1, loaded_next_in2, in2,
                                                                    loaded_next_in3, in3, loaded_next_in4, in4, f);
     }
 };
 
-template <typename FloatType>
-struct compile_time_unroller<FloatType, 0>
+template <typename FloatType, bool aligned, bool stream, unsigned int prefetch_distance>
+struct compile_time_unroller<FloatType, 0, aligned, stream, prefetch_distance>
 {
-    friend struct compile_time_unroller<FloatType, vec<FloatType>::size>;
+    friend struct compile_time_unroller<FloatType, vec<FloatType>::size, aligned, stream, prefetch_distance>;
 
 private:
     template <typename LoadedArg1, typename Arg1,
@@ -220,7 +263,10 @@ private:
 };
 
 
-template <typename float_type,
+template <bool aligned = true,
+          bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE,
+          typename float_type,
           typename Arg1,
           typename Functor
          >
@@ -229,12 +275,15 @@ always_inline void generate_simd_loop(float_type * out, Arg1 arg1, unsigned int
     const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
     n /= per_loop;
     do {
-        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, f);
+        detail::compile_time_unroller<float_type, per_loop, aligned, stream, prefetch_distance>::run(out, arg1, f);
         out += per_loop;
     } while (--n);
 }
 
-template <typename float_type,
+template <bool aligned = true,
+          bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE,
+          typename float_type,
           typename Arg1,
           typename Arg2,
           typename Functor
@@ -244,12 +293,15 @@ always_inline void generate_simd_loop(float_type * out, Arg1 arg1, Arg2 arg2, un
     const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
     n /= per_loop;
     do {
-        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, f);
+        detail::compile_time_unroller<float_type, per_loop, aligned, stream, prefetch_distance>::run(out, arg1, arg2, f);
         out += per_loop;
     } while (--n);
 }
 
-template <typename float_type,
+template <bool aligned = true,
+          bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE,
+          typename float_type,
           typename Arg1,
           typename Arg2,
           typename Arg3,
@@ -260,12 +312,15 @@ always_inline void generate_simd_loop(float_type * out, Arg1 arg1, Arg2 arg2, Ar
     const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
     n /= per_loop;
     do {
-        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, arg3, f);
+        detail::compile_time_unroller<float_type, per_loop, aligned, stream, prefetch_distance>::run(out, arg1, arg2, arg3, f);
         out += per_loop;
     } while (--n);
 }
 
-template <typename float_type,
+template <bool aligned = true,
+          bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE,
+          typename float_type,
           typename Arg1,
           typename Arg2,
           typename Arg3,
@@ -277,11 +332,281 @@ always_inline void generate_simd_loop(float_type * out, Arg1 arg1, Arg2 arg2, Ar
     const unsigned int per_loop = vec<float_type>::objects_per_cacheline;
     n /= per_loop;
     do {
-        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, arg3, arg4, f);
+        detail::compile_time_unroller<float_type, per_loop, aligned, stream, prefetch_distance>::run(out, arg1, arg2, arg3, arg4, f);
         out += per_loop;
     } while (--n);
 }
 
+/* non-temporal stores for large buffers, see NOVA_SIMD_STREAM_THRESHOLD. the stores are followed by a fence,
+ * so the output can be read by other threads */
+template <typename float_type,
+          typename Arg1,
+          typename Functor
+         >
+always_inline void generate_simd_loop_stream(float_type * out, Arg1 arg1, unsigned int n, Functor const & f)
+{
+    if (use_stream_stores<float_type>(n)) {
+        generate_simd_loop<true, true>(out, arg1, n, f);
+        vec<float_type>::stream_fence();
+    } else
+        generate_simd_loop(out, arg1, n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Functor
+         >
+always_inline void generate_simd_loop_stream(float_type * out, Arg1 arg1, Arg2 arg2, unsigned int n, Functor const & f)
+{
+    if (use_stream_stores<float_type>(n)) {
+        generate_simd_loop<true, true>(out, arg1, arg2, n, f);
+        vec<float_type>::stream_fence();
+    } else
+        generate_simd_loop(out, arg1, arg2, n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Functor
+         >
+always_inline void generate_simd_loop_stream(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n,
+                                             Functor const & f)
+{
+    if (use_stream_stores<float_type>(n)) {
+        generate_simd_loop<true, true>(out, arg1, arg2, arg3, n, f);
+        vec<float_type>::stream_fence();
+    } else
+        generate_simd_loop(out, arg1, arg2, arg3, n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Arg4,
+          typename Functor
+         >
+always_inline void generate_simd_loop_stream(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n,
+                                             Functor const & f)
+{
+    if (use_stream_stores<float_type>(n)) {
+        generate_simd_loop<true, true>(out, arg1, arg2, arg3, arg4, n, f);
+        vec<float_type>::stream_fence();
+    } else
+        generate_simd_loop(out, arg1, arg2, arg3, arg4, n, f);
+}
+
+/* arbitrary number of samples and arbitrary alignment: a partial vector is computed until the output is
+ * aligned, followed by the unrolled loop, single vectors and a partial vector for the remaining samples.
+ * partial vectors operate on a copy of the samples, so they neither read nor write outside of the buffers
+ * and in-place operation is safe. if any of the input buffers is not aligned after peeling, all loads are
+ * unaligned, while all stores are aligned.
+ */
+template <typename float_type>
+always_inline void store_tail(vec<float_type> const & result, float_type * out, unsigned int count)
+{
+    float_type buffer[vec<float_type>::size];
+    result.store(buffer);
+    for (unsigned int i = 0; i != count; ++i)
+        out[i] = buffer[i];
+}
+
+template <typename float_type>
+always_inline unsigned int samples_until_aligned(const float_type * out, unsigned int n)
+{
+    const unsigned int size = vec<float_type>::size;
+    const unsigned int misalignment = (unsigned int)((std::size_t)out / sizeof(float_type)) % size;
+    const unsigned int count = misalignment ? size - misalignment : 0;
+    return std::min(count, n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any_(float_type * out, Arg1 arg1, unsigned int n, Functor const & f)
+{
+    typedef vec<float_type> vec_type;
+    const unsigned int per_loop = vec_type::objects_per_cacheline;
+
+    for (unsigned int loops = n / per_loop; loops; --loops) {
+        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, f);
+        out += per_loop;
+    }
+
+    for (n = n % per_loop; n >= vec_type::size; n -= vec_type::size) {
+        detail::compile_time_unroller<float_type, vec_type::size>::run(out, arg1, f);
+        out += vec_type::size;
+    }
+
+    if (n)
+        store_tail(f(arg1.consume_tail(n)), out, n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any(float_type * out, Arg1 arg1, unsigned int n, Functor const & f)
+{
+    const unsigned int peel = samples_until_aligned(out, n);
+    if (peel) {
+        store_tail(f(arg1.consume_tail(peel)), out, peel);
+        out += peel;
+        n -= peel;
+    }
+
+    if (arg1.is_aligned())
+        generate_simd_loop_any_(out, arg1, n, f);
+    else
+        generate_simd_loop_any_(out, unaligned_vector_arg(arg1), n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any_(float_type * out, Arg1 arg1, Arg2 arg2, unsigned int n, Functor const & f)
+{
+    typedef vec<float_type> vec_type;
+    const unsigned int per_loop = vec_type::objects_per_cacheline;
+
+    for (unsigned int loops = n / per_loop; loops; --loops) {
+        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, f);
+        out += per_loop;
+    }
+
+    for (n = n % per_loop; n >= vec_type::size; n -= vec_type::size) {
+        detail::compile_time_unroller<float_type, vec_type::size>::run(out, arg1, arg2, f);
+        out += vec_type::size;
+    }
+
+    if (n)
+        store_tail(f(arg1.consume_tail(n), arg2.consume_tail(n)), out, n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any(float_type * out, Arg1 arg1, Arg2 arg2, unsigned int n, Functor const & f)
+{
+    const unsigned int peel = samples_until_aligned(out, n);
+    if (peel) {
+        store_tail(f(arg1.consume_tail(peel), arg2.consume_tail(peel)), out, peel);
+        out += peel;
+        n -= peel;
+    }
+
+    if (arg1.is_aligned() && arg2.is_aligned())
+        generate_simd_loop_any_(out, arg1, arg2, n, f);
+    else
+        generate_simd_loop_any_(out, unaligned_vector_arg(arg1), unaligned_vector_arg(arg2), n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any_(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n, Functor const & f)
+{
+    typedef vec<float_type> vec_type;
+    const unsigned int per_loop = vec_type::objects_per_cacheline;
+
+    for (unsigned int loops = n / per_loop; loops; --loops) {
+        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, arg3, f);
+        out += per_loop;
+    }
+
+    for (n = n % per_loop; n >= vec_type::size; n -= vec_type::size) {
+        detail::compile_time_unroller<float_type, vec_type::size>::run(out, arg1, arg2, arg3, f);
+        out += vec_type::size;
+    }
+
+    if (n)
+        store_tail(f(arg1.consume_tail(n), arg2.consume_tail(n), arg3.consume_tail(n)), out, n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, unsigned int n, Functor const & f)
+{
+    const unsigned int peel = samples_until_aligned(out, n);
+    if (peel) {
+        store_tail(f(arg1.consume_tail(peel), arg2.consume_tail(peel), arg3.consume_tail(peel)), out, peel);
+        out += peel;
+        n -= peel;
+    }
+
+    if (arg1.is_aligned() && arg2.is_aligned() && arg3.is_aligned())
+        generate_simd_loop_any_(out, arg1, arg2, arg3, n, f);
+    else
+        generate_simd_loop_any_(out, unaligned_vector_arg(arg1), unaligned_vector_arg(arg2),
+                                unaligned_vector_arg(arg3), n, f);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Arg4,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any_(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n, Functor const & f)
+{
+    typedef vec<float_type> vec_type;
+    const unsigned int per_loop = vec_type::objects_per_cacheline;
+
+    for (unsigned int loops = n / per_loop; loops; --loops) {
+        detail::compile_time_unroller<float_type, per_loop>::run(out, arg1, arg2, arg3, arg4, f);
+        out += per_loop;
+    }
+
+    for (n = n % per_loop; n >= vec_type::size; n -= vec_type::size) {
+        detail::compile_time_unroller<float_type, vec_type::size>::run(out, arg1, arg2, arg3, arg4, f);
+        out += vec_type::size;
+    }
+
+    if (n)
+        store_tail(f(arg1.consume_tail(n), arg2.consume_tail(n),
+                     arg3.consume_tail(n), arg4.consume_tail(n)), out, n);
+}
+
+template <typename float_type,
+          typename Arg1,
+          typename Arg2,
+          typename Arg3,
+          typename Arg4,
+          typename Functor
+         >
+always_inline void generate_simd_loop_any(float_type * out, Arg1 arg1, Arg2 arg2, Arg3 arg3, Arg4 arg4, unsigned int n, Functor const & f)
+{
+    const unsigned int peel = samples_until_aligned(out, n);
+    if (peel) {
+        store_tail(f(arg1.consume_tail(peel), arg2.consume_tail(peel),
+                     arg3.consume_tail(peel), arg4.consume_tail(peel)), out, peel);
+        out += peel;
+        n -= peel;
+    }
+
+    if (arg1.is_aligned() && arg2.is_aligned() && arg3.is_aligned() && arg4.is_aligned())
+        generate_simd_loop_any_(out, arg1, arg2, arg3, arg4, n, f);
+    else
+        generate_simd_loop_any_(out, unaligned_vector_arg(arg1), unaligned_vector_arg(arg2),
+                                unaligned_vector_arg(arg3), unaligned_vector_arg(arg4), n, f);
+}
+
 }
 }
 
@@ -21,6 +21,8 @@
 
 #include <cmath>
 
+#include "../simd_polynomial.hpp"
+
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
 #else
@@ -61,7 +63,9 @@ always_inline VecType vec_round_float(VecType const & arg)
     const vec two_to_23_ps (0x1.0p23f);
     const vec rounded = (abs_arg + two_to_23_ps) - two_to_23_ps;
 
-    return sign ^ rounded;
+    /* larger values are integers already, adding 2**23 would round them to a coarser grid */
+    const vec is_integer = mask_ge(abs_arg, two_to_23_ps);
+    return sign ^ select(rounded, abs_arg, is_integer);
 }
 
 template <typename VecType>
@@ -88,6 +92,45 @@ always_inline VecType vec_ceil_float(VecType const & arg)
     return rounded + add;
 }
 
+template <typename VecType>
+always_inline VecType vec_round_double(VecType const & arg)
+{
+    typedef VecType vec;
+
+    const vec sign    = arg & vec::gen_sign_mask();
+    const vec abs_arg = sign ^ arg;
+    const vec two_to_52_pd (0x1.0p52);
+    const vec rounded = (abs_arg + two_to_52_pd) - two_to_52_pd;
+
+    /* larger values are integers already, adding 2**52 would round them to a coarser grid */
+    const vec is_integer = mask_ge(abs_arg, two_to_52_pd);
+    return sign ^ select(rounded, abs_arg, is_integer);
+}
+
+template <typename VecType>
+always_inline VecType vec_floor_double(VecType const & arg)
+{
+    typedef VecType vec;
+
+    const vec rounded = vec_round_double(arg);
+
+    const vec rounded_larger = mask_gt(rounded, arg);
+    const vec add            = rounded_larger & vec::gen_one();
+    return rounded - add;
+}
+
+template <typename VecType>
+always_inline VecType vec_ceil_double(VecType const & arg)
+{
+    typedef VecType vec;
+
+    const vec rounded = vec_round_double(arg);
+
+    const vec rounded_smaller = mask_lt(rounded, arg);
+    const vec add             = rounded_smaller & vec::gen_one();
+    return rounded + add;
+}
+
 template <typename VecFloat>
 always_inline VecFloat ldexp_float(VecFloat const & x, typename VecFloat::int_vec const & n)
 {
@@ -118,6 +161,90 @@ always_inline VecFloat frexp_float(VecFloat const & x, typename VecFloat::int_ve
     return x_wo_x | VecFloat::gen_exp_mask_1();
 }
 
+template <typename VecDouble>
+always_inline VecDouble ldexp_double(VecDouble const & x, typename VecDouble::int_vec const & n)
+{
+    typedef typename VecDouble::int_vec int_vec;
+
+    const VecDouble exponent_mask = VecDouble::gen_exp_mask();
+    const VecDouble exponent = exponent_mask & x;
+    const VecDouble x_wo_x = andnot(exponent_mask, x);     // clear exponent
+
+    int_vec new_exp = slli(n, 52) + int_vec(exponent);     // new exponent
+    VecDouble new_exp_double(new_exp);
+    VecDouble ret = x_wo_x | new_exp_double;
+    return ret;
+}
+
+template <typename VecDouble>
+always_inline VecDouble frexp_double(VecDouble const & x, typename VecDouble::int_vec & exp)
+{
+    typedef typename VecDouble::int_vec int_vec;
+
+    const VecDouble exponent_mask = VecDouble::gen_exp_mask();
+    const VecDouble exponent = exponent_mask & x;
+    const VecDouble x_wo_x = andnot(exponent_mask, x);     // clear exponent
+
+    const int_vec exp_int(exponent);
+
+    exp = srli(exp_int, 52) - int_vec(1022);
+    return x_wo_x | VecDouble::gen_exp_mask_1();
+}
+
+/* layout of the floating point types, used by the kernels, which are shared by float and double */
+template <typename FloatType>
+struct ieee_traits;
+
+template <>
+struct ieee_traits<float>
+{
+    static const int mantissa_bits = 23;
+    static const int exponent_bias = 127;
+    static const int sign_shift    = 31;
+
+    template <typename VecType>
+    static always_inline VecType frexp(VecType const & x, typename VecType::int_vec & exp)
+    {
+        return frexp_float(x, exp);
+    }
+};
+
+template <>
+struct ieee_traits<double>
+{
+    static const int mantissa_bits = 52;
+    static const int exponent_bias = 1023;
+    static const int sign_shift    = 63;
+
+    template <typename VecType>
+    static always_inline VecType frexp(VecType const & x, typename VecType::int_vec & exp)
+    {
+        return frexp_double(x, exp);
+    }
+};
+
+/* 2**n for integer n in the range of normalized exponents */
+template <typename VecType>
+always_inline VecType vec_pow2i(typename VecType::int_vec const & n)
+{
+    typedef typename VecType::int_vec int_vec;
+    typedef ieee_traits<typename VecType::float_type> traits;
+
+    return VecType(slli(n + int_vec(traits::exponent_bias), traits::mantissa_bits));
+}
+
+/* p * 2**n, the scale factor is split into two normalized powers of two, so results underflow
+ * gradually and overflow to infinity */
+template <typename VecType>
+always_inline VecType vec_scale_pow2(VecType const & p, VecType const & n)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType n1 = round(n * VecType(float_type(0.5)));
+    const VecType n2 = n - n1;
+    return (p * vec_pow2i<VecType>(n1.truncate_to_int())) * vec_pow2i<VecType>(n2.truncate_to_int());
+}
+
 /* adapted from cephes, approximation polynomial generated by sollya */
 template <typename VecType>
 always_inline VecType vec_exp_float(VecType const & arg)
@@ -133,17 +260,16 @@ always_inline VecType vec_exp_float(VecType const & arg)
     VecType x = arg;
     VecType z = round(VecType(1.44269504088896341f) * x);
     int_vec n = z.truncate_to_int();
-    x -= z*VecType(0.693359375f);
-    x -= z*VecType(-2.12194440e-4f);
+    x = madd(z, VecType(-0.693359375f), x);
+    x = madd(z, VecType(2.12194440e-4f), x);
 
     /* Theoretical peak relative error in [-0.5, +0.5] is 3.5e-8. */
-    VecType p = VecType(VecType::gen_one()) +
-        x * (1.00000035762786865234375f +
-        x * (0.4999996721744537353515625f +
-        x * (0.16665561497211456298828125f +
-        x * (4.167006909847259521484375e-2f +
-        x * (8.420792408287525177001953125e-3f +
-        x * 1.386119984090328216552734375e-3f)))));
+    VecType p = madd(x, VecType(1.386119984090328216552734375e-3f), VecType(8.420792408287525177001953125e-3f));
+    p = madd(p, x, VecType(4.167006909847259521484375e-2f));
+    p = madd(p, x, VecType(0.16665561497211456298828125f));
+    p = madd(p, x, VecType(0.4999996721744537353515625f));
+    p = madd(p, x, VecType(1.00000035762786865234375f));
+    p = madd(p, x, VecType(VecType::gen_one()));
 
     /* multiply by power of 2 */
     VecType approx = ldexp_float(p, n);
@@ -163,6 +289,49 @@ always_inline VecType vec_exp_float(VecType const & arg)
     return ret;
 }
 
+/* 2**x = 2**n 2**f, |f| <= 0.5. no reduction by log(2) is needed, the scaling is split into two
+ * factors, so that results underflow gradually and overflow to infinity */
+template <typename VecType>
+always_inline VecType vec_exp2_float(VecType const & arg)
+{
+    const VecType x = max_(min_(arg, VecType(129.f)), VecType(-151.f));
+    const VecType n = round(x);
+    const VecType f = x - n;
+
+    /* cephes exp2f, relative error of 1.7e-8 */
+    VecType p = madd(f, VecType(1.535336188319500E-004f), VecType(1.339887440266574E-003f));
+    p = madd(p, f, VecType(9.618437357674640E-003f));
+    p = madd(p, f, VecType(5.550332471162809E-002f));
+    p = madd(p, f, VecType(2.402264791363012E-001f));
+    p = madd(p, f, VecType(6.931472028550421E-001f));
+    p = madd(p, f, VecType(VecType::gen_one()));
+
+    return vec_scale_pow2(p, n);
+}
+
+/* exp(x) - 1. taylor series for |x| <= log(2), the truncation error is below 1e-9. for larger
+ * arguments exp(x) - 1 loses at most one bit. vec_exp_float clamps its result to the largest
+ * finite number, so large arguments use exp(x/2)**2, which overflows to infinity */
+struct expm1_float_coefficients
+{
+    static constexpr double coefficients[] = { 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040, 1.0/40320,
+                                               1.0/362880, 1.0/3628800 };
+};
+
+template <typename VecType>
+always_inline VecType vec_expm1_float(VecType const & arg)
+{
+    const VecType small = madd(estrin<expm1_float_coefficients>(arg), arg * arg, arg);
+
+    const VecType large = vec_exp_float(arg) - VecType(VecType::gen_one());
+    const VecType half_exp = vec_exp_float(arg * VecType(0.5f));
+
+    VecType result = select(large, small, mask_le(abs(arg), VecType(0.693147180559945309f)));
+    result = select(result, half_exp * half_exp, mask_gt(arg, VecType(88.f)));
+    result = select(result, arg, mask_eq(arg, VecType::gen_zero())); // -0
+    return select(result, arg, mask_neq(arg, arg));
+}
+
 /* adapted from cephes */
 template <typename VecType>
 always_inline VecType vec_log_float(VecType x)
@@ -179,24 +348,55 @@ always_inline VecType vec_log_float(VecType x)
     x_add = x_add & x_smaller_sqrt_05;
     x += x_add - VecType(VecType::gen_one());
 
-    VecType y =
-    (((((((( 7.0376836292E-2 * x
-    - 1.1514610310E-1) * x
-    + 1.1676998740E-1) * x
-    - 1.2420140846E-1) * x
-    + 1.4249322787E-1) * x
-    - 1.6668057665E-1) * x
-    + 2.0000714765E-1) * x
-    - 2.4999993993E-1) * x
-    + 3.3333331174E-1) * x * x*x;
+    const VecType xx = x * x;
+    VecType y = madd(x, VecType(7.0376836292E-2f), VecType(-1.1514610310E-1f));
+    y = madd(y, x, VecType(1.1676998740E-1f));
+    y = madd(y, x, VecType(-1.2420140846E-1f));
+    y = madd(y, x, VecType(1.4249322787E-1f));
+    y = madd(y, x, VecType(-1.6668057665E-1f));
+    y = madd(y, x, VecType(2.0000714765E-1f));
+    y = madd(y, x, VecType(-2.4999993993E-1f));
+    y = madd(y, x, VecType(3.3333331174E-1f));
+    y = y * x * xx;
 
     VecType fe = e.convert_to_float();
-    y += fe * -2.12194440e-4;
+    y = madd(fe, VecType(-2.12194440e-4f), y);
+
+    y = madd(xx, VecType(-0.5f), y);   /* y - 0.5 x^2 */
+    VecType z  = x + y;                /* ... + x  */
+
+    return madd(fe, VecType(0.693359375f), z);
+}
+
+/* log2(x) = e + log(1 + f) log2(e). log2(e) - 1 is applied to the polynomial terms, so the exponent
+ * and f are added exactly */
+template <typename VecType>
+always_inline VecType vec_log2_float(VecType x)
+{
+    typedef typename VecType::int_vec int_vec;
 
-    y -= 0.5 * x*x;            /* y - 0.5 x^2 */
-    VecType z  = x + y;        /* ... + x  */
+    int_vec e;
+    x = frexp_float(x, e);
 
-    return z + 0.693359375 * fe;
+    const VecType x_smaller_sqrt_05 = mask_lt(x, VecType(0.707106781186547524f));
+    e = e + int_vec(x_smaller_sqrt_05);
+    x += (x & x_smaller_sqrt_05) - VecType(VecType::gen_one());
+
+    const VecType xx = x * x;
+    VecType y = madd(x, VecType(7.0376836292E-2f), VecType(-1.1514610310E-1f));
+    y = madd(y, x, VecType(1.1676998740E-1f));
+    y = madd(y, x, VecType(-1.2420140846E-1f));
+    y = madd(y, x, VecType(1.4249322787E-1f));
+    y = madd(y, x, VecType(-1.6668057665E-1f));
+    y = madd(y, x, VecType(2.0000714765E-1f));
+    y = madd(y, x, VecType(-2.4999993993E-1f));
+    y = madd(y, x, VecType(3.3333331174E-1f));
+    y = y * x * xx;
+    y = madd(xx, VecType(-0.5f), y);
+
+    const VecType log2ea(0.44269504088896340736f);
+    VecType z = madd(y, log2ea, madd(x, log2ea, y));
+    return (z + x) + VecType(e.convert_to_float());
 }
 
 
@@ -215,17 +415,16 @@ always_inline VecType vec_exp_tanh_float(VecType const & arg)
     VecType x = arg;
     VecType z = round(VecType(1.44269504088896341f) * x);
     int_vec n = z.truncate_to_int();
-    x -= z*VecType(0.693359375f);
-    x -= z*VecType(-2.12194440e-4f);
+    x = madd(z, VecType(-0.693359375f), x);
+    x = madd(z, VecType(2.12194440e-4f), x);
 
     /* Theoretical peak relative error in [-0.5, +0.5] is 3.5e-8. */
-    VecType p = 1.f +
-        x * (1.00000035762786865234375f +
-        x * (0.4999996721744537353515625f +
-        x * (0.16665561497211456298828125f +
-        x * (4.167006909847259521484375e-2f +
-        x * (8.420792408287525177001953125e-3f +
-        x * 1.386119984090328216552734375e-3f)))));
+    VecType p = madd(x, VecType(1.386119984090328216552734375e-3f), VecType(8.420792408287525177001953125e-3f));
+    p = madd(p, x, VecType(4.167006909847259521484375e-2f));
+    p = madd(p, x, VecType(0.16665561497211456298828125f));
+    p = madd(p, x, VecType(0.4999996721744537353515625f));
+    p = madd(p, x, VecType(1.00000035762786865234375f));
+    p = madd(p, x, VecType(VecType::gen_one()));
 
     /* multiply by power of 2 */
     VecType approx = ldexp_float(p, n);
@@ -264,20 +463,20 @@ always_inline VecType vec_sin_float(VecType const & arg)
     static float DP1 = 0.78515625;
     static float DP2 = 2.4187564849853515625e-4;
     static float DP3 = 3.77489497744594108e-8;
-    VecType base = ((abs_arg - y * DP1) - y * DP2) - y * DP3;
+    VecType base = madd(y, VecType(-DP1), abs_arg);
+    base = madd(y, VecType(-DP2), base);
+    base = madd(y, VecType(-DP3), base);
 
     /* [0..pi/4] */
     VecType z = base * base;
-    VecType p1 = ((  2.443315711809948E-005 * z
-        - 1.388731625493765E-003) * z
-        + 4.166664568298827E-002) * z * z
-        -0.5f * z + 1.0
-        ;
+    VecType p1 = madd(z, VecType(2.443315711809948E-005f), VecType(-1.388731625493765E-003f));
+    p1 = madd(p1, z, VecType(4.166664568298827E-002f));
+    p1 = madd(p1 * z, z, madd(z, VecType(-0.5f), VecType(VecType::gen_one())));
 
     /* [pi/4..pi/2] */
-    VecType p2 = ((-1.9515295891E-4 * z
-         + 8.3321608736E-3) * z
-         - 1.6666654611E-1) * z * base + base;
+    VecType p2 = madd(z, VecType(-1.9515295891E-4f), VecType(8.3321608736E-3f));
+    p2 = madd(p2, z, VecType(-1.6666654611E-1f));
+    p2 = madd(p2 * z, base, base);
 
     VecType approximation =  select(p1, p2, poly_mask);
 
@@ -313,26 +512,79 @@ always_inline VecType vec_cos_float(VecType const & arg)
     static float DP1 = 0.78515625;
     static float DP2 = 2.4187564849853515625e-4;
     static float DP3 = 3.77489497744594108e-8;
-    VecType base = ((abs_arg - y * DP1) - y * DP2) - y * DP3;
+    VecType base = madd(y, VecType(-DP1), abs_arg);
+    base = madd(y, VecType(-DP2), base);
+    base = madd(y, VecType(-DP3), base);
 
     /* [0..pi/4] */
     VecType z = base * base;
-    VecType p1 = ((  2.443315711809948E-005 * z
-        - 1.388731625493765E-003) * z
-        + 4.166664568298827E-002) * z * z
-        -0.5f * z + 1
-        ;
+    VecType p1 = madd(z, VecType(2.443315711809948E-005f), VecType(-1.388731625493765E-003f));
+    p1 = madd(p1, z, VecType(4.166664568298827E-002f));
+    p1 = madd(p1 * z, z, madd(z, VecType(-0.5f), VecType(VecType::gen_one())));
 
     /* [pi/4..pi/2] */
-    VecType p2 = ((-1.9515295891E-4 * z
-         + 8.3321608736E-3) * z
-         - 1.6666654611E-1) * z * base + base;
+    VecType p2 = madd(z, VecType(-1.9515295891E-4f), VecType(8.3321608736E-3f));
+    p2 = madd(p2, z, VecType(-1.6666654611E-1f));
+    p2 = madd(p2 * z, base, base);
 
     VecType approximation =  select(p1, p2, poly_mask);
 
     return approximation ^ sign;
 }
 
+/* sin and cos with a single range reduction. the polynomials are shared, only the quadrant selection and
+ * the signs differ */
+template <typename VecType>
+always_inline void vec_sincos_float(VecType const & arg, VecType & sin_result, VecType & cos_result)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const typename VecType::float_type four_over_pi = 1.27323954473516268615107010698011489627567716592367;
+
+    VecType sin_sign = arg & VecType::gen_sign_mask();
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+
+    VecType y = abs_arg * four_over_pi;
+
+    int_vec j = y.truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    y = j.convert_to_float();
+
+    /* sign based on quadrant */
+    VecType swap_sign_bit = slli(j & int_vec(4), 29);
+    sin_sign = sin_sign ^ swap_sign_bit;
+
+    int_vec jm2 = j - int_vec(2);
+    VecType cos_sign = slli(andnot(jm2, int_vec(4)), 29);
+
+    /* polynomial mask: the cosine uses the other polynomial */
+    VecType poly_mask = VecType (mask_eq(j & int_vec(2), int_vec(0)));
+
+    /* black magic */
+    static float DP1 = 0.78515625;
+    static float DP2 = 2.4187564849853515625e-4;
+    static float DP3 = 3.77489497744594108e-8;
+    VecType base = madd(y, VecType(-DP1), abs_arg);
+    base = madd(y, VecType(-DP2), base);
+    base = madd(y, VecType(-DP3), base);
+
+    /* [0..pi/4] */
+    VecType z = base * base;
+    VecType p1 = madd(z, VecType(2.443315711809948E-005f), VecType(-1.388731625493765E-003f));
+    p1 = madd(p1, z, VecType(4.166664568298827E-002f));
+    p1 = madd(p1 * z, z, madd(z, VecType(-0.5f), VecType(VecType::gen_one())));
+
+    /* [pi/4..pi/2] */
+    VecType p2 = madd(z, VecType(-1.9515295891E-4f), VecType(8.3321608736E-3f));
+    p2 = madd(p2, z, VecType(-1.6666654611E-1f));
+    p2 = madd(p2 * z, base, base);
+
+    sin_result = select(p1, p2, poly_mask) ^ sin_sign;
+    cos_result = select(p2, p1, poly_mask) ^ cos_sign;
+}
+
 /* adapted from cephes, approximation polynomial generted by sollya */
 template <typename VecType>
 always_inline VecType vec_tan_float(VecType const & arg)
@@ -357,13 +609,19 @@ always_inline VecType vec_tan_float(VecType const & arg)
     static float DP1 = 0.78515625;
     static float DP2 = 2.4187564849853515625e-4;
     static float DP3 = 3.77489497744594108e-8;
-    VecType base = ((abs_arg - y * DP1) - y * DP2) - y * DP3;
+    VecType base = madd(y, VecType(-DP1), abs_arg);
+    base = madd(y, VecType(-DP2), base);
+    base = madd(y, VecType(-DP3), base);
 
     VecType x = base; VecType x2 = x*x;
 
     // sollya: fpminimax(tan(x), [|3,5,7,9,11,13|], [|24...|], [-pi/4,pi/4], x);
-    VecType approx =
-        x + x * x2 * (0.3333315551280975341796875 + x2 * (0.1333882510662078857421875 + x2 * (5.3409568965435028076171875e-2 + x2 * (2.443529665470123291015625e-2 + x2 * (3.1127030961215496063232421875e-3 + x2 * 9.3892104923725128173828125e-3)))));
+    VecType poly = madd(x2, VecType(9.3892104923725128173828125e-3f), VecType(3.1127030961215496063232421875e-3f));
+    poly = madd(poly, x2, VecType(2.443529665470123291015625e-2f));
+    poly = madd(poly, x2, VecType(5.3409568965435028076171875e-2f));
+    poly = madd(poly, x2, VecType(0.1333882510662078857421875f));
+    poly = madd(poly, x2, VecType(0.3333315551280975341796875f));
+    VecType approx = madd(x * x2, poly, x);
 
     //VecType recip = -reciprocal(approx);
     VecType recip = -1.0 / approx;
@@ -394,7 +652,11 @@ always_inline VecType vec_asin_float(VecType const & arg)
 
     VecType x = approx_arg; VecType x2 = x*x;
     // sollya: fpminimax(asin(x), [|3,5,7,9,11|], [|24...|], [0.000000000000000000001,0.5], x);
-    VecType approx_poly = x + x * x2 * (0.166667520999908447265625 + x2 * (7.4953101575374603271484375e-2 + x2 * (4.54690195620059967041015625e-2 + x2 * (2.418550290167331695556640625e-2 + x2 * 4.21570129692554473876953125e-2))));
+    VecType poly = madd(x2, VecType(4.21570129692554473876953125e-2f), VecType(2.418550290167331695556640625e-2f));
+    poly = madd(poly, x2, VecType(4.54690195620059967041015625e-2f));
+    poly = madd(poly, x2, VecType(7.4953101575374603271484375e-2f));
+    poly = madd(poly, x2, VecType(0.166667520999908447265625f));
+    VecType approx_poly = madd(x * x2, poly, x);
 
     VecType approx_poly_reduced = 1.57079637050628662109375 - approx_poly - approx_poly;
     VecType approx = select(approx_poly, approx_poly_reduced, arg_greater_05);
@@ -472,8 +734,10 @@ always_inline VecType vec_atan_float(VecType const & arg)
     VecType x = approx_arg;
     VecType x2 = x*x;
 
-    VecType approx = approx_offset +
-       x + x * x2 * (-0.333329498767852783203125 + x2 * (0.19977732002735137939453125 + x2 * (-0.1387787759304046630859375 + x2 * 8.054284751415252685546875e-2)));
+    VecType poly = madd(x2, VecType(8.054284751415252685546875e-2f), VecType(-0.1387787759304046630859375f));
+    poly = madd(poly, x2, VecType(0.19977732002735137939453125f));
+    poly = madd(poly, x2, VecType(-0.333329498767852783203125f));
+    VecType approx = approx_offset + madd(x * x2, poly, x);
 
     return approx ^ sign_arg;
 }
@@ -506,12 +770,11 @@ always_inline VecType vec_tanh_float(VecType const & arg)
     const VecType f5((float)-3.33332819422e-1);
 
     const VecType arg_sqr = abs_arg * abs_arg;
-    const VecType result_small = ((((f1 * arg_sqr
-                                     + f2) * arg_sqr
-                                    + f3) * arg_sqr
-                                   + f4) * arg_sqr
-                                  + f5) * arg_sqr * arg
-        + arg;
+    VecType poly = madd(f1, arg_sqr, f2);
+    poly = madd(poly, arg_sqr, f3);
+    poly = madd(poly, arg_sqr, f4);
+    poly = madd(poly, arg_sqr, f5);
+    const VecType result_small = madd(poly * arg_sqr, arg, arg);
 
     const VecType abs_small = mask_lt(abs_arg, limit_small);
 
@@ -524,89 +787,1738 @@ always_inline VecType vec_tanh_float(VecType const & arg)
     return result;
 }
 
+
+/* double-precision versions, adapted from cephes
+ *
+ * the integer vector of the double-precision vec class uses 64bit lanes. the quadrants and exponents are
+ * computed via 32bit conversions, so the range reduction is limited to arguments of |x| < 2^31 * pi/4
+ */
 template <typename VecType>
-always_inline VecType vec_signed_pow(VecType arg1, VecType arg2)
+always_inline VecType vec_exp_double(VecType const & arg)
 {
-    const VecType sign_arg1 = arg1 & VecType::gen_sign_mask();
-    const VecType abs_arg1  = arg1 ^ sign_arg1;
+    typedef typename VecType::int_vec int_vec;
 
-    const VecType result = pow(abs_arg1, arg2);
+    /* Express e**x = e**g 2**n
+     *   = e**g e**( n loge(2) )
+     *   = e**( g + n loge(2) )
+     */
+    VecType x = arg;
+    VecType z = round(x * VecType(1.4426950408889634073599));
+    int_vec n = z.truncate_to_int();
+    x = madd(z, VecType(-6.93145751953125E-1), x);
+    x = madd(z, VecType(-1.42860682030941723212E-6), x);
+
+    /* rational approximation: e**x = 1 + 2x P(x**2) / (Q(x**2) - x P(x**2)) */
+    const VecType xx = x * x;
+    VecType px = madd(xx, VecType(1.26177193074810590878E-4), VecType(3.02994407707441961300E-2));
+    px = x * madd(px, xx, VecType(9.99999999999999999910E-1));
+    VecType qx = madd(xx, VecType(3.00198505138664455042E-6), VecType(2.52448340349684104192E-3));
+    qx = madd(qx, xx, VecType(2.27265548208155028766E-1));
+    qx = madd(qx, xx, VecType(2.00000000000000000009E0));
+    const VecType ratio = px / (qx - px);
+    const VecType p = VecType(VecType::gen_one()) + ratio + ratio;
 
-    return sign_arg1 | result;
+    /* multiply by power of 2 */
+    VecType approx = ldexp_double(p, n);
+
+    /* handle min/max boundaries, keeping the exponent of the result normalized */
+    const VecType maxlog(709.436139303104);
+    const VecType minlog(-708.0498449419841);
+    const VecType max_double(std::numeric_limits<double>::max());
+    const VecType zero = VecType::gen_zero();
+
+    VecType too_large = mask_gt(arg, maxlog);
+    VecType too_small = mask_lt(arg, minlog);
+
+    VecType ret = select(approx, max_double, too_large);
+    ret = select(ret, zero, too_small);
+
+    return ret;
 }
 
-/* compute pow using exp and log. seems to be faster than table-based algorithms */
+/* 2**x = 2**n 2**f, |f| <= 0.5 */
 template <typename VecType>
-always_inline VecType vec_pow(VecType arg1, VecType arg2)
+always_inline VecType vec_exp2_double(VecType const & arg)
 {
-    const VecType zero      = VecType::gen_zero();
-    const VecType arg1_zero = mask_eq(arg1, zero);
+    const VecType x = max_(min_(arg, VecType(1025.0)), VecType(-1076.0));
+    const VecType n = round(x);
+    const VecType f = x - n;
+
+    /* cephes: 2**f = 1 + 2 f P(f**2) / (Q(f**2) - f P(f**2)) */
+    const VecType ff = f * f;
+    VecType px = madd(ff, VecType(2.30933477057345225087E-2), VecType(2.02020656693165307700E1));
+    px = f * madd(px, ff, VecType(1.51390680115615096133E3));
+    VecType qx = ff + VecType(2.33184211722314911771E2);
+    qx = madd(qx, ff, VecType(4.36821166879210612817E3));
+    const VecType ratio = px / (qx - px);
+    const VecType p = VecType(VecType::gen_one()) + ratio + ratio;
+
+    return vec_scale_pow2(p, n);
+}
 
-    const VecType result = exp(arg2 * log(arg1));
-    return select(result, zero, arg1_zero);
+/* exp(x) - 1, adapted from cephes. rational approximation for |x| <= 0.5. see vec_expm1_float for
+ * large arguments */
+template <typename VecType>
+always_inline VecType vec_expm1_double(VecType const & arg)
+{
+    const VecType xx = arg * arg;
+    VecType px = madd(xx, VecType(1.2617719307481059087798E-4), VecType(3.0299440770744196129956E-2));
+    px = arg * madd(px, xx, VecType(9.9999999999999999991025E-1));
+    VecType qx = madd(xx, VecType(3.0019850513866445504159E-6), VecType(2.5244834034968410419224E-3));
+    qx = madd(qx, xx, VecType(2.2726554820815502876593E-1));
+    qx = madd(qx, xx, VecType(2.0000000000000000000897E0));
+    const VecType ratio = px / (qx - px);
+    const VecType small = ratio + ratio;
+
+    const VecType large = vec_exp_double(arg) - VecType(VecType::gen_one());
+    const VecType half_exp = vec_exp_double(arg * VecType(0.5));
+
+    VecType result = select(large, small, mask_le(abs(arg), VecType(0.5)));
+    result = select(result, half_exp * half_exp, mask_gt(arg, VecType(709.0)));
+    result = select(result, arg, mask_eq(arg, VecType::gen_zero())); // -0
+    return select(result, arg, mask_neq(arg, arg));
 }
 
 template <typename VecType>
-always_inline VecType vec_signed_sqrt(VecType arg)
+always_inline VecType vec_log_double(VecType x)
 {
-    const VecType sign_arg1 = arg & VecType::gen_sign_mask();
-    const VecType abs_arg1  = arg ^ sign_arg1;
+    typedef typename VecType::int_vec int_vec;
 
-    const VecType result = sqrt(abs_arg1);
+    int_vec e;
+    x = frexp_double(x, e);
 
-    return sign_arg1 | result;
+    const VecType sqrt_05(0.70710678118654752440);
+    const VecType x_smaller_sqrt_05 = mask_lt(x, sqrt_05);
+    e = e + int_vec(x_smaller_sqrt_05);
+    VecType x_add = x;
+    x_add = x_add & x_smaller_sqrt_05;
+    x += x_add - VecType(VecType::gen_one());
+
+    /* log(1+x) = x - 0.5 x**2 + x**3 P(x)/Q(x) */
+    const VecType z = x * x;
+    VecType px = madd(x, VecType(1.01875663804580931796E-4), VecType(4.97494994976747001425E-1));
+    px = madd(px, x, VecType(4.70579119878881725854E0));
+    px = madd(px, x, VecType(1.44989225341610930846E1));
+    px = madd(px, x, VecType(1.79368678507819816313E1));
+    px = madd(px, x, VecType(7.70838733755885391666E0));
+    VecType qx = x + VecType(1.12873587189167450590E1);
+    qx = madd(qx, x, VecType(4.52279145837532221105E1));
+    qx = madd(qx, x, VecType(8.29875266912776603211E1));
+    qx = madd(qx, x, VecType(7.11544750618563894466E1));
+    qx = madd(qx, x, VecType(2.31251620126765340583E1));
+
+    VecType y = x * (z * px / qx);
+
+    const VecType fe = e.convert_to_float();
+    y = madd(fe, VecType(-2.121944400546905827679e-4), y);
+    y = madd(z, VecType(-0.5), y);
+    const VecType ret = x + y;
+
+    return madd(fe, VecType(0.693359375), ret);
 }
 
+/* see vec_log2_float */
 template <typename VecType>
-always_inline VecType vec_log2(VecType arg)
+always_inline VecType vec_log2_double(VecType x)
 {
-    const double rlog2 = 1.0/std::log(2.0);
-    return log(arg) * VecType((typename VecType::float_type)rlog2);
+    typedef typename VecType::int_vec int_vec;
+
+    int_vec e;
+    x = frexp_double(x, e);
+
+    const VecType x_smaller_sqrt_05 = mask_lt(x, VecType(0.70710678118654752440));
+    e = e + int_vec(x_smaller_sqrt_05);
+    x += (x & x_smaller_sqrt_05) - VecType(VecType::gen_one());
+
+    const VecType z = x * x;
+    VecType px = madd(x, VecType(1.01875663804580931796E-4), VecType(4.97494994976747001425E-1));
+    px = madd(px, x, VecType(4.70579119878881725854E0));
+    px = madd(px, x, VecType(1.44989225341610930846E1));
+    px = madd(px, x, VecType(1.79368678507819816313E1));
+    px = madd(px, x, VecType(7.70838733755885391666E0));
+    VecType qx = x + VecType(1.12873587189167450590E1);
+    qx = madd(qx, x, VecType(4.52279145837532221105E1));
+    qx = madd(qx, x, VecType(8.29875266912776603211E1));
+    qx = madd(qx, x, VecType(7.11544750618563894466E1));
+    qx = madd(qx, x, VecType(2.31251620126765340583E1));
+
+    VecType y = x * (z * px / qx);
+    y = madd(z, VecType(-0.5), y);
+
+    const VecType log2ea(0.44269504088896340736);
+    const VecType w = madd(y, log2ea, madd(x, log2ea, y));
+    return (w + x) + VecType(e.convert_to_float());
 }
 
 template <typename VecType>
-always_inline VecType vec_log10(VecType arg)
+always_inline void vec_sincos_poly_double(VecType const & base, VecType & sin_poly, VecType & cos_poly)
 {
-    const double rlog10 = 1.0/std::log(10.0);
-    return log(arg) * VecType((typename VecType::float_type)rlog10);
+    const VecType z = base * base;
+
+    VecType cp = madd(z, VecType(-1.13585365213876817300E-11), VecType(2.08757008419747316778E-9));
+    cp = madd(cp, z, VecType(-2.75573141792967388112E-7));
+    cp = madd(cp, z, VecType(2.48015872888517045348E-5));
+    cp = madd(cp, z, VecType(-1.38888888888730564116E-3));
+    cp = madd(cp, z, VecType(4.16666666666665929218E-2));
+    cos_poly = madd(z * z, cp, madd(z, VecType(-0.5), VecType(VecType::gen_one())));
+
+    VecType sp = madd(z, VecType(1.58962301576546568060E-10), VecType(-2.50507477628578072866E-8));
+    sp = madd(sp, z, VecType(2.75573136213857245213E-6));
+    sp = madd(sp, z, VecType(-1.98412698295895385996E-4));
+    sp = madd(sp, z, VecType(8.33333333332211858878E-3));
+    sp = madd(sp, z, VecType(-1.66666666666666307295E-1));
+    sin_poly = madd(base * z, sp, base);
 }
 
+/* the range reduction of the double precision sin, cos and tan computes the octant as 32bit integer
+ * and looses precision for large arguments. lanes above 2**30 (lossth of cephes) are computed by libm */
+static const double vec_trig_double_max_arg = 1073741824.0;
+
 template <typename VecType>
-always_inline VecType vec_select(VecType lhs, VecType rhs, VecType bitmask)
+always_inline bool vec_has_large_lanes(VecType const & abs_arg, double limit)
 {
-    const VecType result = andnot(bitmask, lhs) | (bitmask & rhs);
+    const VecType large = select(VecType(VecType::gen_zero()), VecType(VecType::gen_one()),
+                                 mask_gt(abs_arg, VecType(limit)));
+    return large.horizontal_max() != 0;
+}
+
+struct libm_sin { double operator()(double x) const { return std::sin(x); } };
+struct libm_cos { double operator()(double x) const { return std::cos(x); } };
+struct libm_tan { double operator()(double x) const { return std::tan(x); } };
+
+template <typename VecType, typename Functor>
+inline VecType vec_large_lanes_libm(VecType const & arg, VecType result, double limit, Functor const & f)
+{
+    for (int i = 0; i != VecType::size; ++i) {
+        const double x = arg.get(i);
+        if (std::fabs(x) > limit)
+            result.set(i, f(x));
+    }
     return result;
 }
 
+template <typename VecType>
+always_inline VecType vec_sin_double(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const double four_over_pi = 1.27323954473516268615107010698011489627567716592367;
+
+    VecType sign = arg & VecType::gen_sign_mask();
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+
+    VecType y = abs_arg * VecType(four_over_pi);
+
+    int_vec j = y.truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    y = j.convert_to_float();
+
+    /* sign based on quadrant */
+    VecType swap_sign_bit = slli(j & int_vec(4), 61);
+    sign = sign ^ swap_sign_bit;
+
+    /* polynomial mask */
+    VecType poly_mask = VecType (mask_eq(j & int_vec(2), int_vec(0)));
+
+    /* extended precision modular arithmetic, negated pi/4 */
+    const VecType DP1(-7.85398125648498535156E-1);
+    const VecType DP2(-3.77489470793079817668E-8);
+    const VecType DP3(-2.69515142907905952645E-15);
+    VecType base = madd(y, DP1, abs_arg);
+    base = madd(y, DP2, base);
+    base = madd(y, DP3, base);
+
+    VecType sin_poly, cos_poly;
+    vec_sincos_poly_double(base, sin_poly, cos_poly);
+
+    VecType approximation = select(cos_poly, sin_poly, poly_mask);
+
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_double_max_arg, libm_sin());
+    return ret;
+}
 
 template <typename VecType>
-always_inline VecType vec_undenormalize(VecType arg)
+always_inline VecType vec_cos_double(VecType const & arg)
 {
-    typedef typename VecType::float_type float_type;
-    const float_type min_positive_value = std::numeric_limits<float_type>::min();
+    typedef typename VecType::int_vec int_vec;
 
-    const VecType abs_arg = abs(arg);
-    const VecType abs_arg_lt_min = mask_lt(abs_arg, min_positive_value);
-    const VecType zero = VecType::gen_zero();
+    const double four_over_pi = 1.27323954473516268615107010698011489627567716592367;
 
-    const VecType result = select(arg, zero, abs_arg_lt_min);
-    return result;
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+
+    VecType y = abs_arg * VecType(four_over_pi);
+
+    int_vec j = y.truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    y = j.convert_to_float();
+
+    /* sign based on quadrant */
+    int_vec jm2 = j - int_vec(2);
+    VecType sign = slli(andnot(jm2, int_vec(4)), 61);
+
+    /* polynomial mask */
+    VecType poly_mask = VecType (mask_eq(jm2 & int_vec(2), int_vec(0)));
+
+    /* extended precision modular arithmetic, negated pi/4 */
+    const VecType DP1(-7.85398125648498535156E-1);
+    const VecType DP2(-3.77489470793079817668E-8);
+    const VecType DP3(-2.69515142907905952645E-15);
+    VecType base = madd(y, DP1, abs_arg);
+    base = madd(y, DP2, base);
+    base = madd(y, DP3, base);
+
+    VecType sin_poly, cos_poly;
+    vec_sincos_poly_double(base, sin_poly, cos_poly);
+
+    VecType approximation = select(cos_poly, sin_poly, poly_mask);
+
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_double_max_arg, libm_cos());
+    return ret;
 }
 
+/* sin and cos with a single range reduction */
 template <typename VecType>
-always_inline VecType vec_reciprocal_newton(VecType arg)
+always_inline void vec_sincos_double(VecType const & arg, VecType & sin_result, VecType & cos_result)
 {
-    const VecType one = VecType::gen_one();
+    typedef typename VecType::int_vec int_vec;
 
-    const VecType approx = fast_reciprocal(arg);
+    const double four_over_pi = 1.27323954473516268615107010698011489627567716592367;
 
-    // One round of Newton-Raphson refinement
-    const VecType diff = one - approx * arg;
-    const VecType result = madd(diff, approx, approx);
+    VecType sin_sign = arg & VecType::gen_sign_mask();
+    VecType abs_arg = arg & VecType::gen_abs_mask();
 
-    return result;
+    VecType y = abs_arg * VecType(four_over_pi);
+
+    int_vec j = y.truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    y = j.convert_to_float();
+
+    /* sign based on quadrant */
+    VecType swap_sign_bit = slli(j & int_vec(4), 61);
+    sin_sign = sin_sign ^ swap_sign_bit;
+
+    int_vec jm2 = j - int_vec(2);
+    VecType cos_sign = slli(andnot(jm2, int_vec(4)), 61);
+
+    /* polynomial mask: the cosine uses the other polynomial */
+    VecType poly_mask = VecType (mask_eq(j & int_vec(2), int_vec(0)));
+
+    /* extended precision modular arithmetic, negated pi/4 */
+    const VecType DP1(-7.85398125648498535156E-1);
+    const VecType DP2(-3.77489470793079817668E-8);
+    const VecType DP3(-2.69515142907905952645E-15);
+    VecType base = madd(y, DP1, abs_arg);
+    base = madd(y, DP2, base);
+    base = madd(y, DP3, base);
+
+    VecType sin_poly, cos_poly;
+    vec_sincos_poly_double(base, sin_poly, cos_poly);
+
+    sin_result = select(cos_poly, sin_poly, poly_mask) ^ sin_sign;
+    cos_result = select(sin_poly, cos_poly, poly_mask) ^ cos_sign;
+
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_max_arg)) {
+        sin_result = vec_large_lanes_libm(arg, sin_result, vec_trig_double_max_arg, libm_sin());
+        cos_result = vec_large_lanes_libm(arg, cos_result, vec_trig_double_max_arg, libm_cos());
+    }
 }
 
+template <typename VecType>
+always_inline VecType vec_tan_double(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+    const double four_over_pi = 1.27323954473516268615107010698011489627567716592367;
+
+    VecType sign = arg & VecType::gen_sign_mask();
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+
+    VecType y = abs_arg * VecType(four_over_pi);
+    int_vec j = y.truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    y = j.convert_to_float();
+
+    /* approximation mask */
+    VecType poly_mask = VecType (mask_eq(j & int_vec(2), int_vec(0)));
+
+    /* extended precision modular arithmetic, negated pi/4 */
+    const VecType DP1(-7.853981554508209228515625E-1);
+    const VecType DP2(-7.94662735614792836714E-9);
+    const VecType DP3(-3.06161699786838294307E-17);
+    VecType x = madd(y, DP1, abs_arg);
+    x = madd(y, DP2, x);
+    x = madd(y, DP3, x);
+
+    /* tan(x) = x + x**3 P(x**2)/Q(x**2) */
+    VecType z = x * x;
+    VecType px = madd(z, VecType(-1.30936939181383777646E4), VecType(1.15351664838587416140E6));
+    px = madd(px, z, VecType(-1.79565251976484877988E7));
+    VecType qx = z + VecType(1.36812963470692954678E4);
+    qx = madd(qx, z, VecType(-1.32089234440210967447E6));
+    qx = madd(qx, z, VecType(2.50083801823357915839E7));
+    qx = madd(qx, z, VecType(-5.38695755929454629881E7));
+
+    VecType approx = madd(x, z * px / qx, x);
+
+    VecType recip = VecType(-1.0) / approx;
+
+    VecType approximation = select(recip, approx, poly_mask);
+
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_double_max_arg, libm_tan());
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_asin_double(VecType const & arg)
+{
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType sign = arg & VecType::gen_sign_mask();
+    VecType one = VecType::gen_one();
+    VecType zero = VecType::gen_zero();
+
+    const VecType pio4(7.85398163397448309616E-1);
+    const VecType morebits(6.123233995736765886130E-17);
+
+    /* |arg| > 0.625: asin(x) = pi/2 - 2 asin( sqrt( (1-x)/2 ) ) */
+    VecType zz = one - abs_arg;
+    VecType rx = madd(zz, VecType(2.967721961301243206100E-3), VecType(-5.634242780008963776856E-1));
+    rx = madd(rx, zz, VecType(6.968710824104713396794E0));
+    rx = madd(rx, zz, VecType(-2.556901049652824852289E1));
+    rx = madd(rx, zz, VecType(2.853665548261061424989E1));
+    VecType sx = zz + VecType(-2.194779531642920639778E1);
+    sx = madd(sx, zz, VecType(1.470656354026814941758E2));
+    sx = madd(sx, zz, VecType(-3.838770957603691357202E2));
+    sx = madd(sx, zz, VecType(3.424398657913078477438E2));
+    VecType p = zz * rx / sx;
+    VecType sqrt_zz = sqrt(zz + zz);
+    VecType approx_large = ((pio4 - sqrt_zz) - (sqrt_zz * p - morebits)) + pio4;
+
+    /* |arg| <= 0.625: asin(x) = x + x**3 P(x**2)/Q(x**2) */
+    VecType z = abs_arg * abs_arg;
+    VecType px = madd(z, VecType(4.253011369004428248960E-3), VecType(-6.019598008014123785661E-1));
+    px = madd(px, z, VecType(5.444622390564711410273E0));
+    px = madd(px, z, VecType(-1.626247967210700244449E1));
+    px = madd(px, z, VecType(1.956261983317594739197E1));
+    px = madd(px, z, VecType(-8.198089802484824371615E0));
+    VecType qx = z + VecType(-1.474091372988853791896E1);
+    qx = madd(qx, z, VecType(7.049610280856842141659E1));
+    qx = madd(qx, z, VecType(-1.471791292232726029859E2));
+    qx = madd(qx, z, VecType(1.395105614657485689735E2));
+    qx = madd(qx, z, VecType(-4.918853881490881290097E1));
+    VecType approx_small = madd(abs_arg, z * px / qx, abs_arg);
+
+    VecType approx = select(approx_small, approx_large, mask_gt(abs_arg, VecType(0.625)));
+
+    approx = approx ^ sign;
+    // |arg| > 1: return 0
+    VecType ret = select(approx, zero, mask_gt(abs_arg, one));
+    return ret;
+}
+
+/* based on asin approximation:
+ *
+ * x < -0.5:        acos(x) = pi - 2.0 * asin( sqrt((1+x)/2) );
+ * -0.5 < x < 0.5   acos(x) = pi/2 - asin(x)
+ * x > 0.5          acos(x) =      2.0 * asin( sqrt((1-x)/2) ).
+ *
+ */
+template <typename VecType>
+always_inline VecType vec_acos_double(VecType const & arg)
+{
+    VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType one = VecType::gen_one();
+    VecType half = VecType::gen_05();
+    VecType zero = VecType::gen_zero();
+
+    const VecType pio4(7.85398163397448309616E-1);
+    const VecType morebits(6.123233995736765886130E-17);
+
+    VecType arg_greater_05 = mask_gt(abs_arg, half);
+    VecType asin_arg_greater_05 = sqrt((one - abs_arg) * half);
+
+    VecType asin_arg = select(arg, asin_arg_greater_05, arg_greater_05);
+
+    VecType asin = vec_asin_double(asin_arg);
+    VecType two_asin = asin + asin;
+
+    VecType ret_m1_m05 = VecType(3.14159265358979323846) - two_asin;
+    VecType ret_m05_05 = ((pio4 - asin) + morebits) + pio4;
+    VecType ret_05_1 = two_asin;
+
+    VecType ret_m05_1 = select(ret_m05_05, ret_05_1, mask_gt(arg, half));
+    VecType ret = select(ret_m05_1, ret_m1_m05, mask_lt(arg, VecType(-0.5)));
+
+    // |arg| > 1: return 0
+    ret = select(ret, zero, mask_gt(abs_arg, one));
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_atan_double(VecType const & arg)
+{
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg & VecType::gen_abs_mask();
+    const VecType one      = VecType::gen_one();
+    VecType zero           = VecType::gen_zero();
+
+    const VecType morebits(6.123233995736765886130E-17);
+
+    VecType arg_range0 = abs_arg;
+    VecType arg_range1 = (abs_arg - one) / (abs_arg + one);
+    VecType arg_range2 = VecType(-1.0) / abs_arg;
+
+    VecType offset_range0 = zero;
+    VecType offset_range1 = VecType(7.85398163397448309616E-1) + morebits * VecType(0.5);
+    VecType offset_range2 = VecType(1.57079632679489661923E0) + morebits;
+
+    VecType mask_range_01 = mask_gt(abs_arg, VecType(0.66));
+    VecType mask_range_12 = mask_gt(abs_arg, VecType(2.41421356237309504880));
+
+    VecType approx_arg = select(arg_range0,
+                                select(arg_range1, arg_range2, mask_range_12),
+                                mask_range_01);
+
+    VecType approx_offset = select(offset_range0,
+                                   select(offset_range1, offset_range2, mask_range_12),
+                                   mask_range_01);
+
+    VecType x = approx_arg;
+    VecType z = x * x;
+
+    VecType px = madd(z, VecType(-8.750608600031904122785E-1), VecType(-1.615753718733365076637E1));
+    px = madd(px, z, VecType(-7.500855792314704667340E1));
+    px = madd(px, z, VecType(-1.228866684490136173410E2));
+    px = madd(px, z, VecType(-6.485021904942025371773E1));
+    VecType qx = z + VecType(2.485846490142306297962E1);
+    qx = madd(qx, z, VecType(1.650270098316988542046E2));
+    qx = madd(qx, z, VecType(4.328810604912902668951E2));
+    qx = madd(qx, z, VecType(4.853903996359136964868E2));
+    qx = madd(qx, z, VecType(1.945506571482613964425E2));
+
+    VecType approx = approx_offset + madd(x, z * px / qx, x);
+
+    return approx ^ sign_arg;
+}
+
+template <typename VecType>
+always_inline VecType vec_tanh_double(VecType const & arg)
+{
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType one      = VecType::gen_one();
+    const VecType two (2.0);
+    const VecType maxlog_2 (354.891356446692);
+    const VecType limit_small (0.625);
+
+    /* medium values */
+    const VecType result_medium_abs = one - two / (vec_exp_double(abs_arg + abs_arg) + one);
+
+    /* large values */
+    const VecType abs_big          = mask_gt(abs_arg, maxlog_2);
+    const VecType result_limit_abs = one;
+
+    /* small values */
+    const VecType arg_sqr = abs_arg * abs_arg;
+    VecType px = madd(arg_sqr, VecType(-9.64399179425052238628E-1), VecType(-9.92877231001918586564E1));
+    px = madd(px, arg_sqr, VecType(-1.61468768441708447952E3));
+    VecType qx = arg_sqr + VecType(1.12811678491632931402E2);
+    qx = madd(qx, arg_sqr, VecType(2.23548839060100448583E3));
+    qx = madd(qx, arg_sqr, VecType(4.84406305325125486048E3));
+    const VecType result_small = madd(arg * arg_sqr, px / qx, arg);
+
+    const VecType abs_small = mask_lt(abs_arg, limit_small);
+
+    /* select from large and medium branches and set sign */
+    const VecType result_lm_abs = select(result_medium_abs, result_limit_abs, abs_big);
+    const VecType result_lm = result_lm_abs | sign_arg;
+
+    const VecType result = select(result_lm, result_small, abs_small);
+
+    return result;
+}
+
+template <typename VecType>
+always_inline VecType vec_signed_pow(VecType arg1, VecType arg2)
+{
+    const VecType sign_arg1 = arg1 & VecType::gen_sign_mask();
+    const VecType abs_arg1  = arg1 ^ sign_arg1;
+
+    const VecType result = pow(abs_arg1, arg2);
+
+    return sign_arg1 | result;
+}
+
+/* compute pow using exp and log. seems to be faster than table-based algorithms */
+template <typename VecType>
+always_inline VecType vec_pow(VecType arg1, VecType arg2)
+{
+    const VecType zero      = VecType::gen_zero();
+    const VecType arg1_zero = mask_eq(arg1, zero);
+
+    const VecType result = exp(arg2 * log(arg1));
+    return select(result, zero, arg1_zero);
+}
+
+/* atan2 via atan of min(|y|, |x|) / max(|y|, |x|), which is in [0, 1], mapped to the octant. the
+ * ratio of two zeros is 0 and the ratio of two infinities is 1. the quadrant is taken from the sign
+ * bit of x, so that atan2(0, -0) = pi */
+template <typename VecType>
+always_inline VecType vec_atan2(VecType y, VecType x)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType zero     = VecType::gen_zero();
+    const VecType one      = VecType::gen_one();
+    const VecType infinity(std::numeric_limits<float_type>::infinity());
+    const VecType sign_y   = y & VecType::gen_sign_mask();
+    const VecType abs_y    = y ^ sign_y;
+    const VecType sign_x   = x & VecType::gen_sign_mask();
+    const VecType abs_x    = x ^ sign_x;
+
+    const VecType numerator   = min_(abs_y, abs_x);
+    const VecType denominator = max_(abs_y, abs_x);
+    VecType ratio = select(numerator / denominator, zero, mask_eq(denominator, zero));
+    ratio = select(ratio, one, mask_eq(numerator, infinity));
+
+    VecType result = atan(ratio);
+    result = select(result, VecType(float_type(1.57079632679489661923)) - result, mask_gt(abs_y, abs_x));
+    result = select(result, VecType(float_type(3.14159265358979323846)) - result, mask_lt(one | sign_x, zero));
+
+    return result | sign_y;
+}
+
+/* sqrt(x*x + y*y) without intermediate overflow or underflow */
+template <typename VecType>
+always_inline VecType vec_hypot(VecType x, VecType y)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType abs_x = abs(x);
+    const VecType abs_y = abs(y);
+
+    const VecType larger  = max_(abs_x, abs_y);
+    const VecType smaller = min_(abs_x, abs_y);
+    const VecType ratio   = smaller / larger;
+
+    const VecType result = larger * sqrt(madd(ratio, ratio, VecType(VecType::gen_one())));
+
+    /* 0/0 and inf/inf */
+    const VecType infinity(std::numeric_limits<typename VecType::float_type>::infinity());
+    return select(select(result, zero, mask_eq(larger, zero)), infinity, mask_eq(larger, infinity));
+}
+
+/* log(1 + x). the rounding error of 1 + x is compensated by a first order correction, which is
+ * skipped if 1 + x is 0 or infinite. if 1 + x rounds to 1, log1p(x) = x */
+template <typename VecType>
+always_inline VecType vec_log1p(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType zero = VecType::gen_zero();
+    const VecType one = VecType::gen_one();
+    const VecType infinity(std::numeric_limits<float_type>::infinity());
+
+    const VecType u = arg + one;
+    const VecType correction = (arg - (u - one)) / u;
+    VecType result = log(u) + correction;
+
+    result = select(result, arg, mask_eq(u, one));
+    result = select(result, infinity, mask_eq(u, infinity));
+    result = select(result, VecType(-std::numeric_limits<float_type>::infinity()), mask_eq(u, zero));
+    return select(result, VecType(std::numeric_limits<float_type>::quiet_NaN()), mask_lt(u, zero));
+}
+
+/* e**x / 2 for the arguments of sinh and cosh above log(max) / 2, where e**-x is negligible. it is
+ * computed as (e**(x/2) / 2) e**(x/2), so that it overflows to infinity instead of being clamped by
+ * exp */
+template <typename VecType>
+always_inline VecType vec_half_exp_large(VecType const & abs_arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType half(float_type(0.5));
+    const VecType half_exp = exp(abs_arg * half);
+    return (half * half_exp) * half_exp;
+}
+
+template <typename VecType>
+always_inline VecType vec_half_exp_threshold(void)
+{
+    typedef typename VecType::float_type float_type;
+
+    return VecType(float_type(0.5) * std::log(std::numeric_limits<float_type>::max()));
+}
+
+/* sinh(x) = (e**x - e**-x) / 2, computed via expm1 to be accurate for small arguments */
+template <typename VecType>
+always_inline VecType vec_sinh(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType is_large = mask_gt(abs_arg, vec_half_exp_threshold<VecType>());
+
+    const VecType em = expm1(select(abs_arg, VecType::gen_zero(), is_large));
+    const VecType small = VecType(float_type(0.5)) * (em + em / (em + VecType(VecType::gen_one())));
+
+    const VecType result = select(small, vec_half_exp_large(abs_arg), is_large) | sign_arg;
+    return select(result, arg, mask_neq(arg, arg));
+}
+
+template <typename VecType>
+always_inline VecType vec_cosh(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType abs_arg = abs(arg);
+    const VecType is_large = mask_gt(abs_arg, vec_half_exp_threshold<VecType>());
+
+    const VecType e = exp(select(abs_arg, VecType::gen_zero(), is_large));
+    const VecType small = VecType(float_type(0.5)) * (e + VecType(VecType::gen_one()) / e);
+
+    const VecType result = select(small, vec_half_exp_large(abs_arg), is_large);
+    return select(result, arg, mask_neq(arg, arg));
+}
+
+/* arguments larger than 1/sqrt(epsilon) use asinh(x) = log(2x), where x**2 + 1 == x**2 */
+template <typename VecType>
+always_inline VecType vec_asinh(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType one = VecType::gen_one();
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType large_threshold(float_type(1) / std::sqrt(std::numeric_limits<float_type>::epsilon()));
+    const VecType is_large = mask_gt(abs_arg, large_threshold);
+
+    /* asinh(x) = log1p(x + x**2 / (1 + sqrt(1 + x**2))) */
+    const VecType x = select(abs_arg, one, is_large);
+    const VecType xx = x * x;
+    const VecType small = log1p(x + xx / (one + sqrt(xx + one)));
+    const VecType large = log(abs_arg) + VecType(float_type(0.693147180559945309417));
+
+    /* the vector log does not handle infinity */
+    const VecType infinity(std::numeric_limits<float_type>::infinity());
+    VecType result = select(small, large, is_large);
+    result = select(result, infinity, mask_eq(abs_arg, infinity)) | sign_arg;
+    return select(result, arg, mask_neq(arg, arg));
+}
+
+/* defined for arguments >= 1 */
+template <typename VecType>
+always_inline VecType vec_acosh(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType one = VecType::gen_one();
+    const VecType large_threshold(float_type(1) / std::sqrt(std::numeric_limits<float_type>::epsilon()));
+    const VecType is_large = mask_gt(arg, large_threshold);
+
+    /* acosh(1 + t) = log1p(t + sqrt(2t + t**2)) */
+    const VecType t = select(arg, one, is_large) - one;
+    const VecType small = log1p(t + sqrt(madd(t, t, t + t)));
+    const VecType large = log(arg) + VecType(float_type(0.693147180559945309417));
+
+    const VecType infinity(std::numeric_limits<float_type>::infinity());
+    VecType result = select(small, large, is_large);
+    result = select(result, infinity, mask_eq(arg, infinity));
+    return select(result, arg, mask_neq(arg, arg));
+}
+
+/* atanh(x) = log1p(2x / (1 - x)) / 2, atanh(+-1) = +-inf and nan for |x| > 1 */
+template <typename VecType>
+always_inline VecType vec_atanh(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType one = VecType::gen_one();
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+
+    VecType result = VecType(float_type(0.5)) * log1p((abs_arg + abs_arg) / (one - abs_arg));
+    result = select(result, VecType(std::numeric_limits<float_type>::infinity()), mask_eq(abs_arg, one));
+    result = select(result, VecType(std::numeric_limits<float_type>::quiet_NaN()), mask_gt(abs_arg, one));
+    return result | sign_arg;
+}
+
+/* adapted from fdlibm (s_erf.c). the argument range is split into four intervals:
+ * |x| < 0.84375:          erf(x) = x + x * P(x**2) / Q(x**2)
+ * 0.84375 <= |x| < 1.25:  erf(x) = erx + P(|x| - 1) / Q(|x| - 1)
+ * 1.25 <= |x| < 1/0.35:   erfc(x) = exp(-x**2 - 0.5625 + R(1/x**2) / S(1/x**2)) / x
+ * 1/0.35 <= |x|:          same, with different coefficients */
+struct erf_small_numerator
+{
+    static constexpr double coefficients[] = { 1.28379167095512558561e-01, -3.25042107247001499370e-01,
+                                               -2.84817495755985104766e-02, -5.77027029648944159157e-03,
+                                               -2.37630166566501626084e-05 };
+};
+
+struct erf_small_denominator
+{
+    static constexpr double coefficients[] = { 1.0, 3.97917223959155352819e-01, 6.50222499887672944485e-02,
+                                               5.08130628187576562776e-03, 1.32494738004321644526e-04,
+                                               -3.96022827877536812320e-06 };
+};
+
+struct erf_near_one_numerator
+{
+    static constexpr double coefficients[] = { -2.36211856075265944077e-03, 4.14856118683748331666e-01,
+                                               -3.72207876035701323847e-01, 3.18346619901161753674e-01,
+                                               -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+                                               -2.16637559486879084300e-03 };
+};
+
+struct erf_near_one_denominator
+{
+    static constexpr double coefficients[] = { 1.0, 1.06420880400844228286e-01, 5.40397917702171048937e-01,
+                                               7.18286544141962662868e-02, 1.26171219808761642112e-01,
+                                               1.36370839120290507362e-02, 1.19844998467991074170e-02 };
+};
+
+struct erfc_medium_numerator
+{
+    static constexpr double coefficients[] = { -9.86494403484714822705e-03, -6.93858572707181764372e-01,
+                                               -1.05586262253232909814e+01, -6.23753324503260060396e+01,
+                                               -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+                                               -8.12874355063065934246e+01, -9.81432934416914548592e+00 };
+};
+
+struct erfc_medium_denominator
+{
+    static constexpr double coefficients[] = { 1.0, 1.96512716674392571292e+01, 1.37657754143519042600e+02,
+                                               4.34565877475229228821e+02, 6.45387271733267880336e+02,
+                                               4.29008140027567833386e+02, 1.08635005541779435134e+02,
+                                               6.57024977031928170135e+00, -6.04244152148580987438e-02 };
+};
+
+struct erfc_large_numerator
+{
+    static constexpr double coefficients[] = { -9.86494292470009928597e-03, -7.99283237680523006574e-01,
+                                               -1.77579549177547519889e+01, -1.60636384855821916062e+02,
+                                               -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+                                               -4.83519191608651397019e+02 };
+};
+
+struct erfc_large_denominator
+{
+    static constexpr double coefficients[] = { 1.0, 3.03380607434824582924e+01, 3.25792512996573918826e+02,
+                                               1.53672958608443695994e+03, 3.19985821950859553908e+03,
+                                               2.55305040643316442583e+03, 4.74528541206955367215e+02,
+                                               -2.24409524465858183362e+01 };
+};
+
+/* erfc(x) for x >= 1.25. x**2 is split into z**2 + (x - z)(x + z), where the lower mantissa bits of
+ * z are cleared, so that z**2 + 0.5625 is exact */
+template <typename VecType>
+always_inline VecType vec_erfc_tail(VecType abs_arg)
+{
+    typedef typename VecType::float_type float_type;
+    typedef typename VecType::int_vec int_vec;
+
+    /* erfc(28) is below the smallest denormal */
+    const VecType x = min_(abs_arg, VecType(float_type(28)));
+    const VecType s = VecType(VecType::gen_one()) / (x * x);
+
+    const VecType medium = rational<erfc_medium_numerator, erfc_medium_denominator>(s);
+    const VecType large  = rational<erfc_large_numerator, erfc_large_denominator>(s);
+    const VecType r = select(medium, large, mask_ge(x, VecType(float_type(1.0/0.35))));
+
+    const int split_shift = sizeof(float_type) == sizeof(float) ? 13 : 32;
+    const VecType z = x & VecType(slli(int_vec(-1), split_shift));
+
+    const VecType e = exp(VecType(float_type(-0.5625)) - z * z) * exp(madd(z - x, z + x, r));
+    return e / x;
+}
+
+template <typename VecType>
+always_inline VecType vec_erf(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType one = VecType::gen_one();
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+
+    const VecType small = madd(abs_arg, rational<erf_small_numerator, erf_small_denominator>(abs_arg * abs_arg),
+                               abs_arg);
+    const VecType erx(float_type(8.45062911510467529297e-01)); // erf(1), rounded
+    const VecType near_one = erx + rational<erf_near_one_numerator, erf_near_one_denominator>(abs_arg - one);
+    const VecType tail = one - vec_erfc_tail(abs_arg);
+
+    VecType result = select(tail, near_one, mask_lt(abs_arg, VecType(float_type(1.25))));
+    result = select(result, small, mask_lt(abs_arg, VecType(float_type(0.84375))));
+    return result | sign_arg;
+}
+
+template <typename VecType>
+always_inline VecType vec_erfc(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType one = VecType::gen_one();
+    const VecType half(float_type(0.5));
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType is_negative = mask_lt(arg, VecType::gen_zero());
+
+    /* 1 - erf(x), arranged to keep the rounding error small for x close to 0.84375 */
+    const VecType r = arg * rational<erf_small_numerator, erf_small_denominator>(arg * arg);
+    const VecType small = select(half - (r + (arg - half)), one - (arg + r),
+                                 mask_lt(abs_arg, VecType(float_type(0.25))));
+
+    const VecType erx(float_type(8.45062911510467529297e-01)); // erf(1), rounded
+    const VecType p = rational<erf_near_one_numerator, erf_near_one_denominator>(abs_arg - one);
+    const VecType near_one = select((one - erx) - p, one + (erx + p), is_negative);
+
+    const VecType tail = vec_erfc_tail(abs_arg);
+    const VecType far = select(tail, VecType(float_type(2)) - tail, is_negative);
+
+    VecType result = select(far, near_one, mask_lt(abs_arg, VecType(float_type(1.25))));
+    result = select(result, small, mask_lt(abs_arg, VecType(float_type(0.84375))));
+    return result;
+}
+
+/* adapted from cephes: polynomial approximation of the cube root of the mantissa in [0.5, 1) with a
+ * relative error of 9.2e-6, refined by newton iterations. the exponent is split into 3q + r */
+struct cbrt_mantissa_coefficients
+{
+    static constexpr double coefficients[] = { 4.0238979564544752126924e-1, 1.1399983354717293273738e0,
+                                               -9.5438224771509446525043e-1, 5.4664601366395524503440e-1,
+                                               -1.3466110473359520655053e-1 };
+};
+
+template <typename VecType>
+always_inline VecType vec_cbrt(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+    typedef typename VecType::int_vec int_vec;
+    typedef ieee_traits<float_type> traits;
+
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+
+    /* frexp does not normalize subnormals, so they are scaled by 2**(3k) and the result by 2**-k */
+    const int k = (std::numeric_limits<float_type>::digits + 2) / 3;
+    const VecType is_subnormal = mask_lt(abs_arg, VecType(std::numeric_limits<float_type>::min()));
+    const VecType scaled_arg = select(abs_arg, abs_arg * VecType(std::ldexp(float_type(1), 3 * k)), is_subnormal);
+
+    int_vec exponent;
+    const VecType m = traits::frexp(scaled_arg, exponent);
+
+    VecType result = horner<cbrt_mantissa_coefficients>(m);
+
+    const VecType e(exponent.convert_to_float());
+    const VecType q = floor(e * VecType(float_type(1.0/3.0)) + VecType(float_type(1e-3)));
+    const VecType r = e - q * VecType(float_type(3));
+
+    result = select(result, result * VecType(float_type(1.2599210498948731647672)), mask_eq(r, VecType(float_type(1))));
+    result = select(result, result * VecType(float_type(1.5874010519681994747517)), mask_eq(r, VecType(float_type(2))));
+    result = result * vec_pow2i<VecType>(q.truncate_to_int());
+
+    /* each iteration doubles the number of correct bits */
+    const int newton_steps = sizeof(float_type) == sizeof(float) ? 1 : 2;
+    for (int i = 0; i != newton_steps; ++i)
+        result = result - (result - scaled_arg / (result * result)) * VecType(float_type(1.0/3.0));
+    result = select(result, result * VecType(std::ldexp(float_type(1), -k)), is_subnormal);
+
+    const VecType zero = VecType::gen_zero();
+    const VecType infinity(std::numeric_limits<float_type>::infinity());
+    result = select(result, abs_arg, mask_eq(abs_arg, zero) | mask_eq(abs_arg, infinity));
+    return result | sign_arg;
+}
+
+template <typename VecType>
+always_inline VecType vec_signed_sqrt(VecType arg)
+{
+    const VecType sign_arg1 = arg & VecType::gen_sign_mask();
+    const VecType abs_arg1  = arg ^ sign_arg1;
+
+    const VecType result = sqrt(abs_arg1);
+
+    return sign_arg1 | result;
+}
+
+template <typename VecType>
+always_inline VecType vec_log10(VecType arg)
+{
+    const double rlog10 = 1.0/std::log(10.0);
+    return log(arg) * VecType((typename VecType::float_type)rlog10);
+}
+
+template <typename VecType>
+always_inline VecType vec_select(VecType lhs, VecType rhs, VecType bitmask)
+{
+    const VecType result = andnot(bitmask, lhs) | (bitmask & rhs);
+    return result;
+}
+
+
+template <typename VecType>
+always_inline VecType vec_undenormalize(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+    const float_type min_positive_value = std::numeric_limits<float_type>::min();
+
+    const VecType abs_arg = abs(arg);
+    const VecType abs_arg_lt_min = mask_lt(abs_arg, min_positive_value);
+    const VecType zero = VecType::gen_zero();
+
+    const VecType result = select(arg, zero, abs_arg_lt_min);
+    return result;
+}
+
+template <typename VecType>
+always_inline VecType vec_reciprocal_newton(VecType arg)
+{
+    const VecType one = VecType::gen_one();
+
+    const VecType approx = fast_reciprocal(arg);
+
+    // One round of Newton-Raphson refinement
+    const VecType diff = one - approx * arg;
+    const VecType result = madd(diff, approx, approx);
+
+    return result;
+}
+
+/* rsqrt refines the estimate of fast_rsqrt by NOVA_SIMD_RSQRT_NEWTON_STEPS newton iterations. each
+ * iteration roughly doubles the number of correct bits, the sse and avx estimates have 12 */
+#ifndef NOVA_SIMD_RSQRT_NEWTON_STEPS
+#define NOVA_SIMD_RSQRT_NEWTON_STEPS 1
+#endif
+
+template <unsigned int NewtonSteps, typename VecType>
+always_inline VecType vec_rsqrt_newton(VecType arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    /* the estimate of subnormal arguments is infinite, so they are scaled by 2**(2 digits) and the
+     * result by 2**digits */
+    const int digits = std::numeric_limits<float_type>::digits;
+    const VecType is_subnormal = mask_gt(arg, VecType::gen_zero())
+                                 & mask_lt(arg, VecType(std::numeric_limits<float_type>::min()));
+    const VecType scaled_arg = select(arg, arg * VecType(std::ldexp(float_type(1), 2 * digits)), is_subnormal);
+
+    const VecType estimate = fast_rsqrt(scaled_arg);
+    const VecType half_arg = scaled_arg * VecType(float_type(0.5));
+
+    VecType result = estimate;
+    for (unsigned int i = 0; i != NewtonSteps; ++i)
+        result = result * (VecType(float_type(1.5)) - half_arg * result * result);
+
+    /* the iteration yields nan for 0 and infinity, where the estimate is exact */
+    result = select(estimate, result, mask_eq(result, result));
+    return select(result, result * VecType(std::ldexp(float_type(1), digits)), is_subnormal);
+}
+
+/* accuracy tiers
+ *
+ * the functions above implement the standard tier. the fast tier trades accuracy (about 1e-4 relative
+ * error) for shorter polynomials and skips the handling of the range boundaries, the precise tier
+ * carries the rounding errors of the range reductions in low-order terms, so that the results are
+ * within 1 ulp. the fast kernels are shared by float and double, ieee_traits provides the layout of
+ * the floating point type.
+ */
+
+/* e**x = 2**n 2**f, |f| <= 0.5. arguments are clamped to the range of normalized exponents */
+template <typename VecType>
+always_inline VecType vec_exp_fast(VecType const & arg)
+{
+    typedef typename VecType::float_type float_type;
+    typedef ieee_traits<float_type> traits;
+
+    const VecType max_exponent(float_type(traits::exponent_bias));
+    const VecType min_exponent(float_type(1 - traits::exponent_bias));
+
+    VecType t = arg * VecType(float_type(1.44269504088896340736));
+    t = max_(min_(t, max_exponent), min_exponent);
+    const VecType n = round(t);
+    const VecType f = t - n;
+
+    VecType p = madd(f, VecType(float_type(9.78291256288675088764e-3)), VecType(float_type(5.59768836321248982505e-2)));
+    p = madd(p, f, VecType(float_type(2.40207110787279140774e-1)));
+    p = madd(p, f, VecType(float_type(6.93113604403002777157e-1)));
+    p = madd(p, f, VecType(VecType::gen_one()));
+
+    return p * vec_pow2i<VecType>(n.truncate_to_int());
+}
+
+/* positive normalized arguments only */
+template <typename VecType>
+always_inline VecType vec_log_fast(VecType x)
+{
+    typedef typename VecType::float_type float_type;
+    typedef typename VecType::int_vec int_vec;
+    typedef ieee_traits<float_type> traits;
+
+    int_vec e;
+    x = traits::frexp(x, e);
+
+    const VecType x_smaller_sqrt_05 = mask_lt(x, VecType(float_type(0.70710678118654752440)));
+    e = e + int_vec(x_smaller_sqrt_05);
+    x += (x & x_smaller_sqrt_05) - VecType(VecType::gen_one());
+
+    VecType p = madd(x, VecType(float_type(0.176580542197219689043)), VecType(float_type(-0.270945994356059464172)));
+    p = madd(p, x, VecType(float_type(0.33638884238112651143)));
+    p = madd(p, x, VecType(float_type(-0.499450647508385791923)));
+    p = madd(p, x, VecType(float_type(0.999966181359661494832)));
+
+    return madd(VecType(e.convert_to_float()), VecType(float_type(0.693147180559945309417)), p * x);
+}
+
+/* sin(y) for |y| <= pi/2 */
+template <typename VecType>
+always_inline VecType vec_sin_fast_reduced(VecType const & y)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType z = y * y;
+    VecType p = madd(z, VecType(float_type(7.60290334341274108662e-3)), VecType(float_type(-0.165960116541103077777)));
+    p = madd(p, z, VecType(float_type(0.999891821255987059544)));
+    return p * y;
+}
+
+/* sin(x) = (-1)**k sin(x - k pi) */
+template <typename VecType>
+always_inline VecType vec_sin_fast(VecType const & arg)
+{
+    typedef typename VecType::float_type float_type;
+    typedef ieee_traits<float_type> traits;
+
+    const VecType k = round(arg * VecType(float_type(0.318309886183790671538)));
+    VecType y = madd(k, VecType(float_type(-3.140625)), arg);
+    y = madd(k, VecType(float_type(-9.67653589793238512809e-4)), y);
+
+    const VecType sign = VecType(slli(k.truncate_to_int(), traits::sign_shift));
+    return vec_sin_fast_reduced(y) ^ sign;
+}
+
+/* cos(x) = (-1)**(k+1) sin(x - (k + 0.5) pi) */
+template <typename VecType>
+always_inline VecType vec_cos_fast(VecType const & arg)
+{
+    typedef typename VecType::float_type float_type;
+    typedef typename VecType::int_vec int_vec;
+    typedef ieee_traits<float_type> traits;
+
+    const VecType k = round(madd(arg, VecType(float_type(0.318309886183790671538)), VecType(float_type(-0.5))));
+    const VecType k_half = k + VecType(float_type(0.5));
+    VecType y = madd(k_half, VecType(float_type(-3.140625)), arg);
+    y = madd(k_half, VecType(float_type(-9.67653589793238512809e-4)), y);
+
+    const VecType sign = VecType(slli(k.truncate_to_int() + int_vec(1), traits::sign_shift));
+    return vec_sin_fast_reduced(y) ^ sign;
+}
+
+/* [7/6] pade approximation, clamped where it reaches 1 */
+template <typename VecType>
+always_inline VecType vec_tanh_fast(VecType const & arg)
+{
+    typedef typename VecType::float_type float_type;
+
+    const VecType x = max_(min_(arg, VecType(float_type(4.97))), VecType(float_type(-4.97)));
+    const VecType z = x * x;
+
+    VecType p = z + VecType(float_type(378));
+    p = madd(p, z, VecType(float_type(17325)));
+    p = madd(p, z, VecType(float_type(135135)));
+    VecType q = madd(z, VecType(float_type(28)), VecType(float_type(3150)));
+    q = madd(q, z, VecType(float_type(62370)));
+    q = madd(q, z, VecType(float_type(135135)));
+    return x * p / q;
+}
+
+template <typename VecType>
+always_inline VecType vec_pow_fast(VecType arg1, VecType arg2)
+{
+    const VecType zero      = VecType::gen_zero();
+    const VecType arg1_zero = mask_eq(arg1, zero);
+
+    const VecType result = vec_exp_fast(arg2 * vec_log_fast(arg1));
+    return select(result, zero, arg1_zero);
+}
+
+/* the precise kernels use error-free transformations: the rounding error of a sum is recovered
+ * with two_sum, products are split into halves, whose partial products are exact. the halves are
+ * computed by masking, since dekker's splitting breaks when the compiler contracts it to fmas */
+
+/* rounding error of a + b, if |a| >= |b| or a == 0 */
+template <typename VecType>
+always_inline VecType vec_fast_two_sum_error(VecType const & a, VecType const & b, VecType const & sum)
+{
+    return (a - sum) + b;
+}
+
+/* rounding error of a + b */
+template <typename VecType>
+always_inline VecType vec_two_sum_error(VecType const & a, VecType const & b, VecType const & sum)
+{
+    const VecType b_virtual = sum - a;
+    const VecType a_virtual = sum - b_virtual;
+    return (a - a_virtual) + (b - b_virtual);
+}
+
+template <typename VecType>
+always_inline void vec_split_float(VecType const & a, VecType & hi, VecType & lo)
+{
+    typedef typename VecType::int_vec int_vec;
+    hi = a & VecType(int_vec(-4096));
+    lo = a - hi;
+}
+
+template <typename VecType>
+always_inline void vec_split_double(VecType const & a, VecType & hi, VecType & lo)
+{
+    typedef typename VecType::int_vec int_vec;
+    hi = a & VecType(int_vec(-(1 << 27)));
+    lo = a - hi;
+}
+
+/* e**(arg + arg_lo), arg_lo is a small correction term */
+template <typename VecType>
+always_inline VecType vec_exp_float_precise_ext(VecType const & arg, VecType const & arg_lo)
+{
+    const VecType x = max_(min_(arg, VecType(89.f)), VecType(-104.f));
+
+    /* x + arg_lo - n log(2) = r_hi + r_lo, the product of n and the leading bits of log(2) is exact */
+    const VecType n = round(VecType(1.44269504088896341f) * (x + arg_lo));
+    const VecType r_hi = madd(n, VecType(-0.693359375f), x);
+    const VecType r_lo = madd(n, VecType(2.12194440e-4f), arg_lo);
+    const VecType r = r_hi + r_lo;
+
+    /* e**r = 1 + r + r**2 q(r) */
+    VecType q = madd(r, VecType(1.38145985615519953089e-3f), VecType(8.3687168786954288453e-3f));
+    q = madd(q, r, VecType(4.16683880470061278663e-2f));
+    q = madd(q, r, VecType(0.166665206317202387512f));
+    q = madd(q, r, VecType(0.499999934477882498402f));
+
+    const VecType one = VecType::gen_one();
+    const VecType s = one + r_hi;
+    const VecType p = s + (vec_fast_two_sum_error(one, r_hi, s) + madd(r * r, q, r_lo));
+
+    return vec_scale_pow2(p, n);
+}
+
+template <typename VecType>
+always_inline VecType vec_exp_float_precise(VecType const & arg)
+{
+    const VecType ret = vec_exp_float_precise_ext(arg, VecType(VecType::gen_zero()));
+    return select(ret, arg, mask_neq(arg, arg));
+}
+
+/* log(arg) = hi + lo for positive arguments. log(1 + f) = 2 atanh(f / (2 + f)), the quotient is
+ * computed with its rounding error */
+template <typename VecType>
+always_inline VecType vec_log_float_ext(VecType const & arg, VecType & lo)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType one = VecType::gen_one();
+    const VecType two(2.f);
+
+    /* normalize denormals */
+    const VecType denormal = mask_lt(arg, VecType(std::numeric_limits<float>::min()));
+    const VecType scaled = select(arg, arg * VecType(8388608.f), denormal);
+
+    int_vec e;
+    const VecType m = frexp_float(scaled, e);
+    const VecType m_smaller_sqrt_05 = mask_lt(m, VecType(0.707106781186547524f));
+    e = e + int_vec(m_smaller_sqrt_05);
+    const VecType f = m + ((m & m_smaller_sqrt_05) - one);
+    const VecType fe = VecType(e.convert_to_float()) - (VecType(23.f) & denormal);
+
+    /* s = f / (2 + f) = s_hi + s_lo */
+    const VecType d = two + f;
+    const VecType d_lo = vec_fast_two_sum_error(two, f, d);
+    const VecType s_hi = f / d;
+    VecType s1, s2, d1, d2;
+    vec_split_float(s_hi, s1, s2);
+    vec_split_float(d, d1, d2);
+    const VecType residual = ((((f - s1 * d1) - s1 * d2) - s2 * d1) - s2 * d2) - s_hi * d_lo;
+    const VecType s_lo = residual / d;
+
+    /* 2 atanh(s) = 2 s + s**3 t(s**2), the derivative 2 / (1 - s**2) scales s_lo */
+    const VecType z = s_hi * s_hi;
+    VecType t = madd(z, VecType(2.f/13.f), VecType(2.f/11.f));
+    t = madd(t, z, VecType(2.f/9.f));
+    t = madd(t, z, VecType(2.f/7.f));
+    t = madd(t, z, VecType(2.f/5.f));
+    t = madd(t, z, VecType(2.f/3.f));
+
+    /* e log(2) = e (c1 + c2), the first product is exact */
+    const VecType a = fe * VecType(0.693145751953125f);
+    const VecType b = s_hi + s_hi;
+    const VecType hi = a + b;
+    lo = vec_two_sum_error(a, b, hi) + madd(fe, VecType(1.42860682030941723212E-6f),
+                                            madd(z * s_hi, t, s_lo * madd(z, two, two)));
+    return hi;
+}
+
+template <typename VecType>
+always_inline VecType vec_log_float_precise(VecType const & arg)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType infinity(std::numeric_limits<float>::infinity());
+
+    VecType lo;
+    const VecType hi = vec_log_float_ext(arg, lo);
+
+    /* log(0) = -inf, log(inf) = inf, log(x < 0) = nan */
+    VecType result = select(hi + lo, VecType(-std::numeric_limits<float>::infinity()), mask_eq(arg, zero));
+    result = select(result, infinity, mask_eq(arg, infinity));
+    return select(result, VecType(std::numeric_limits<float>::quiet_NaN()), mask_lt(arg, zero) | mask_neq(arg, arg));
+}
+
+/* octant reduction |arg| - j pi/4 = base + base_lo, pi/4 is split into four parts. the products of
+ * j and the first three parts are exact for |arg| < 8192, larger lanes are computed by libm */
+static const double vec_trig_float_precise_max_arg = 8192.0;
+
+template <typename VecType>
+always_inline typename VecType::int_vec vec_reduce_pi4_float_precise(VecType const & abs_arg, VecType & base, VecType & base_lo)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const float four_over_pi = 1.27323954473516268615107010698011489627567716592367f;
+    int_vec j = (abs_arg * VecType(four_over_pi)).truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    const VecType y(j.convert_to_float());
+
+    const VecType a = madd(y, VecType(-0.78515625f), abs_arg);
+    const VecType p2 = y * VecType(-2.4187564849853515625e-4f);
+    const VecType b = a + p2;
+    const VecType b_err = vec_two_sum_error(a, p2, b);
+
+    const VecType p3 = y * VecType(-3.774766810238361358642578e-8f);
+    const VecType c = b + p3;
+    const VecType c_err = vec_two_sum_error(b, p3, c);
+
+    const VecType p4 = y * VecType(-1.281672088338653425765301e-12f);
+    base = c + p4;
+    base_lo = (vec_two_sum_error(c, p4, base) + c_err) + b_err;
+    return j;
+}
+
+/* sin(base + base_lo) for |base| <= pi/4 */
+template <typename VecType>
+always_inline VecType vec_sin_poly_float_precise(VecType const & base, VecType const & base_lo, VecType const & z)
+{
+    VecType p = madd(z, VecType(-1.9515295891E-4f), VecType(8.3321608736E-3f));
+    p = madd(p, z, VecType(-1.6666654611E-1f));
+    return base + madd(base_lo, madd(z, VecType(-0.5f), VecType(VecType::gen_one())), p * z * base);
+}
+
+/* cos(base + base_lo) for |base| <= pi/4, 1 - z/2 is computed with its rounding error */
+template <typename VecType>
+always_inline VecType vec_cos_poly_float_precise(VecType const & base, VecType const & base_lo, VecType const & z)
+{
+    const VecType one = VecType::gen_one();
+    VecType p = madd(z, VecType(2.443315711809948E-005f), VecType(-1.388731625493765E-003f));
+    p = madd(p, z, VecType(4.166664568298827E-002f));
+
+    const VecType h = z * VecType(0.5f);
+    const VecType w = one - h;
+    const VecType w_err = ((one - w) - h) - base * base_lo;
+    return w + madd(p * z, z, w_err);
+}
+
+template <typename VecType>
+always_inline VecType vec_sin_float_precise(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType base, base_lo;
+    const int_vec j = vec_reduce_pi4_float_precise(abs_arg, base, base_lo);
+
+    const VecType sign = (arg & VecType::gen_sign_mask()) ^ VecType(slli(j & int_vec(4), 29));
+    const VecType poly_mask = VecType(mask_eq(j & int_vec(2), int_vec(0)));
+
+    const VecType z = base * base;
+    const VecType approximation = select(vec_cos_poly_float_precise(base, base_lo, z),
+                                         vec_sin_poly_float_precise(base, base_lo, z), poly_mask);
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_float_precise_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_float_precise_max_arg, libm_sin());
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_cos_float_precise(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType base, base_lo;
+    const int_vec j = vec_reduce_pi4_float_precise(abs_arg, base, base_lo);
+
+    const int_vec jm2 = j - int_vec(2);
+    const VecType sign = VecType(slli(andnot(jm2, int_vec(4)), 29));
+    const VecType poly_mask = VecType(mask_eq(jm2 & int_vec(2), int_vec(0)));
+
+    const VecType z = base * base;
+    const VecType approximation = select(vec_cos_poly_float_precise(base, base_lo, z),
+                                         vec_sin_poly_float_precise(base, base_lo, z), poly_mask);
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_float_precise_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_float_precise_max_arg, libm_cos());
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_tanh_float_precise(VecType const & arg)
+{
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType one      = VecType::gen_one();
+
+    /* medium values: 1 - 2 / (e**2x + 1), saturates to 1 for large values */
+    const VecType result_medium = (one - VecType(2.f) / (vec_exp_float_precise(abs_arg + abs_arg) + one)) | sign_arg;
+
+    /* small values: x + x**3 p(x**2), the polynomial covers |x| < 1, where the medium branch
+     * loses accuracy */
+    const VecType z = abs_arg * abs_arg;
+    VecType p = madd(z, VecType(1.21470802298115148374e-4f), VecType(-8.41137531476574868399e-4f));
+    p = madd(p, z, VecType(3.07859479504990668777e-3f));
+    p = madd(p, z, VecType(-8.59511524216711827841e-3f));
+    p = madd(p, z, VecType(2.17847311665285716928e-2f));
+    p = madd(p, z, VecType(-5.39530985079788262665e-2f));
+    p = madd(p, z, VecType(0.133332003820851958945f));
+    p = madd(p, z, VecType(-0.333333293051418826813f));
+    const VecType result_small = madd(p * z, arg, arg);
+
+    return select(result_medium, result_small, mask_lt(abs_arg, one));
+}
+
+/* pow(x, y) = e**(y log(x)), the product is computed from the extended logarithm with its
+ * rounding errors */
+template <typename VecType>
+always_inline VecType vec_pow_float_precise(VecType const & arg1, VecType const & arg2)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType one = VecType::gen_one();
+    const VecType infinity(std::numeric_limits<float>::infinity());
+
+    VecType log_lo;
+    const VecType log_hi = vec_log_float_ext(arg1, log_lo);
+
+    /* arg2 (log_hi + log_lo) = prod + prod_lo, the product of the leading halves is exact */
+    VecType y1, y2, l1, l2;
+    vec_split_float(arg2, y1, y2);
+    vec_split_float(log_hi, l1, l2);
+    const VecType prod_hi = y1 * l1;
+    const VecType prod_hi_lo = madd(arg2, log_lo, madd(y2, log_hi, y1 * l2));
+
+    /* the low part is not small compared to the ulp of the high part, so the sum is renormalized before
+     * exp clamps its argument */
+    const VecType prod = prod_hi + prod_hi_lo;
+    const VecType prod_lo = vec_two_sum_error(prod_hi, prod_hi_lo, prod);
+    const VecType saturated = mask_gt(prod & VecType::gen_abs_mask(), VecType(128.f));
+    VecType result = vec_exp_float_precise_ext(prod, andnot(saturated, prod_lo));
+
+    /* pow(0, y) = 0 or inf, pow(inf, y) = inf or 0, pow(x, 0) = pow(1, y) = 1, pow(x < 0, y) = nan */
+    const VecType y_negative = mask_lt(arg2, zero);
+    result = select(result, andnot(y_negative, infinity), mask_eq(arg1, infinity));
+    result = select(result, y_negative & infinity, mask_eq(arg1, zero));
+    result = select(result, VecType(std::numeric_limits<float>::quiet_NaN()),
+                    mask_lt(arg1, zero) | mask_neq(arg1, arg1) | mask_neq(arg2, arg2));
+    return select(result, one, mask_eq(arg2, zero) | mask_eq(arg1, one));
+}
+
+/* e**(x + x_lo) = (p_hi + p_lo) 2**n */
+template <typename VecType>
+always_inline void vec_exp_double_precise_kernel(VecType const & x, VecType const & x_lo,
+                                                 VecType & p_hi, VecType & p_lo, VecType & n)
+{
+    n = round(VecType(1.4426950408889634073599) * (x + x_lo));
+    const VecType r_hi = madd(n, VecType(-6.93145751953125E-1), x);
+    const VecType r_lo = madd(n, VecType(-1.42860682030941723212E-6), x_lo);
+    const VecType r = r_hi + r_lo;
+
+    /* e**r = 1 + r + r**2 q(r), taylor series */
+    VecType q = madd(r, VecType(1.0/6227020800.0), VecType(1.0/479001600.0));
+    q = madd(q, r, VecType(1.0/39916800.0));
+    q = madd(q, r, VecType(1.0/3628800.0));
+    q = madd(q, r, VecType(1.0/362880.0));
+    q = madd(q, r, VecType(1.0/40320.0));
+    q = madd(q, r, VecType(1.0/5040.0));
+    q = madd(q, r, VecType(1.0/720.0));
+    q = madd(q, r, VecType(1.0/120.0));
+    q = madd(q, r, VecType(1.0/24.0));
+    q = madd(q, r, VecType(1.0/6.0));
+    q = madd(q, r, VecType(0.5));
+
+    const VecType one = VecType::gen_one();
+    const VecType s = one + r_hi;
+    const VecType s_lo = vec_fast_two_sum_error(one, r_hi, s) + madd(r * r, q, r_lo);
+    p_hi = s + s_lo;
+    p_lo = vec_fast_two_sum_error(s, s_lo, p_hi);
+}
+
+template <typename VecType>
+always_inline VecType vec_exp_double_precise_ext(VecType const & arg, VecType const & arg_lo)
+{
+    const VecType x = max_(min_(arg, VecType(710.0)), VecType(-746.0));
+
+    VecType p_hi, p_lo, n;
+    vec_exp_double_precise_kernel(x, arg_lo, p_hi, p_lo, n);
+    return vec_scale_pow2(p_hi, n);
+}
+
+template <typename VecType>
+always_inline VecType vec_exp_double_precise(VecType const & arg)
+{
+    const VecType ret = vec_exp_double_precise_ext(arg, VecType(VecType::gen_zero()));
+    return select(ret, arg, mask_neq(arg, arg));
+}
+
+/* log(arg) = hi + lo for positive arguments, see vec_log_float_ext */
+template <typename VecType>
+always_inline VecType vec_log_double_ext(VecType const & arg, VecType & lo)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType one = VecType::gen_one();
+    const VecType two(2.0);
+
+    /* normalize denormals */
+    const VecType denormal = mask_lt(arg, VecType(std::numeric_limits<double>::min()));
+    const VecType scaled = select(arg, arg * VecType(4503599627370496.0), denormal);
+
+    int_vec e;
+    const VecType m = frexp_double(scaled, e);
+    const VecType m_smaller_sqrt_05 = mask_lt(m, VecType(0.70710678118654752440));
+    e = e + int_vec(m_smaller_sqrt_05);
+    const VecType f = m + ((m & m_smaller_sqrt_05) - one);
+    const VecType fe = VecType(e.convert_to_float()) - (VecType(52.0) & denormal);
+
+    const VecType d = two + f;
+    const VecType d_lo = vec_fast_two_sum_error(two, f, d);
+    const VecType s_hi = f / d;
+    VecType s1, s2, d1, d2;
+    vec_split_double(s_hi, s1, s2);
+    vec_split_double(d, d1, d2);
+    const VecType residual = ((((f - s1 * d1) - s1 * d2) - s2 * d1) - s2 * d2) - s_hi * d_lo;
+    const VecType s_lo = residual / d;
+
+    const VecType z = s_hi * s_hi;
+    VecType t = madd(z, VecType(2.0/21.0), VecType(2.0/19.0));
+    t = madd(t, z, VecType(2.0/17.0));
+    t = madd(t, z, VecType(2.0/15.0));
+    t = madd(t, z, VecType(2.0/13.0));
+    t = madd(t, z, VecType(2.0/11.0));
+    t = madd(t, z, VecType(2.0/9.0));
+    t = madd(t, z, VecType(2.0/7.0));
+    t = madd(t, z, VecType(2.0/5.0));
+    t = madd(t, z, VecType(2.0/3.0));
+
+    const VecType a = fe * VecType(6.93145751953125E-1);
+    const VecType b = s_hi + s_hi;
+    const VecType hi = a + b;
+    lo = vec_two_sum_error(a, b, hi) + madd(fe, VecType(1.42860682030941723212E-6),
+                                            madd(z * s_hi, t, s_lo * madd(z, two, two)));
+    return hi;
+}
+
+template <typename VecType>
+always_inline VecType vec_log_double_precise(VecType const & arg)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType infinity(std::numeric_limits<double>::infinity());
+
+    VecType lo;
+    const VecType hi = vec_log_double_ext(arg, lo);
+
+    VecType result = select(hi + lo, VecType(-std::numeric_limits<double>::infinity()), mask_eq(arg, zero));
+    result = select(result, infinity, mask_eq(arg, infinity));
+    return select(result, VecType(std::numeric_limits<double>::quiet_NaN()), mask_lt(arg, zero) | mask_neq(arg, arg));
+}
+
+/* the products of j and the first three parts of pi/4 are exact for |arg| < 2**26, larger lanes are
+ * computed by libm */
+static const double vec_trig_double_precise_max_arg = 67108864.0;
+
+template <typename VecType>
+always_inline typename VecType::int_vec vec_reduce_pi4_double_precise(VecType const & abs_arg, VecType & base, VecType & base_lo)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const double four_over_pi = 1.27323954473516268615107010698011489627567716592367;
+    int_vec j = (abs_arg * VecType(four_over_pi)).truncate_to_int();
+
+    /* cephes: j=(j+1) & (~1) */
+    j = (j + int_vec(1)) & int_vec(~1);
+    const VecType y(j.convert_to_float());
+
+    const VecType a = madd(y, VecType(-7.853981703519821166992188E-1), abs_arg);
+    const VecType p2 = y * VecType(6.954533837699727882863954E-9);
+    const VecType b = a + p2;
+    const VecType b_err = vec_two_sum_error(a, p2, b);
+
+    const VecType p3 = y * VecType(-3.061616966026797e-17);
+    const VecType c = b + p3;
+    const VecType c_err = vec_two_sum_error(b, p3, c);
+
+    const VecType p4 = y * VecType(-3.184158581755475e-25);
+    base = c + p4;
+    base_lo = (vec_two_sum_error(c, p4, base) + c_err) + b_err;
+    return j;
+}
+
+template <typename VecType>
+always_inline VecType vec_sin_poly_double_precise(VecType const & base, VecType const & base_lo, VecType const & z)
+{
+    VecType p = madd(z, VecType(1.58962301576546568060E-10), VecType(-2.50507477628578072866E-8));
+    p = madd(p, z, VecType(2.75573136213857245213E-6));
+    p = madd(p, z, VecType(-1.98412698295895385996E-4));
+    p = madd(p, z, VecType(8.33333333332211858878E-3));
+    p = madd(p, z, VecType(-1.66666666666666307295E-1));
+    return base + madd(base_lo, madd(z, VecType(-0.5), VecType(VecType::gen_one())), p * z * base);
+}
+
+template <typename VecType>
+always_inline VecType vec_cos_poly_double_precise(VecType const & base, VecType const & base_lo, VecType const & z)
+{
+    const VecType one = VecType::gen_one();
+    VecType p = madd(z, VecType(-1.13585365213876817300E-11), VecType(2.08757008419747316778E-9));
+    p = madd(p, z, VecType(-2.75573141792967388112E-7));
+    p = madd(p, z, VecType(2.48015872888517045348E-5));
+    p = madd(p, z, VecType(-1.38888888888730564116E-3));
+    p = madd(p, z, VecType(4.16666666666665929218E-2));
+
+    const VecType h = z * VecType(0.5);
+    const VecType w = one - h;
+    const VecType w_err = ((one - w) - h) - base * base_lo;
+    return w + madd(p * z, z, w_err);
+}
+
+template <typename VecType>
+always_inline VecType vec_sin_double_precise(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType base, base_lo;
+    const int_vec j = vec_reduce_pi4_double_precise(abs_arg, base, base_lo);
+
+    const VecType sign = (arg & VecType::gen_sign_mask()) ^ VecType(slli(j & int_vec(4), 61));
+    const VecType poly_mask = VecType(mask_eq(j & int_vec(2), int_vec(0)));
+
+    const VecType z = base * base;
+    const VecType approximation = select(vec_cos_poly_double_precise(base, base_lo, z),
+                                         vec_sin_poly_double_precise(base, base_lo, z), poly_mask);
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_precise_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_double_precise_max_arg, libm_sin());
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_cos_double_precise(VecType const & arg)
+{
+    typedef typename VecType::int_vec int_vec;
+
+    const VecType abs_arg = arg & VecType::gen_abs_mask();
+    VecType base, base_lo;
+    const int_vec j = vec_reduce_pi4_double_precise(abs_arg, base, base_lo);
+
+    const int_vec jm2 = j - int_vec(2);
+    const VecType sign = VecType(slli(andnot(jm2, int_vec(4)), 61));
+    const VecType poly_mask = VecType(mask_eq(jm2 & int_vec(2), int_vec(0)));
+
+    const VecType z = base * base;
+    const VecType approximation = select(vec_cos_poly_double_precise(base, base_lo, z),
+                                         vec_sin_poly_double_precise(base, base_lo, z), poly_mask);
+    const VecType ret = approximation ^ sign;
+    if (vec_has_large_lanes(abs_arg, vec_trig_double_precise_max_arg))
+        return vec_large_lanes_libm(arg, ret, vec_trig_double_precise_max_arg, libm_cos());
+    return ret;
+}
+
+template <typename VecType>
+always_inline VecType vec_tanh_double_precise(VecType const & arg)
+{
+    const VecType sign_arg = arg & VecType::gen_sign_mask();
+    const VecType abs_arg  = arg ^ sign_arg;
+    const VecType one      = VecType::gen_one();
+    const VecType two(2.0);
+
+    /* medium values: 1 - 2 / (e**2x + 1), carrying the low-order parts of e**2x, of the sum and
+     * of the quotient. the result rounds to 1 for 2x > 44 */
+    VecType p_hi, p_lo, n;
+    vec_exp_double_precise_kernel(min_(abs_arg + abs_arg, VecType(44.0)), VecType(VecType::gen_zero()), p_hi, p_lo, n);
+    const VecType scale = vec_pow2i<VecType>(n.truncate_to_int());
+    const VecType e_hi = p_hi * scale;
+    const VecType d = e_hi + one;
+    const VecType d_lo = vec_fast_two_sum_error(e_hi, one, d) + p_lo * scale;
+
+    const VecType t = two / d;
+    VecType t1, t2, d1, d2;
+    vec_split_double(t, t1, t2);
+    vec_split_double(d, d1, d2);
+    const VecType t_lo = (((((two - t1 * d1) - t1 * d2) - t2 * d1) - t2 * d2) - t * d_lo) / d;
+
+    const VecType r = one - t;
+    const VecType result_medium = (r + (((one - r) - t) - t_lo)) | sign_arg;
+
+    /* small values: x + x**3 P(x**2)/Q(x**2) */
+    const VecType arg_sqr = abs_arg * abs_arg;
+    VecType px = madd(arg_sqr, VecType(-9.64399179425052238628E-1), VecType(-9.92877231001918586564E1));
+    px = madd(px, arg_sqr, VecType(-1.61468768441708447952E3));
+    VecType qx = arg_sqr + VecType(1.12811678491632931402E2);
+    qx = madd(qx, arg_sqr, VecType(2.23548839060100448583E3));
+    qx = madd(qx, arg_sqr, VecType(4.84406305325125486048E3));
+    const VecType result_small = madd(arg * arg_sqr, px / qx, arg);
+
+    const VecType result = select(result_medium, result_small, mask_lt(abs_arg, VecType(0.625)));
+    return select(result, arg, mask_neq(arg, arg));
+}
+
+template <typename VecType>
+always_inline VecType vec_pow_double_precise(VecType const & arg1, VecType const & arg2)
+{
+    const VecType zero = VecType::gen_zero();
+    const VecType one = VecType::gen_one();
+    const VecType infinity(std::numeric_limits<double>::infinity());
+
+    VecType log_lo;
+    const VecType log_hi = vec_log_double_ext(arg1, log_lo);
+
+    VecType y1, y2, l1, l2;
+    vec_split_double(arg2, y1, y2);
+    vec_split_double(log_hi, l1, l2);
+    const VecType prod_hi = y1 * l1;
+    const VecType prod_hi_lo = madd(arg2, log_lo, madd(y2, log_hi, y1 * l2));
+
+    /* the low part is not small compared to the ulp of the high part, so the sum is renormalized before
+     * exp clamps its argument */
+    const VecType prod = prod_hi + prod_hi_lo;
+    const VecType prod_lo = vec_two_sum_error(prod_hi, prod_hi_lo, prod);
+    const VecType saturated = mask_gt(prod & VecType::gen_abs_mask(), VecType(2048.0));
+    VecType result = vec_exp_double_precise_ext(prod, andnot(saturated, prod_lo));
+
+    const VecType y_negative = mask_lt(arg2, zero);
+    result = select(result, andnot(y_negative, infinity), mask_eq(arg1, infinity));
+    result = select(result, y_negative & infinity, mask_eq(arg1, zero));
+    result = select(result, VecType(std::numeric_limits<double>::quiet_NaN()),
+                    mask_lt(arg1, zero) | mask_neq(arg1, arg1) | mask_neq(arg2, arg2));
+    return select(result, one, mask_eq(arg2, zero) | mask_eq(arg1, one));
+}
 
 }
 }
@@ -20,6 +20,7 @@
 #define NOVA_SIMD_DETAIL_WRAP_ARGUMENT_VECTOR_HPP
 
 #include "../vec.hpp"
+#include "../simd_unroll_constraints.hpp"
 
 #include "wrap_arguments.hpp"
 
@@ -33,9 +34,11 @@
 namespace nova {
 namespace detail {
 
-template <typename FloatType>
+template <typename FloatType, bool aligned = true>
 struct vector_pointer_argument
 {
+    typedef vec<FloatType> value_type;
+
     always_inline explicit vector_pointer_argument(const FloatType * arg):
         data(arg)
     {}
@@ -48,24 +51,58 @@ struct vector_pointer_argument
     always_inline vec<FloatType> get(void) const
     {
         vec<FloatType> ret;
-        ret.load_aligned(data);
+        load(ret);
         return ret;
     }
 
     always_inline vec<FloatType> consume(void)
     {
         vec<FloatType> ret;
-        ret.load_aligned(data);
+        load(ret);
         increment();
         return ret;
     }
 
+    /* load the first count < vec<FloatType>::size samples, without reading past the end of the buffer */
+    always_inline vec<FloatType> consume_tail(unsigned int count)
+    {
+        FloatType buffer[vec<FloatType>::size] = {};
+        for (unsigned int i = 0; i != count; ++i)
+            buffer[i] = data[i];
+
+        vec<FloatType> ret;
+        ret.load(buffer);
+        data += count;
+        return ret;
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return vec<FloatType>::is_aligned(data);
+    }
+
+    always_inline void prefetch(std::size_t distance) const
+    {
+        prefetch_ahead(data, distance);
+    }
+
     const FloatType * data;
+
+private:
+    always_inline void load(vec<FloatType> & ret) const
+    {
+        if (aligned)
+            ret.load_aligned(data);
+        else
+            ret.load(data);
+    }
 };
 
 template <typename FloatType>
 struct vector_scalar_argument
 {
+    typedef vec<FloatType> value_type;
+
     always_inline explicit vector_scalar_argument(FloatType const & arg):
         data(arg)
     {}
@@ -83,12 +120,27 @@ struct vector_scalar_argument
         return vec<FloatType>(data);
     }
 
+    always_inline vec<FloatType> consume_tail(unsigned int)
+    {
+        return vec<FloatType>(data);
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return true;
+    }
+
+    always_inline void prefetch(std::size_t) const
+    {}
+
     FloatType data;
 };
 
 template <typename FloatType>
 struct vector_ramp_argument
 {
+    typedef vec<FloatType> value_type;
+
     always_inline vector_ramp_argument(FloatType const & base, FloatType const & slope)
     {
         float vSlope = data.set_slope(base, slope);
@@ -112,10 +164,82 @@ struct vector_ramp_argument
         return ret;
     }
 
+    always_inline vec<FloatType> consume_tail(unsigned int count)
+    {
+        vec<FloatType> ret(data);
+        data += slope_ * vec<FloatType>(FloatType(count) / FloatType(vec<FloatType>::size));
+        return ret;
+    }
+
+    always_inline bool is_aligned(void) const
+    {
+        return true;
+    }
+
+    always_inline void prefetch(std::size_t) const
+    {}
+
     vec<FloatType> data;
     vec<FloatType> slope_;
 };
 
+template <typename Format>
+struct vector_half_argument
+{
+    typedef vec<float> value_type;
+
+    always_inline explicit vector_half_argument(const uint16_t * arg):
+        data(arg)
+    {}
+
+    always_inline void increment(void)
+    {
+        data += vec<float>::size;
+    }
+
+    always_inline vec<float> get(void) const
+    {
+        vec<float> ret;
+        Format::load(ret, data);
+        return ret;
+    }
+
+    always_inline vec<float> consume(void)
+    {
+        vec<float> ret = get();
+        increment();
+        return ret;
+    }
+
+    always_inline vec<float> consume_tail(unsigned int count)
+    {
+        uint16_t buffer[vec<float>::size] = {};
+        for (unsigned int i = 0; i != count; ++i)
+            buffer[i] = data[i];
+
+        vec<float> ret;
+        Format::load(ret, buffer);
+        data += count;
+        return ret;
+    }
+
+    /* the half precision loads are unaligned */
+    always_inline bool is_aligned(void) const
+    {
+        return true;
+    }
+
+    /* distance is given in bytes of single precision samples, the half precision buffer is read at half
+     * the rate */
+    always_inline void prefetch(std::size_t distance) const
+    {
+        if (distance)
+            vec<float>::prefetch(reinterpret_cast<const float*>(data + distance / sizeof(float)));
+    }
+
+    const uint16_t * data;
+};
+
 /* convert scalar args to vector args */
 template <typename FloatType>
 always_inline detail::vector_scalar_argument<FloatType>
@@ -124,11 +248,11 @@ wrap_vector_arg(detail::scalar_scalar_argument<FloatType> const & arg)
     return detail::vector_scalar_argument<FloatType>(arg.data);
 }
 
-template <typename FloatType>
-always_inline detail::vector_pointer_argument<FloatType>
-wrap_vector_arg(detail::scalar_pointer_argument<FloatType> const & arg)
+template <typename FloatType, bool aligned>
+always_inline detail::vector_pointer_argument<FloatType, aligned>
+wrap_vector_arg(detail::scalar_pointer_argument<FloatType, aligned> const & arg)
 {
-    return detail::vector_pointer_argument<FloatType>(arg.data);
+    return detail::vector_pointer_argument<FloatType, aligned>(arg.data);
 }
 
 template <typename FloatType>
@@ -138,6 +262,42 @@ wrap_vector_arg(detail::scalar_ramp_argument<FloatType> const & arg)
     return detail::vector_ramp_argument<FloatType>(arg.data, arg.slope_);
 }
 
+template <typename Format>
+always_inline detail::vector_half_argument<Format>
+wrap_vector_arg(detail::scalar_half_argument<Format> const & arg)
+{
+    return detail::vector_half_argument<Format>(arg.data);
+}
+
+/* use unaligned loads for vector arguments */
+template <typename FloatType, bool aligned>
+always_inline detail::vector_pointer_argument<FloatType, false>
+unaligned_vector_arg(detail::vector_pointer_argument<FloatType, aligned> const & arg)
+{
+    return detail::vector_pointer_argument<FloatType, false>(arg.data);
+}
+
+template <typename FloatType>
+always_inline detail::vector_scalar_argument<FloatType>
+unaligned_vector_arg(detail::vector_scalar_argument<FloatType> const & arg)
+{
+    return arg;
+}
+
+template <typename FloatType>
+always_inline detail::vector_ramp_argument<FloatType>
+unaligned_vector_arg(detail::vector_ramp_argument<FloatType> const & arg)
+{
+    return arg;
+}
+
+template <typename Format>
+always_inline detail::vector_half_argument<Format>
+unaligned_vector_arg(detail::vector_half_argument<Format> const & arg)
+{
+    return arg;
+}
+
 } /* namespace detail */
 } /* namespace nova */
 
@@ -19,6 +19,8 @@
 #ifndef NOVA_SIMD_WRAP_ARGUMENTS_HPP
 #define NOVA_SIMD_WRAP_ARGUMENTS_HPP
 
+#include "half_float.hpp"
+
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
 #else
@@ -29,9 +31,12 @@
 namespace nova {
 namespace detail {
 
-template <typename FloatType>
+/* aligned is only used for vector loads */
+template <typename FloatType, bool aligned = true>
 struct scalar_pointer_argument
 {
+    typedef FloatType value_type;
+
     always_inline explicit scalar_pointer_argument(const FloatType * arg):
         data(arg)
     {}
@@ -59,6 +64,8 @@ struct scalar_pointer_argument
 template <typename FloatType>
 struct scalar_scalar_argument
 {
+    typedef FloatType value_type;
+
     always_inline explicit scalar_scalar_argument(FloatType const & arg):
         data(arg)
     {}
@@ -82,6 +89,8 @@ struct scalar_scalar_argument
 template <typename FloatType>
 struct scalar_ramp_argument
 {
+    typedef FloatType value_type;
+
     always_inline scalar_ramp_argument(FloatType const & base, FloatType const & slope):
         data(base), slope_(slope)
     {}
@@ -107,6 +116,37 @@ struct scalar_ramp_argument
     const FloatType slope_;
 };
 
+/* samples stored in half precision (Format is fp16_format or bf16_format), the computation is done in
+ * single precision */
+template <typename Format>
+struct scalar_half_argument
+{
+    typedef float value_type;
+
+    always_inline explicit scalar_half_argument(const uint16_t * arg):
+        data(arg)
+    {}
+
+    always_inline void increment(void)
+    {
+        data += 1;
+    }
+
+    always_inline float get(void) const
+    {
+        return Format::to_float(*data);
+    }
+
+    always_inline float consume(void)
+    {
+        float ret = get();
+        increment();
+        return ret;
+    }
+
+    const uint16_t * data;
+};
+
 }
 
 always_inline detail::scalar_scalar_argument<float> wrap_argument(float arg)
@@ -142,9 +182,9 @@ wrap_argument(detail::scalar_scalar_argument<FloatType> const & f)
     return f;
 }
 
-template <typename FloatType>
-always_inline detail::scalar_pointer_argument<FloatType>
-wrap_argument(detail::scalar_pointer_argument<FloatType> const & f)
+template <typename FloatType, bool aligned>
+always_inline detail::scalar_pointer_argument<FloatType, aligned>
+wrap_argument(detail::scalar_pointer_argument<FloatType, aligned> const & f)
 {
     return f;
 }
@@ -156,6 +196,13 @@ wrap_argument(detail::scalar_ramp_argument<FloatType> const & f)
     return f;
 }
 
+template <typename Format>
+always_inline detail::scalar_half_argument<Format>
+wrap_argument(detail::scalar_half_argument<Format> const & f)
+{
+    return f;
+}
+
 template <typename FloatType>
 always_inline detail::scalar_scalar_argument<FloatType>
 scalar_argument(FloatType const & f)
@@ -177,6 +224,89 @@ slope_argument(FloatType const & value, FloatType const & slope)
     return wrap_argument(value, slope);
 }
 
+/* alignment policy of vector arguments. plain pointers are assumed to be aligned by the _simd functions
+ * and to be unaligned by the _na_simd functions */
+template <typename FloatType>
+always_inline detail::scalar_pointer_argument<FloatType, true>
+aligned_vector_argument(const FloatType * f)
+{
+    return detail::scalar_pointer_argument<FloatType, true>(f);
+}
+
+template <typename FloatType>
+always_inline detail::scalar_pointer_argument<FloatType, false>
+unaligned_vector_argument(const FloatType * f)
+{
+    return detail::scalar_pointer_argument<FloatType, false>(f);
+}
+
+/* half precision inputs of single precision functions, e.g. plus_vec_simd(out, fp16_argument(cache), in, n).
+ * they have no alignment requirements */
+always_inline detail::scalar_half_argument<detail::fp16_format>
+fp16_argument(const uint16_t * f)
+{
+    return detail::scalar_half_argument<detail::fp16_format>(f);
+}
+
+always_inline detail::scalar_half_argument<detail::bf16_format>
+bf16_argument(const uint16_t * f)
+{
+    return detail::scalar_half_argument<detail::bf16_format>(f);
+}
+
+namespace detail {
+
+/* argument wrappers of the _na_simd functions */
+always_inline scalar_scalar_argument<float> wrap_na_argument(float arg)
+{
+    return scalar_scalar_argument<float>(arg);
+}
+
+always_inline scalar_scalar_argument<double> wrap_na_argument(double arg)
+{
+    return scalar_scalar_argument<double>(arg);
+}
+
+always_inline scalar_pointer_argument<float, false> wrap_na_argument(const float * arg)
+{
+    return scalar_pointer_argument<float, false>(arg);
+}
+
+always_inline scalar_pointer_argument<double, false> wrap_na_argument(const double * arg)
+{
+    return scalar_pointer_argument<double, false>(arg);
+}
+
+template <typename FloatType>
+always_inline scalar_scalar_argument<FloatType>
+wrap_na_argument(scalar_scalar_argument<FloatType> const & f)
+{
+    return f;
+}
+
+template <typename FloatType, bool aligned>
+always_inline scalar_pointer_argument<FloatType, aligned>
+wrap_na_argument(scalar_pointer_argument<FloatType, aligned> const & f)
+{
+    return f;
+}
+
+template <typename FloatType>
+always_inline scalar_ramp_argument<FloatType>
+wrap_na_argument(scalar_ramp_argument<FloatType> const & f)
+{
+    return f;
+}
+
+template <typename Format>
+always_inline scalar_half_argument<Format>
+wrap_na_argument(scalar_half_argument<Format> const & f)
+{
+    return f;
+}
+
+}
+
 }
 
 #undef always_inline
@@ -0,0 +1,82 @@
+# run-time dispatch of the nova simd kernels
+#
+#   include(<nova-simd>/dispatch/nova_simd_dispatch.cmake)
+#   nova_simd_dispatch_objects(<variable> <name> [<compile options>...])
+#   add_executable(foo foo.cpp ${<variable>})
+#
+# nova_simd_dispatch_objects compiles dispatch/simd_dispatch_*.cpp once per target with the flags of the
+# target (and the given compile options) and stores the object files, which need to be linked into the
+# program, in <variable>. <name> is appended to the names of the object libraries, so that the units can
+# be compiled several times with different options.
+#
+# the target units instantiate inline std:: and boost:: functions with the instruction set of their
+# target. each object is partially linked and all symbols but its kernel table are made local, so that
+# the linker cannot pick these copies for other translation units:
+#
+#   ld -r --force-group-allocation -o simd_dispatch_avx2.partial simd_dispatch_avx2.o
+#   objcopy --wildcard --keep-global-symbol='*kernel_tables_*' simd_dispatch_avx2.partial simd_dispatch_avx2.o
+#
+# this requires a gnu linker and objcopy (gcc or clang on linux and other elf platforms). on x86, where
+# there are target units, nova_simd_dispatch_objects stops with an error on other toolchains (msvc, apple
+# platforms), since the program could crash with illegal instructions on cpus that lack one of the target
+# instruction sets. NOVA_SIMD_DISPATCH_SUPPORTED tells, if the dispatch objects can be built, and
+# NOVA_SIMD_DISPATCH_LOCALIZED, if they are localized.
+
+set(nova_simd_dispatch_dir ${CMAKE_CURRENT_LIST_DIR})
+set(nova_simd_dispatch_targets default)
+set(nova_simd_dispatch_flags_default "")
+
+set(NOVA_SIMD_DISPATCH_SUPPORTED TRUE)
+set(NOVA_SIMD_DISPATCH_LOCALIZED FALSE)
+set(nova_simd_dispatch_error "")
+
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "(x86)|(X86)|(amd64)|(AMD64)|(i.86)")
+  list(APPEND nova_simd_dispatch_targets avx avx2 avx512)
+  set(nova_simd_dispatch_flags_avx -mavx)
+  set(nova_simd_dispatch_flags_avx2 -mavx2 -mfma)
+  set(nova_simd_dispatch_flags_avx512 -mavx512f -mfma)
+
+  if(NOT (CMAKE_COMPILER_IS_GNUCXX OR CMAKE_CXX_COMPILER_ID MATCHES "Clang") OR APPLE)
+    set(nova_simd_dispatch_error "the symbols of the dispatch objects can only be made local with gcc or clang on elf platforms")
+  elseif(NOT CMAKE_OBJCOPY)
+    set(nova_simd_dispatch_error "the symbols of the dispatch objects cannot be made local without objcopy")
+  else()
+    execute_process(COMMAND ${CMAKE_LINKER} --help OUTPUT_VARIABLE nova_simd_linker_help ERROR_QUIET)
+    if(NOT nova_simd_linker_help MATCHES "--force-group-allocation")
+      set(nova_simd_dispatch_error "the dispatch objects cannot be partially linked: ${CMAKE_LINKER} does not support --force-group-allocation")
+    endif()
+  endif()
+
+  if(nova_simd_dispatch_error)
+    set(NOVA_SIMD_DISPATCH_SUPPORTED FALSE)
+  else()
+    set(NOVA_SIMD_DISPATCH_LOCALIZED TRUE)
+  endif()
+endif()
+
+function(nova_simd_dispatch_objects result name)
+  if(NOT NOVA_SIMD_DISPATCH_SUPPORTED)
+    message(FATAL_ERROR "${nova_simd_dispatch_error}. the linker could use the avx/avx2/avx512 copies of inline "
+                        "functions of the dispatch objects in other translation units.")
+  endif()
+
+  set(objects)
+  foreach(target ${nova_simd_dispatch_targets})
+    set(library simd_dispatch_${target}${name})
+    add_library(${library} OBJECT ${nova_simd_dispatch_dir}/simd_dispatch_${target}.cpp)
+    target_compile_options(${library} PRIVATE ${nova_simd_dispatch_flags_${target}} ${ARGN})
+
+    if(NOVA_SIMD_DISPATCH_LOCALIZED)
+      set(object ${CMAKE_CURRENT_BINARY_DIR}/${library}.o)
+      add_custom_command(OUTPUT ${object}
+        COMMAND ${CMAKE_LINKER} -r --force-group-allocation -o ${object}.partial $<TARGET_OBJECTS:${library}>
+        COMMAND ${CMAKE_OBJCOPY} --wildcard --keep-global-symbol=*kernel_tables_* ${object}.partial ${object}
+        DEPENDS ${library} $<TARGET_OBJECTS:${library}>
+        VERBATIM)
+      list(APPEND objects ${object})
+    else()
+      list(APPEND objects $<TARGET_OBJECTS:${library}>)
+    endif()
+  endforeach()
+  set(${result} ${objects} PARENT_SCOPE)
+endfunction()
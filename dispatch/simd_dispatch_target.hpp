@@ -0,0 +1,98 @@
+//  instantiate the dispatched kernels for one target
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+/* usage: define NOVA_SIMD_DISPATCH_TARGET to one of default, avx, avx2 or avx512 and include this
+ * file as the only nova-simd header of a translation unit, which is compiled with the matching
+ * instruction set flags.
+ *
+ * the kernels are compiled into a target-specific namespace (by redefining `nova'), so the
+ * different instantiations of vec<> and of the inline functions do not clash at link time. inline
+ * functions of std:: and boost:: are instantiated with the instruction set of the target as well:
+ * the object has to be partially linked and all symbols but the kernel table made local (see README),
+ * otherwise the linker may use these copies in other translation units.
+ */
+
+#ifndef NOVA_SIMD_DISPATCH_TARGET
+#error "NOVA_SIMD_DISPATCH_TARGET needs to be defined"
+#endif
+
+#ifdef VEC_HPP
+#error "simd_dispatch_target.hpp needs to be the only nova-simd header of a translation unit"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+
+#include "../detail/dispatch_table.hpp"
+
+#define NOVA_SIMD_DISPATCH_CONCAT_(A, B) A##B
+#define NOVA_SIMD_DISPATCH_CONCAT(A, B) NOVA_SIMD_DISPATCH_CONCAT_(A, B)
+
+#define nova NOVA_SIMD_DISPATCH_CONCAT(nova_dispatch_, NOVA_SIMD_DISPATCH_TARGET)
+
+#include "../simd_math.hpp"
+#include "../simd_unary_arithmetic.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_unit_conversion.hpp"
+#include "../softclip.hpp"
+
+#undef nova
+
+#define NOVA_SIMD_DISPATCH_NAMESPACE NOVA_SIMD_DISPATCH_CONCAT(nova_dispatch_, NOVA_SIMD_DISPATCH_TARGET)
+
+namespace nova     {
+namespace dispatch {
+namespace detail   {
+
+#define NOVA_SIMD_DISPATCH_UNARY_ENTRY(NAME) &NOVA_SIMD_DISPATCH_NAMESPACE::NAME##_vec_simd,
+#define NOVA_SIMD_DISPATCH_BINARY_ENTRY(NAME) &NOVA_SIMD_DISPATCH_NAMESPACE::NAME##_vec_simd, \
+                                              &NOVA_SIMD_DISPATCH_NAMESPACE::NAME##_vec_simd,
+#define NOVA_SIMD_DISPATCH_TERNARY_ENTRY(NAME) &NOVA_SIMD_DISPATCH_NAMESPACE::NAME##_vec_simd,
+
+#define NOVA_SIMD_DISPATCH_TABLE                                            \
+    {                                                                       \
+        NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_UNARY_ENTRY)     \
+        NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(NOVA_SIMD_DISPATCH_BINARY_ENTRY)   \
+        NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_TERNARY_ENTRY) \
+    }
+
+kernel_tables const & NOVA_SIMD_DISPATCH_CONCAT(kernel_tables_, NOVA_SIMD_DISPATCH_TARGET)(void)
+{
+    /* constant-initialized, so no guard is needed */
+    static const kernel_tables tables = {
+        NOVA_SIMD_DISPATCH_CONCAT(target_, NOVA_SIMD_DISPATCH_TARGET),
+        NOVA_SIMD_DISPATCH_TABLE,
+        NOVA_SIMD_DISPATCH_TABLE
+    };
+    return tables;
+}
+
+#undef NOVA_SIMD_DISPATCH_UNARY_ENTRY
+#undef NOVA_SIMD_DISPATCH_BINARY_ENTRY
+#undef NOVA_SIMD_DISPATCH_TERNARY_ENTRY
+#undef NOVA_SIMD_DISPATCH_TABLE
+
+} /* namespace detail */
+} /* namespace dispatch */
+} /* namespace nova */
+
+#undef NOVA_SIMD_DISPATCH_NAMESPACE
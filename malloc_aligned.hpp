@@ -21,8 +21,7 @@
 
 #include <cstdlib>
 #include <cstring>
-
-#include <boost/noncopyable.hpp>
+#include <new>
 
 #ifdef __SSE2__
 #include <xmmintrin.h>
@@ -34,16 +33,16 @@
 namespace nova
 {
 
-#if _POSIX_C_SOURCE >= 200112L || _XOPEN_SOURCE >= 600
-/* we have posix_memalign */
-
 /* memory alignment constraints:
  *
- * - 16 byte for SSE operations
+ * - 16 byte for SSE operations, 32 byte for avx and 64 byte for avx512 (load_aligned)
  * - the cache lines size of modern x86 cpus is 64 bytes (pentium-m, pentium 4, core, k8)
  */
 const int malloc_memory_alignment = 64;
 
+#if _POSIX_C_SOURCE >= 200112L || _XOPEN_SOURCE >= 600 || defined(__APPLE__)
+/* we have posix_memalign */
+
 inline void* malloc_aligned(std::size_t nbytes)
 {
     void * ret;
@@ -59,26 +58,8 @@ inline void free_aligned(void *ptr)
     free(ptr);
 }
 
-#elif defined(__APPLE__)
-
-const int malloc_memory_alignment = 64;
-
-/* apple's malloc implementation returns 16-byte aligned chunks */
-inline void* malloc_aligned(std::size_t nbytes)
-{
-    return malloc(nbytes);
-}
-
-inline void free_aligned(void *ptr)
-{
-    free(ptr);
-}
-
-
 #elif defined(__SSE2__)
 
-const int malloc_memory_alignment = 64;
-
 inline void* malloc_aligned(std::size_t nbytes)
 {
     return _mm_malloc(nbytes, malloc_memory_alignment);
@@ -107,7 +88,7 @@ inline void free_aligned(void *ptr)
 
 /* on other systems, we use the aligned memory allocation taken
  * from thomas grill's implementation for pd */
-#define VECTORALIGNMENT 128
+#define VECTORALIGNMENT (malloc_memory_alignment * 8)
 inline void* malloc_aligned(std::size_t nbytes)
 {
     void* vec = malloc(nbytes+ (VECTORALIGNMENT/8-1) + sizeof(void *));
@@ -219,15 +200,15 @@ public:
 
 
 template<typename T, typename U>
-bool operator==( aligned_allocator<T> const& left, aligned_allocator<U> const& right )
+bool operator==( aligned_allocator<T> const&, aligned_allocator<U> const& )
 {
-    return !(left != right);
+    return true;
 }
 
 template<typename T, typename U>
-bool operator!=( aligned_allocator<T> const& left, aligned_allocator<U> const& right )
+bool operator!=( aligned_allocator<T> const&, aligned_allocator<U> const& )
 {
-    return true;
+    return false;
 }
 
 
@@ -0,0 +1,347 @@
+//  per-thread pool for aligned sample buffers
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_ALLOCATOR_HPP
+#define SIMD_ALLOCATOR_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "malloc_aligned.hpp"
+
+/* aligned_pool hands out buffers, which are aligned to malloc_memory_alignment (64 bytes), so they can
+ * be passed to all _simd functions. each thread allocates from its own pool without locks or atomic
+ * operations: requests of up to max_block_size bytes are rounded up to a power of two and taken from
+ * the free list of that size, which is refilled from slabs of slab_size bytes. larger buffers are
+ * allocated with malloc_aligned.
+ *
+ * buffers can be freed from any thread. if a buffer is freed by another thread, it is pushed to a
+ * lock-free list of its pool, which the owner takes over once its own free list of that size is empty.
+ * slabs are never returned to the system: when a thread exits, its pool is handed over to the next
+ * thread, which needs one. */
+
+namespace nova {
+
+class aligned_pool
+{
+    struct free_block
+    {
+        free_block * next;
+    };
+
+public:
+    static const std::size_t alignment = malloc_memory_alignment;
+    static const std::size_t min_block_size = malloc_memory_alignment;
+    static const std::size_t max_block_size = 16384;
+    static const std::size_t slab_size = 65536;
+
+    aligned_pool(aligned_pool const &) = delete;
+    aligned_pool & operator=(aligned_pool const &) = delete;
+
+    /* the pool of the calling thread. must not be used from destructors of thread_local objects */
+    static aligned_pool & this_thread(void)
+    {
+        aligned_pool * pool = current();
+        if (pool)
+            return *pool;
+        return attach();
+    }
+
+    /* true, if the pool belongs to the calling thread */
+    bool is_local(void) const
+    {
+        return current() == this;
+    }
+
+    /* returns 0, if no memory is available. must be called from the thread, which owns the pool */
+    void * allocate(std::size_t bytes)
+    {
+        assert(is_local());
+
+        if (bytes > max_block_size)
+            return malloc_aligned(bytes);
+
+        const unsigned int size_class = block_class(bytes);
+        free_block * block = free_list[size_class];
+        if (!block) {
+            block = remote_list[size_class].exchange(nullptr, std::memory_order_acquire);
+            if (!block)
+                return allocate_from_slab(size_class);
+        }
+
+        free_list[size_class] = block->next;
+        return block;
+    }
+
+    /* bytes has to match the size, which has been passed to allocate. can be called from any thread */
+    void deallocate(void * ptr, std::size_t bytes)
+    {
+        if (!ptr)
+            return;
+
+        if (bytes > max_block_size) {
+            free_aligned(ptr);
+            return;
+        }
+
+        const unsigned int size_class = block_class(bytes);
+        free_block * block = static_cast<free_block*>(ptr);
+
+        if (is_local()) {
+            block->next = free_list[size_class];
+            free_list[size_class] = block;
+        } else {
+            std::atomic<free_block*> & list = remote_list[size_class];
+            block->next = list.load(std::memory_order_relaxed);
+            while (!list.compare_exchange_weak(block->next, block, std::memory_order_release,
+                                               std::memory_order_relaxed))
+                ;
+        }
+    }
+
+private:
+    static const unsigned int class_count = 9; /* 64 bytes to max_block_size */
+
+    aligned_pool(void):
+        slab(nullptr), slab_end(nullptr)
+    {
+        for (unsigned int i = 0; i != class_count; ++i) {
+            free_list[i] = nullptr;
+            remote_list[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    static unsigned int block_class(std::size_t bytes)
+    {
+        unsigned int ret = 0;
+        for (std::size_t block_size = min_block_size; block_size < bytes; block_size *= 2)
+            ++ret;
+        return ret;
+    }
+
+    void push_block(void * ptr, unsigned int size_class)
+    {
+        free_block * block = static_cast<free_block*>(ptr);
+        block->next = free_list[size_class];
+        free_list[size_class] = block;
+    }
+
+    void * allocate_from_slab(unsigned int size_class)
+    {
+        const std::size_t block_size = min_block_size << size_class;
+
+        if (std::size_t(slab_end - slab) < block_size) {
+            /* the rest of the slab is a multiple of min_block_size, it is split into free blocks */
+            for (unsigned int i = size_class; i-- != 0;) {
+                const std::size_t size = min_block_size << i;
+                if (std::size_t(slab_end - slab) >= size) {
+                    push_block(slab, i);
+                    slab += size;
+                }
+            }
+
+            slab = static_cast<char*>(malloc_aligned(slab_size));
+            if (!slab) {
+                slab_end = nullptr;
+                return 0;
+            }
+            slab_end = slab + slab_size;
+        }
+
+        void * ret = slab;
+        slab += block_size;
+        return ret;
+    }
+
+    /* pools of exited threads */
+    struct registry
+    {
+        registry(void):
+            pool_count(0)
+        {}
+
+        std::mutex mutex;
+        std::vector<aligned_pool*> abandoned;
+        std::size_t pool_count;
+    };
+
+    static registry & pool_registry(void)
+    {
+        /* never destroyed, threads may exit during static destruction */
+        static registry * ret = new registry;
+        return *ret;
+    }
+
+    static aligned_pool * acquire(void)
+    {
+        registry & pools = pool_registry();
+        std::lock_guard<std::mutex> lock(pools.mutex);
+
+        if (!pools.abandoned.empty()) {
+            aligned_pool * ret = pools.abandoned.back();
+            pools.abandoned.pop_back();
+            return ret;
+        }
+
+        /* release must not allocate, since it is called from a destructor */
+        pools.abandoned.reserve(pools.pool_count + 1);
+
+        void * memory = malloc_aligned(sizeof(aligned_pool));
+        if (!memory)
+            throw std::bad_alloc();
+        ++pools.pool_count;
+        return new(memory) aligned_pool();
+    }
+
+    static void release(aligned_pool * pool)
+    {
+        registry & pools = pool_registry();
+        std::lock_guard<std::mutex> lock(pools.mutex);
+        pools.abandoned.push_back(pool);
+    }
+
+    struct thread_handle
+    {
+        thread_handle(void):
+            pool(acquire())
+        {}
+
+        ~thread_handle(void)
+        {
+            current() = nullptr;
+            release(pool);
+        }
+
+        aligned_pool * pool;
+    };
+
+    static aligned_pool *& current(void)
+    {
+        static thread_local aligned_pool * pool = nullptr;
+        return pool;
+    }
+
+    static aligned_pool & attach(void)
+    {
+        static thread_local thread_handle handle;
+        current() = handle.pool;
+        return *handle.pool;
+    }
+
+    free_block * free_list[class_count];
+    char * slab;
+    char * slab_end;
+
+    /* written by other threads */
+    alignas(malloc_memory_alignment) std::atomic<free_block*> remote_list[class_count];
+};
+
+
+/* std-compatible allocator, which allocates from an aligned_pool, by default from the pool of the
+ * thread constructing the allocator. containers, which grow in another thread, allocate from the pool
+ * of that thread, and copies of a container use the pool of the copying thread. all pools can free
+ * all blocks, so containers can be destroyed from any thread */
+template <typename T>
+class pool_allocator
+{
+public:
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+    typedef T         value_type;
+
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    template <class U> struct rebind
+    {
+        typedef pool_allocator<U> other;
+    };
+
+    pool_allocator(void):
+        pool_ptr(&aligned_pool::this_thread())
+    {}
+
+    explicit pool_allocator(aligned_pool & pool):
+        pool_ptr(&pool)
+    {}
+
+    template <typename U>
+    pool_allocator(pool_allocator<U> const & rhs):
+        pool_ptr(&rhs.pool())
+    {}
+
+    pool_allocator select_on_container_copy_construction(void) const
+    {
+        return pool_allocator();
+    }
+
+    pointer allocate(size_type n)
+    {
+        if (n > max_size())
+            throw std::bad_alloc();
+
+        aligned_pool & pool = pool_ptr->is_local() ? *pool_ptr : aligned_pool::this_thread();
+        void * ret = pool.allocate(n * sizeof(T));
+        if (ret == 0)
+            throw std::bad_alloc();
+        return static_cast<pointer>(ret);
+    }
+
+    void deallocate(pointer p, size_type n)
+    {
+        pool_ptr->deallocate(p, n * sizeof(T));
+    }
+
+    size_type max_size() const
+    {
+        return size_type(-1) / sizeof(T);
+    }
+
+    aligned_pool & pool(void) const
+    {
+        return *pool_ptr;
+    }
+
+private:
+    aligned_pool * pool_ptr;
+};
+
+template<typename T, typename U>
+bool operator==(pool_allocator<T> const & left, pool_allocator<U> const & right)
+{
+    return &left.pool() == &right.pool();
+}
+
+template<typename T, typename U>
+bool operator!=(pool_allocator<T> const & left, pool_allocator<U> const & right)
+{
+    return !(left == right);
+}
+
+}
+
+#endif /* SIMD_ALLOCATOR_HPP */
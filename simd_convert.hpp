@@ -0,0 +1,507 @@
+//  conversion between float and integer pcm formats
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_CONVERT_HPP
+#define SIMD_CONVERT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+
+#include "vec.hpp"
+
+#include "detail/table_index.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* full scale is 2**(bits-1): int16 -32768 maps to -1.0, 1.0 maps to 32767 after saturation. float
+ * samples are rounded to the nearest integer (ties to even) and saturated to the integer range.
+ * 24bit samples are packed, three bytes per sample, little endian.
+ *
+ * the simd functions need n to be a multiple of vec<F>::size and an aligned float buffer, the
+ * integer buffer has no alignment requirements */
+
+namespace nova {
+namespace pcm {
+
+struct int16
+{
+    typedef int16_t sample_type;
+    static const int bits = 16;
+
+    static always_inline int32_t load(const sample_type * buffer, unsigned int index)
+    {
+        return buffer[index];
+    }
+
+    static always_inline void store(sample_type * buffer, unsigned int index, int32_t value)
+    {
+        buffer[index] = int16_t(value);
+    }
+};
+
+struct int24
+{
+    typedef uint8_t sample_type;
+    static const int bits = 24;
+
+    static always_inline int32_t load(const sample_type * buffer, unsigned int index)
+    {
+        const sample_type * sample = buffer + 3 * index;
+        const uint32_t value = uint32_t(sample[0]) | (uint32_t(sample[1]) << 8) | (uint32_t(sample[2]) << 16);
+        return int32_t(value << 8) >> 8; /* sign extension */
+    }
+
+    static always_inline void store(sample_type * buffer, unsigned int index, int32_t value)
+    {
+        sample_type * sample = buffer + 3 * index;
+        sample[0] = uint8_t(value);
+        sample[1] = uint8_t(value >> 8);
+        sample[2] = uint8_t(value >> 16);
+    }
+};
+
+struct int32
+{
+    typedef int32_t sample_type;
+    static const int bits = 32;
+
+    static always_inline int32_t load(const sample_type * buffer, unsigned int index)
+    {
+        return buffer[index];
+    }
+
+    static always_inline void store(sample_type * buffer, unsigned int index, int32_t value)
+    {
+        buffer[index] = value;
+    }
+};
+
+}
+
+namespace detail {
+
+template <typename Format, typename F>
+struct pcm_range
+{
+    static F scale(void)        { return F(std::ldexp(1.0, Format::bits - 1)); }
+    static F reciprocal(void)   { return F(std::ldexp(1.0, 1 - Format::bits)); }
+    static F minimum(void)      { return -scale(); }
+
+    /* 2**31 - 1 rounds up to 2**31 in single precision, the largest float below is 2**31 - 128 */
+    static F maximum(void)
+    {
+        const double max_int = std::ldexp(1.0, Format::bits - 1) - 1.0;
+        return double(F(max_int)) <= max_int ? F(max_int) : F(max_int - 127.0);
+    }
+};
+
+template <typename F>
+struct xorshift_traits;
+
+template <>
+struct xorshift_traits<float>
+{
+    typedef uint32_t bits_type;
+    static const int shift1 = 13, shift2 = 17, shift3 = 5;
+    static const int mantissa_shift = 9;         /* 32 - 23 */
+};
+
+template <>
+struct xorshift_traits<double>
+{
+    typedef uint64_t bits_type;
+    static const int shift1 = 13, shift2 = 7, shift3 = 17;
+    static const int mantissa_shift = 12;        /* 64 - 52 */
+};
+
+/* one xorshift step in each lane and the uniform distribution in [0, 1) from the upper bits of the state.
+ * the state is kept in the bits of a float vector. backends without int_vec work lane by lane on the
+ * same bits, so they produce the same sequence */
+template <typename VecType, typename Enable = void>
+struct xorshift_lanes
+{
+    typedef typename VecType::float_type float_type;
+    typedef xorshift_traits<float_type> traits;
+    typedef typename traits::bits_type bits_type;
+
+    static VecType step(VecType const & state)
+    {
+        bits_type lanes[VecType::size];
+        state.store(reinterpret_cast<float_type*>(lanes));
+        for (int i = 0; i != VecType::size; ++i) {
+            bits_type x = lanes[i];
+            x ^= x << traits::shift1;
+            x ^= x >> traits::shift2;
+            x ^= x << traits::shift3;
+            lanes[i] = x;
+        }
+
+        VecType ret;
+        ret.load(reinterpret_cast<const float_type*>(lanes));
+        return ret;
+    }
+
+    static VecType uniform(VecType const & state)
+    {
+        const int mantissa_bits = 8 * sizeof(bits_type) - traits::mantissa_shift;
+        const float_type scale = float_type(std::ldexp(1.0, -mantissa_bits));
+
+        bits_type lanes[VecType::size];
+        state.store(reinterpret_cast<float_type*>(lanes));
+
+        VecType ret;
+        for (int i = 0; i != VecType::size; ++i)
+            ret.set(i, float_type(lanes[i] >> traits::mantissa_shift) * scale);
+        return ret;
+    }
+};
+
+template <typename VecType>
+struct xorshift_lanes<VecType, typename void_type<typename VecType::int_vec>::type>
+{
+    typedef typename VecType::int_vec int_vec;
+    typedef xorshift_traits<typename VecType::float_type> traits;
+
+    static always_inline VecType step(VecType const & state)
+    {
+        VecType x = state;
+        x = x ^ VecType(slli(int_vec(x), traits::shift1));
+        x = x ^ VecType(srli(int_vec(x), traits::shift2));
+        x = x ^ VecType(slli(int_vec(x), traits::shift3));
+        return x;
+    }
+
+    /* the upper bits of the state become the mantissa of [1, 2) */
+    static always_inline VecType uniform(VecType const & state)
+    {
+        const VecType one(1.0);
+        return (VecType(srli(int_vec(state), traits::mantissa_shift)) | one) - one;
+    }
+};
+
+struct no_dither
+{
+    template <typename ValueType>
+    always_inline ValueType operator()(ValueType const & arg)
+    {
+        return arg;
+    }
+};
+
+}
+
+/* triangular (tpdf) dither with a peak amplitude of one lsb, the sum of two uniform distributions.
+ * the scalar and the vector generator produce different sequences */
+template <typename F>
+class tpdf_dither
+{
+    typedef detail::xorshift_traits<F> traits;
+    typedef typename traits::bits_type bits_type;
+
+public:
+    explicit tpdf_dither(uint32_t seed = 1):
+        scalar_state_(seed ? seed : 1)
+    {
+        bits_type lanes[vec<F>::size];
+        for (int i = 0; i != vec<F>::size; ++i) {
+            const uint32_t high = next_bits();
+            const uint32_t low  = next_bits();
+            lanes[i] = sizeof(bits_type) == 8 ? bits_type((uint64_t(high) << 32) | low) : bits_type(high);
+        }
+        vector_state_.load(reinterpret_cast<const F*>(lanes));
+    }
+
+    /* arg is given in lsb */
+    F operator()(F arg)
+    {
+        const F scale = F(1.0 / 16777216.0);
+        const F first  = F(next_bits() >> 8) * scale;
+        const F second = F(next_bits() >> 8) * scale;
+        return arg + (first + second - F(1));
+    }
+
+    vec<F> operator()(vec<F> const & arg)
+    {
+        typedef detail::xorshift_lanes<vec<F> > lanes;
+        vector_state_ = lanes::step(vector_state_);
+        const vec<F> first = lanes::uniform(vector_state_);
+        vector_state_ = lanes::step(vector_state_);
+        const vec<F> second = lanes::uniform(vector_state_);
+        return arg + (first + second - vec<F>(1.0));
+    }
+
+private:
+    uint32_t next_bits(void)
+    {
+        uint32_t x = scalar_state_;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        scalar_state_ = x;
+        return x;
+    }
+
+    vec<F> vector_state_;
+    uint32_t scalar_state_;
+};
+
+namespace detail {
+
+template <typename Format, typename F>
+inline void pcm_to_float(F * out, const typename Format::sample_type * in, unsigned int n)
+{
+    const F reciprocal = pcm_range<Format, F>::reciprocal();
+    for (unsigned int i = 0; i != n; ++i)
+        out[i] = F(Format::load(in, i)) * reciprocal;
+}
+
+/* the simd conversion loads int32 samples into int_vec lanes and converts them with convert_to_float.
+ * 24bit samples have no vector load and are widened well by the compiler. the int_vec of double has
+ * 64bit lanes, so double and backends without int_vec use the scalar loop as well */
+template <typename Format, typename F, typename VecType = vec<F>, typename Enable = void>
+struct pcm_to_float_lanes
+{
+    static void convert(F * out, const typename Format::sample_type * in, unsigned int n)
+    {
+        pcm_to_float<Format>(out, in, n);
+    }
+};
+
+template <typename VecType>
+struct pcm_to_float_lanes<pcm::int32, float, VecType, typename void_type<typename VecType::int_vec>::type>
+{
+    typedef typename VecType::int_vec int_vec;
+
+    static always_inline void convert(float * out, const int32_t * in, unsigned int n)
+    {
+        const VecType reciprocal(pcm_range<pcm::int32, float>::reciprocal());
+
+        for (unsigned int i = 0; i != n; i += VecType::size) {
+            VecType bits;
+            bits.load(reinterpret_cast<const float*>(in + i));
+            const VecType value(int_vec(bits).convert_to_float());
+            (value * reciprocal).store_aligned(out + i);
+        }
+    }
+};
+
+template <typename VecType, void (VecType::*)(const int16_t *)>
+struct int16_load_member
+{
+    typedef void type;
+};
+
+/* int16 samples are sign-extended to int32 lanes by the load_int16 member of the backends, which have a
+ * widening load (sse4.1, avx, avx512 and neon). the other backends keep the scalar loop, which the
+ * compiler vectorizes with its own widening sequence */
+template <typename VecType>
+struct pcm_to_float_lanes<pcm::int16, float, VecType,
+                          typename int16_load_member<VecType, &VecType::load_int16>::type>
+{
+    static always_inline void convert(float * out, const int16_t * in, unsigned int n)
+    {
+        const unsigned int size = VecType::size;
+        const VecType reciprocal(pcm_range<pcm::int16, float>::reciprocal());
+
+        unsigned int i = 0;
+        for (; i + 2 * size <= n; i += 2 * size) {
+            VecType first, second;
+            first.load_int16(in + i);
+            second.load_int16(in + i + size);
+            (first * reciprocal).store_aligned(out + i);
+            (second * reciprocal).store_aligned(out + i + size);
+        }
+
+        if (i != n) {
+            VecType value;
+            value.load_int16(in + i);
+            (value * reciprocal).store_aligned(out + i);
+        }
+    }
+};
+
+template <typename Format, typename F>
+inline void pcm_to_float_simd(F * out, const typename Format::sample_type * in, unsigned int n)
+{
+    pcm_to_float_lanes<Format, F>::convert(out, in, n);
+}
+
+template <typename Format, typename F, typename Dither>
+inline void float_to_pcm(typename Format::sample_type * out, const F * in, unsigned int n, Dither & dither)
+{
+    typedef pcm_range<Format, F> range;
+    const F scale = range::scale();
+    const F minimum = range::minimum();
+    const F maximum = range::maximum();
+
+    for (unsigned int i = 0; i != n; ++i) {
+        const F scaled = dither(in[i] * scale);
+        const F clipped = scaled == scaled ? std::max(std::min(scaled, maximum), minimum)
+                                           : F(0); /* nan */
+        Format::store(out, i, int32_t(std::nearbyint(clipped)));
+    }
+}
+
+/* the simd function works on blocks of pcm_block samples. the samples are scaled, dithered, saturated,
+ * rounded and converted to integer lanes in vector registers, the narrowing to the pcm format is a
+ * separate loop over the block. with int_vec the lanes have the width of the float type (32bit for
+ * float, 64bit for double). backends without int_vec round lane by lane with nearbyint and convert to
+ * int32_t, their vec::round rounds ties away from zero. nan samples are converted to 0 like in the
+ * scalar loop, the conversion of nan to an integer would be undefined */
+static const unsigned int pcm_block = 64;
+
+template <typename VecType, typename Enable = void>
+struct pcm_lanes
+{
+    typedef int32_t type;
+
+    /* nan passes min_ and max_ of these backends, it is caught in store */
+    static VecType clip(VecType const & value, VecType const & minimum, VecType const & maximum)
+    {
+        return max_(min_(value, maximum), minimum);
+    }
+
+    static void store(VecType const & value, type * lanes)
+    {
+        for (int i = 0; i != VecType::size; ++i) {
+            const typename VecType::float_type sample = value.get(i);
+            lanes[i] = sample == sample ? int32_t(std::nearbyint(sample)) : 0;
+        }
+    }
+};
+
+template <typename F>
+struct pcm_lane;
+
+template <>
+struct pcm_lane<float>
+{
+    typedef int32_t type;
+};
+
+template <>
+struct pcm_lane<double>
+{
+    typedef int64_t type;
+};
+
+template <typename VecType>
+struct pcm_lanes<VecType, typename void_type<typename VecType::int_vec>::type>
+{
+    typedef typename VecType::float_type float_type;
+    typedef typename pcm_lane<float_type>::type type;
+
+    /* min_ and max_ may return either operand for nan, so nan lanes are cleared after clipping */
+    static always_inline VecType clip(VecType const & value, VecType const & minimum, VecType const & maximum)
+    {
+        const VecType clipped = max_(min_(value, maximum), minimum);
+        return select(clipped, VecType::gen_zero(), mask_neq(value, value));
+    }
+
+    static always_inline void store(VecType const & value, type * lanes)
+    {
+        VecType(round(value).truncate_to_int()).store(reinterpret_cast<float_type*>(lanes));
+    }
+};
+
+template <typename Format, typename F, typename Dither>
+inline void float_to_pcm_simd(typename Format::sample_type * out, const F * in, unsigned int n, Dither & dither)
+{
+    typedef pcm_range<Format, F> range;
+    typedef pcm_lanes<vec<F> > lane_traits;
+    typedef typename lane_traits::type lane_type;
+    const unsigned int size = vec<F>::size;
+    const vec<F> scale(range::scale());
+    const vec<F> minimum(range::minimum());
+    const vec<F> maximum(range::maximum());
+
+    for (unsigned int i = 0; i < n; i += pcm_block) {
+        const unsigned int count = std::min(pcm_block, n - i);
+
+        lane_type lanes[pcm_block];
+        for (unsigned int j = 0; j != count; j += size) {
+            vec<F> value;
+            value.load_aligned(in + i + j);
+            value = dither(value * scale);
+            lane_traits::store(lane_traits::clip(value, minimum, maximum), lanes + j);
+        }
+
+        for (unsigned int j = 0; j != count; ++j)
+            Format::store(out, i + j, int32_t(lanes[j]));
+    }
+}
+
+}
+
+#define PCM_CONVERSION_FUNCTIONS(format)                                                                        \
+template <typename F>                                                                                           \
+inline void format##_to_float_vec(F * out, const pcm::format::sample_type * in, unsigned int n)                 \
+{                                                                                                               \
+    detail::pcm_to_float<pcm::format>(out, in, n);                                                              \
+}                                                                                                               \
+                                                                                                                \
+template <typename F>                                                                                           \
+inline void format##_to_float_vec_simd(F * out, const pcm::format::sample_type * in, unsigned int n)            \
+{                                                                                                               \
+    detail::pcm_to_float_simd<pcm::format>(out, in, n);                                                         \
+}                                                                                                               \
+                                                                                                                \
+template <typename F>                                                                                           \
+inline void float_to_##format##_vec(pcm::format::sample_type * out, const F * in, unsigned int n)               \
+{                                                                                                               \
+    detail::no_dither dither;                                                                                   \
+    detail::float_to_pcm<pcm::format>(out, in, n, dither);                                                      \
+}                                                                                                               \
+                                                                                                                \
+template <typename F>                                                                                           \
+inline void float_to_##format##_vec(pcm::format::sample_type * out, const F * in, unsigned int n,               \
+                                    tpdf_dither<F> & dither)                                                    \
+{                                                                                                               \
+    detail::float_to_pcm<pcm::format>(out, in, n, dither);                                                      \
+}                                                                                                               \
+                                                                                                                \
+template <typename F>                                                                                           \
+inline void float_to_##format##_vec_simd(pcm::format::sample_type * out, const F * in, unsigned int n)          \
+{                                                                                                               \
+    detail::no_dither dither;                                                                                   \
+    detail::float_to_pcm_simd<pcm::format>(out, in, n, dither);                                                 \
+}                                                                                                               \
+                                                                                                                \
+template <typename F>                                                                                           \
+inline void float_to_##format##_vec_simd(pcm::format::sample_type * out, const F * in, unsigned int n,          \
+                                         tpdf_dither<F> & dither)                                               \
+{                                                                                                               \
+    detail::float_to_pcm_simd<pcm::format>(out, in, n, dither);                                                 \
+}
+
+PCM_CONVERSION_FUNCTIONS(int16)
+PCM_CONVERSION_FUNCTIONS(int24)
+PCM_CONVERSION_FUNCTIONS(int32)
+
+#undef PCM_CONVERSION_FUNCTIONS
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_CONVERT_HPP */
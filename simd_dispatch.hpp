@@ -0,0 +1,323 @@
+//  runtime cpu dispatching of the simd functions
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_DISPATCH_HPP
+#define SIMD_DISPATCH_HPP
+
+/* the functions in nova::dispatch mirror the run-time unrolled *_vec_simd functions for buffer
+ * arguments, but select the instruction set at run time.
+ *
+ * the kernels are compiled for each target in dispatch/simd_dispatch_*.cpp, which need to be
+ * compiled with the matching compiler flags and linked into the program. on the first call, the
+ * best target supported by the cpu is selected. afterwards each call is a single indirect call
+ * through a function pointer table.
+ *
+ * buffers need to fulfill the constraints of all targets: 64-byte aligned and the number of
+ * samples a multiple of 64 bytes.
+ */
+
+#include <atomic>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "detail/dispatch_table.hpp"
+
+namespace nova     {
+namespace dispatch {
+
+inline bool target_supported(simd_target target)
+{
+    switch (target) {
+    case target_default:
+        return true;
+
+#ifdef NOVA_SIMD_DISPATCH_X86
+#if defined(__GNUC__)
+    /* __builtin_cpu_supports also checks, if the os saves the extended register state */
+    case target_avx:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx");
+
+    case target_avx2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+
+    case target_avx512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma");
+
+#elif defined(_MSC_VER)
+    case target_avx:
+    case target_avx2:
+    case target_avx512:
+    {
+        int info[4];
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx     = (info[2] & (1 << 28)) != 0;
+        const bool fma     = (info[2] & (1 << 12)) != 0;
+        if (!osxsave || !avx)
+            return false;
+
+        const unsigned long long xcr0 = _xgetbv(0);
+        if ((xcr0 & 0x6) != 0x6) // xmm and ymm state
+            return false;
+        if (target == target_avx)
+            return true;
+
+        __cpuidex(info, 7, 0);
+        if (!fma)
+            return false;
+        if (target == target_avx2)
+            return (info[1] & (1 << 5)) != 0;
+
+        return (info[1] & (1 << 16)) != 0 && (xcr0 & 0xe6) == 0xe6; // opmask and zmm state
+    }
+#endif
+#endif
+
+    default:
+        return false;
+    }
+}
+
+inline simd_target best_target(void)
+{
+    for (int target = target_count - 1; target != target_default; --target) {
+        if (target_supported(simd_target(target)))
+            return simd_target(target);
+    }
+    return target_default;
+}
+
+namespace detail {
+
+inline kernel_tables const & tables_for_target(simd_target target)
+{
+    switch (target) {
+#ifdef NOVA_SIMD_DISPATCH_X86
+    case target_avx:
+        return kernel_tables_avx();
+
+    case target_avx2:
+        return kernel_tables_avx2();
+
+    case target_avx512:
+        return kernel_tables_avx512();
+#endif
+
+    default:
+        return kernel_tables_default();
+    }
+}
+
+template <typename FloatType>
+struct kernels_of;
+
+template <>
+struct kernels_of<float>
+{
+    static kernel_table<float> const & get(kernel_tables const & tables)
+    {
+        return tables.float_kernels;
+    }
+};
+
+template <>
+struct kernels_of<double>
+{
+    static kernel_table<double> const & get(kernel_tables const & tables)
+    {
+        return tables.double_kernels;
+    }
+};
+
+template <typename FloatType>
+struct active_table
+{
+    static std::atomic<kernel_table<FloatType> const *> pointer;
+
+    static kernel_table<FloatType> const & get(void)
+    {
+        return *pointer.load(std::memory_order_relaxed);
+    }
+};
+
+template <typename Dummy = void>
+struct active_target
+{
+    static std::atomic<kernel_tables const *> tables;
+};
+
+template <typename Dummy>
+std::atomic<kernel_tables const *> active_target<Dummy>::tables(nullptr);
+
+inline void install_tables(kernel_tables const & tables)
+{
+    active_target<>::tables.store(&tables, std::memory_order_relaxed);
+    active_table<float>::pointer.store(&tables.float_kernels, std::memory_order_relaxed);
+    active_table<double>::pointer.store(&tables.double_kernels, std::memory_order_relaxed);
+}
+
+inline kernel_tables const * resolve_target(void)
+{
+    kernel_tables const * tables = active_target<>::tables.load(std::memory_order_relaxed);
+    if (tables)
+        return tables;
+
+    kernel_tables const & best = tables_for_target(best_target());
+    install_tables(best);
+    return &best;
+}
+
+/* the initial table forwards to the resolver, so the table pointer can be constant-initialized
+ * and no check is needed on the fast path */
+template <typename FloatType>
+struct resolver_stubs
+{
+    typedef kernel_table<FloatType> table;
+
+    static table const & resolved(void)
+    {
+        return kernels_of<FloatType>::get(*resolve_target());
+    }
+
+#define NOVA_SIMD_DISPATCH_UNARY_STUB(NAME)                                     \
+    static void NAME(FloatType * out, const FloatType * arg, unsigned int n)    \
+    {                                                                           \
+        resolved().NAME(out, arg, n);                                           \
+    }
+
+#define NOVA_SIMD_DISPATCH_BINARY_STUB(NAME)                                    \
+    static void NAME(FloatType * out, const FloatType * arg1,                   \
+                     const FloatType * arg2, unsigned int n)                    \
+    {                                                                           \
+        resolved().NAME(out, arg1, arg2, n);                                    \
+    }                                                                           \
+                                                                                \
+    static void NAME##_scalar(FloatType * out, const FloatType * arg1,          \
+                              FloatType arg2, unsigned int n)                   \
+    {                                                                           \
+        resolved().NAME##_scalar(out, arg1, arg2, n);                           \
+    }
+
+#define NOVA_SIMD_DISPATCH_TERNARY_STUB(NAME)                                   \
+    static void NAME(FloatType * out, const FloatType * arg1,                   \
+                     const FloatType * arg2, const FloatType * arg3,            \
+                     unsigned int n)                                            \
+    {                                                                           \
+        resolved().NAME(out, arg1, arg2, arg3, n);                              \
+    }
+
+    NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_UNARY_STUB)
+    NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(NOVA_SIMD_DISPATCH_BINARY_STUB)
+    NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_TERNARY_STUB)
+
+#undef NOVA_SIMD_DISPATCH_UNARY_STUB
+#undef NOVA_SIMD_DISPATCH_BINARY_STUB
+#undef NOVA_SIMD_DISPATCH_TERNARY_STUB
+};
+
+#define NOVA_SIMD_DISPATCH_UNARY_STUB_ENTRY(NAME) &resolver_stubs<FloatType>::NAME,
+#define NOVA_SIMD_DISPATCH_BINARY_STUB_ENTRY(NAME) &resolver_stubs<FloatType>::NAME, \
+                                                   &resolver_stubs<FloatType>::NAME##_scalar,
+#define NOVA_SIMD_DISPATCH_TERNARY_STUB_ENTRY(NAME) &resolver_stubs<FloatType>::NAME,
+
+template <typename FloatType>
+struct resolver_table
+{
+    static const kernel_table<FloatType> table;
+};
+
+template <typename FloatType>
+const kernel_table<FloatType> resolver_table<FloatType>::table = {
+    NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_UNARY_STUB_ENTRY)
+    NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(NOVA_SIMD_DISPATCH_BINARY_STUB_ENTRY)
+    NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_TERNARY_STUB_ENTRY)
+};
+
+#undef NOVA_SIMD_DISPATCH_UNARY_STUB_ENTRY
+#undef NOVA_SIMD_DISPATCH_BINARY_STUB_ENTRY
+#undef NOVA_SIMD_DISPATCH_TERNARY_STUB_ENTRY
+
+template <typename FloatType>
+std::atomic<kernel_table<FloatType> const *> active_table<FloatType>::pointer(&resolver_table<FloatType>::table);
+
+} /* namespace detail */
+
+/** force a specific target. returns false, if it is not supported by the cpu */
+inline bool set_target(simd_target target)
+{
+    if (!target_supported(target))
+        return false;
+    detail::install_tables(detail::tables_for_target(target));
+    return true;
+}
+
+/** currently selected target. selects the best target, if no function has been called, yet */
+inline simd_target current_target(void)
+{
+    return detail::resolve_target()->target;
+}
+
+
+#define NOVA_SIMD_DISPATCH_UNARY_FUNCTION(NAME)                                 \
+template <typename FloatType>                                                   \
+inline void NAME##_vec_simd(FloatType * out, const FloatType * arg, unsigned int n) \
+{                                                                               \
+    detail::active_table<FloatType>::get().NAME(out, arg, n);                   \
+}
+
+#define NOVA_SIMD_DISPATCH_BINARY_FUNCTION(NAME)                                \
+template <typename FloatType>                                                   \
+inline void NAME##_vec_simd(FloatType * out, const FloatType * arg1,            \
+                            const FloatType * arg2, unsigned int n)             \
+{                                                                               \
+    detail::active_table<FloatType>::get().NAME(out, arg1, arg2, n);            \
+}                                                                               \
+                                                                                \
+template <typename FloatType>                                                   \
+inline void NAME##_vec_simd(FloatType * out, const FloatType * arg1,            \
+                            FloatType arg2, unsigned int n)                     \
+{                                                                               \
+    detail::active_table<FloatType>::get().NAME##_scalar(out, arg1, arg2, n);   \
+}
+
+#define NOVA_SIMD_DISPATCH_TERNARY_FUNCTION(NAME)                               \
+template <typename FloatType>                                                   \
+inline void NAME##_vec_simd(FloatType * out, const FloatType * arg1,            \
+                            const FloatType * arg2, const FloatType * arg3,     \
+                            unsigned int n)                                     \
+{                                                                               \
+    detail::active_table<FloatType>::get().NAME(out, arg1, arg2, arg3, n);      \
+}
+
+NOVA_SIMD_DISPATCH_UNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_UNARY_FUNCTION)
+NOVA_SIMD_DISPATCH_BINARY_FUNCTIONS(NOVA_SIMD_DISPATCH_BINARY_FUNCTION)
+NOVA_SIMD_DISPATCH_TERNARY_FUNCTIONS(NOVA_SIMD_DISPATCH_TERNARY_FUNCTION)
+
+#undef NOVA_SIMD_DISPATCH_UNARY_FUNCTION
+#undef NOVA_SIMD_DISPATCH_BINARY_FUNCTION
+#undef NOVA_SIMD_DISPATCH_TERNARY_FUNCTION
+
+} /* namespace dispatch */
+} /* namespace nova */
+
+#endif /* SIMD_DISPATCH_HPP */
@@ -0,0 +1,78 @@
+//  half precision sample storage
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_HALF_HPP
+#define SIMD_HALF_HPP
+
+#include <cassert>
+
+#include "vec.hpp"
+#include "detail/half_float.hpp"
+#include "detail/wrap_arguments.hpp"
+
+/* fp16 (ieee754 binary16) and bf16 buffers hold uint16_t samples, see detail/half_float.hpp. they halve
+ * the memory bandwidth of large sample caches, the computation is done in single precision: the
+ * fp16_argument and bf16_argument wrappers read them as inputs of the single precision functions.
+ *
+ * the simd functions need n to be a multiple of vec<float>::size and an aligned float buffer, the half
+ * precision buffer has no alignment requirements. with f16c (x86) or fp16 neon support, fp16 is
+ * converted in hardware, otherwise with scalar code. bf16 is converted with integer instructions */
+
+namespace nova {
+
+#define HALF_CONVERSION_FUNCTIONS(format)                                                           \
+inline void format##_to_float_vec(float * out, const uint16_t * in, unsigned int n)                 \
+{                                                                                                   \
+    for (unsigned int i = 0; i != n; ++i)                                                           \
+        out[i] = detail::format##_to_float(in[i]);                                                  \
+}                                                                                                   \
+                                                                                                    \
+inline void format##_to_float_vec_simd(float * out, const uint16_t * in, unsigned int n)            \
+{                                                                                                   \
+    assert(n % vec<float>::size == 0);                                                              \
+    for (unsigned int i = 0; i != n; i += vec<float>::size) {                                       \
+        vec<float> value;                                                                           \
+        value.load_##format(in + i);                                                                \
+        value.store_aligned(out + i);                                                               \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+inline void float_to_##format##_vec(uint16_t * out, const float * in, unsigned int n)               \
+{                                                                                                   \
+    for (unsigned int i = 0; i != n; ++i)                                                           \
+        out[i] = detail::float_to_##format(in[i]);                                                  \
+}                                                                                                   \
+                                                                                                    \
+inline void float_to_##format##_vec_simd(uint16_t * out, const float * in, unsigned int n)          \
+{                                                                                                   \
+    assert(n % vec<float>::size == 0);                                                              \
+    for (unsigned int i = 0; i != n; i += vec<float>::size) {                                       \
+        vec<float> value;                                                                           \
+        value.load_aligned(in + i);                                                                 \
+        value.store_##format(out + i);                                                              \
+    }                                                                                               \
+}
+
+HALF_CONVERSION_FUNCTIONS(fp16)
+HALF_CONVERSION_FUNCTIONS(bf16)
+
+#undef HALF_CONVERSION_FUNCTIONS
+
+}
+
+#endif /* SIMD_HALF_HPP */
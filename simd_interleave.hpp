@@ -0,0 +1,412 @@
+//  interleaving and deinterleaving of multichannel buffers
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_INTERLEAVE_HPP
+#define SIMD_INTERLEAVE_HPP
+
+#include <cassert>
+
+#include "vec.hpp"
+#include "simd_memory.hpp"
+
+#include "detail/table_index.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* interleaved buffers hold n frames of channels samples: interleaved[frame * channels + channel]. planar
+ * buffers are given as an array of channels pointers to n samples each.
+ *
+ * the simd functions need n to be a multiple of vec<F>::size. 1, 2, 4, 8 and 16 channels are transposed
+ * in registers with the interleave/deinterleave primitives of the vec class (or with transpose, if there
+ * is one channel per lane). 6 (5.1) and 12 (7.1.4) channels are transposed in groups of vec<F>::size
+ * channels. other channel counts gather the samples of one channel from the interleaved
+ * buffer or scatter them lane by lane.
+ *
+ * interleave(lhs, rhs, low, high) zips two vectors: low gets the first half of the pairs
+ * (lhs[0], rhs[0]), (lhs[1], rhs[1]), ..., high the second half. deinterleave(lhs, rhs, even, odd) is its
+ * inverse and splits the concatenation of lhs and rhs into the elements with even and odd indices */
+
+namespace nova {
+
+template <typename F>
+inline void interleave_vec(F * dest, const F * const * src, unsigned int channels, unsigned int n)
+{
+    for (unsigned int frame = 0; frame != n; ++frame)
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            *dest++ = src[channel][frame];
+}
+
+template <typename F>
+inline void deinterleave_vec(F * const * dest, const F * src, unsigned int channels, unsigned int n)
+{
+    for (unsigned int frame = 0; frame != n; ++frame)
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            dest[channel][frame] = *src++;
+}
+
+namespace detail {
+
+template <bool aligned, typename F>
+always_inline void load_aligned(vec<F> & value, const F * src)
+{
+    if (aligned)
+        value.load_aligned(src);
+    else
+        value.load(src);
+}
+
+/* log2(channels) rounds of zipping channel i with channel i + channels/2. the result holds the
+ * interleaved samples of size frames */
+template <unsigned int channels, typename F>
+always_inline void interleave_registers(vec<F> * data)
+{
+    if (channels == vec<F>::size) {
+        transpose(data);
+        return;
+    }
+
+    for (unsigned int round = 1; round < channels; round *= 2) {
+        vec<F> zipped[channels];
+        for (unsigned int i = 0; i != channels / 2; ++i)
+            interleave(data[i], data[i + channels/2], zipped[2*i], zipped[2*i + 1]);
+
+        for (unsigned int i = 0; i != channels; ++i)
+            data[i] = zipped[i];
+    }
+}
+
+/* inverse of interleave_registers */
+template <unsigned int channels, typename F>
+always_inline void deinterleave_registers(vec<F> * data)
+{
+    if (channels == vec<F>::size) {
+        transpose(data);
+        return;
+    }
+
+    for (unsigned int round = 1; round < channels; round *= 2) {
+        vec<F> unzipped[channels];
+        for (unsigned int i = 0; i != channels / 2; ++i)
+            deinterleave(data[2*i], data[2*i + 1], unzipped[i], unzipped[i + channels/2]);
+
+        for (unsigned int i = 0; i != channels; ++i)
+            data[i] = unzipped[i];
+    }
+}
+
+template <unsigned int channels, bool src_aligned, bool dst_aligned, typename F>
+always_inline void interleave_frames(F * dest, const F * const * src, unsigned int n)
+{
+    const unsigned int size = vec<F>::size;
+
+    for (unsigned int frame = 0; frame != n; frame += size) {
+        vec<F> data[channels];
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            load_aligned<src_aligned>(data[channel], src[channel] + frame);
+
+        interleave_registers<channels>(data);
+
+        for (unsigned int i = 0; i != channels; ++i)
+            store_aligned<dst_aligned>(data[i], dest + i * size);
+        dest += channels * size;
+    }
+}
+
+template <unsigned int channels, bool src_aligned, bool dst_aligned, typename F>
+always_inline void deinterleave_frames(F * const * dest, const F * src, unsigned int n)
+{
+    const unsigned int size = vec<F>::size;
+
+    for (unsigned int frame = 0; frame != n; frame += size) {
+        vec<F> data[channels];
+        for (unsigned int i = 0; i != channels; ++i)
+            load_aligned<src_aligned>(data[i], src + i * size);
+        src += channels * size;
+
+        deinterleave_registers<channels>(data);
+
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            store_aligned<dst_aligned>(data[channel], dest[channel] + frame);
+    }
+}
+
+/* 6 (5.1) and 12 (7.1.4) channels are transposed in groups of size channels. interleaving size channels
+ * turns the samples of size frames into one vector per frame, which is stored at the offset of the group
+ * in the interleaved frame. the last group has only count channels, its rows are padded and its stores
+ * spill into the next frame, so it is stored before the full groups of the same frames, which overwrite
+ * the excess samples. in the last size frames of the buffer, the frames, which would be accessed beyond
+ * the end of the buffer, are stored (and loaded) lane by lane */
+template <typename F>
+always_inline void store_lanes(vec<F> const & value, F * dest, unsigned int count)
+{
+    for (unsigned int i = 0; i != count; ++i)
+        dest[i] = value.get(i);
+}
+
+template <typename F>
+always_inline void load_lanes(vec<F> & value, const F * src, unsigned int count)
+{
+    value.clear();
+    for (unsigned int i = 0; i != count; ++i)
+        value.set(i, src[i]);
+}
+
+template <bool src_aligned, bool at_end, typename F>
+always_inline void interleave_group(F * dest, const F * const * src, unsigned int channels, unsigned int first,
+                                    unsigned int count, unsigned int frame, const F * end)
+{
+    const unsigned int size = vec<F>::size;
+
+    vec<F> data[size];
+    for (unsigned int i = 0; i != count; ++i)
+        load_aligned<src_aligned>(data[i], src[first + i] + frame);
+    for (unsigned int i = count; i != size; ++i)
+        data[i] = data[0];
+
+    interleave_registers<vec<F>::size>(data);
+
+    for (unsigned int i = 0; i != size; ++i) {
+        F * frame_dest = dest + i * channels + first;
+        if (!at_end || frame_dest + size <= end)
+            data[i].store(frame_dest);
+        else
+            store_lanes(data[i], frame_dest, count);
+    }
+}
+
+template <bool dst_aligned, bool at_end, typename F>
+always_inline void deinterleave_group(F * const * dest, const F * src, unsigned int channels, unsigned int first,
+                                      unsigned int count, unsigned int frame, const F * end)
+{
+    const unsigned int size = vec<F>::size;
+
+    vec<F> data[size];
+    for (unsigned int i = 0; i != size; ++i) {
+        const F * frame_src = src + i * channels + first;
+        if (!at_end || frame_src + size <= end)
+            data[i].load(frame_src);
+        else
+            load_lanes(data[i], frame_src, count);
+    }
+
+    deinterleave_registers<vec<F>::size>(data);
+
+    for (unsigned int i = 0; i != count; ++i)
+        store_aligned<dst_aligned>(data[i], dest[first + i] + frame);
+}
+
+/* the interleaved frames are not aligned to vectors, only the alignment of the planar buffers is used */
+template <unsigned int channels, bool src_aligned, typename F>
+always_inline void interleave_frames_blocked(F * dest, const F * const * src, unsigned int n)
+{
+    const unsigned int size = vec<F>::size;
+    const unsigned int last = (channels - 1) / size * size;
+    const F * end = dest + channels * n;
+
+    unsigned int frame = 0;
+    for (; frame + size < n; frame += size) {
+        interleave_group<src_aligned, false>(dest, src, channels, last, channels - last, frame, end);
+        for (unsigned int first = 0; first != last; first += size)
+            interleave_group<src_aligned, false>(dest, src, channels, first, size, frame, end);
+        dest += channels * size;
+    }
+
+    if (frame != n) {
+        interleave_group<src_aligned, true>(dest, src, channels, last, channels - last, frame, end);
+        for (unsigned int first = 0; first != last; first += size)
+            interleave_group<src_aligned, false>(dest, src, channels, first, size, frame, end);
+    }
+}
+
+template <unsigned int channels, bool dst_aligned, typename F>
+always_inline void deinterleave_frames_blocked(F * const * dest, const F * src, unsigned int n)
+{
+    const unsigned int size = vec<F>::size;
+    const unsigned int last = (channels - 1) / size * size;
+    const F * end = src + channels * n;
+
+    unsigned int frame = 0;
+    for (; frame + size < n; frame += size) {
+        for (unsigned int first = 0; first != last; first += size)
+            deinterleave_group<dst_aligned, false>(dest, src, channels, first, size, frame, end);
+        deinterleave_group<dst_aligned, false>(dest, src, channels, last, channels - last, frame, end);
+        src += channels * size;
+    }
+
+    if (frame != n) {
+        for (unsigned int first = 0; first != last; first += size)
+            deinterleave_group<dst_aligned, false>(dest, src, channels, first, size, frame, end);
+        deinterleave_group<dst_aligned, true>(dest, src, channels, last, channels - last, frame, end);
+    }
+}
+
+/* other channel counts store the samples of one channel lane by lane, or gather them */
+template <bool src_aligned, typename F>
+inline void interleave_frames_generic(F * dest, const F * const * src, unsigned int channels, unsigned int n)
+{
+    const unsigned int size = vec<F>::size;
+
+    for (unsigned int frame = 0; frame != n; frame += size) {
+        for (unsigned int channel = 0; channel != channels; ++channel) {
+            vec<F> data;
+            load_aligned<src_aligned>(data, src[channel] + frame);
+            for (unsigned int i = 0; i != size; ++i)
+                dest[i * channels + channel] = data.get(i);
+        }
+        dest += channels * size;
+    }
+}
+
+template <bool dst_aligned, typename F>
+inline void deinterleave_frames_generic(F * const * dest, const F * src, unsigned int channels, unsigned int n)
+{
+    typedef table_index<vec<F> > index_traits;
+    const unsigned int size = vec<F>::size;
+
+    vec<F> stride;
+    stride.set_slope(0, F(channels));
+    const typename index_traits::type index = index_traits::truncate(stride);
+
+    for (unsigned int frame = 0; frame != n; frame += size) {
+        for (unsigned int channel = 0; channel != channels; ++channel)
+            store_aligned<dst_aligned>(index_traits::gather(src + channel, index), dest[channel] + frame);
+        src += channels * size;
+    }
+}
+
+}
+
+#define INTERLEAVE_FUNCTION(name, src_aligned, dst_aligned)                                         \
+template <typename F>                                                                               \
+inline void interleave_##name##_simd(F * dest, const F * const * src, unsigned int channels,        \
+                                     unsigned int n)                                                \
+{                                                                                                   \
+    assert(n % vec<F>::size == 0);                                                                  \
+    switch (channels) {                                                                             \
+    case 1:                                                                                         \
+        detail::interleave_frames<1, src_aligned, dst_aligned>(dest, src, n);                       \
+        return;                                                                                     \
+    case 2:                                                                                         \
+        detail::interleave_frames<2, src_aligned, dst_aligned>(dest, src, n);                       \
+        return;                                                                                     \
+    case 4:                                                                                         \
+        detail::interleave_frames<4, src_aligned, dst_aligned>(dest, src, n);                       \
+        return;                                                                                     \
+    case 6:                                                                                         \
+        detail::interleave_frames_blocked<6, src_aligned>(dest, src, n);                            \
+        return;                                                                                     \
+    case 8:                                                                                         \
+        detail::interleave_frames<8, src_aligned, dst_aligned>(dest, src, n);                       \
+        return;                                                                                     \
+    case 12:                                                                                        \
+        detail::interleave_frames_blocked<12, src_aligned>(dest, src, n);                           \
+        return;                                                                                     \
+    case 16:                                                                                        \
+        detail::interleave_frames<16, src_aligned, dst_aligned>(dest, src, n);                      \
+        return;                                                                                     \
+    default:                                                                                        \
+        detail::interleave_frames_generic<src_aligned>(dest, src, channels, n);                     \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+template <unsigned int n, typename F>                                                               \
+inline void interleave_##name##_simd(F * dest, const F * const * src, unsigned int channels)        \
+{                                                                                                   \
+    interleave_##name##_simd(dest, src, channels, n);                                               \
+}                                                                                                   \
+                                                                                                    \
+template <typename F>                                                                               \
+inline void deinterleave_##name##_simd(F * const * dest, const F * src, unsigned int channels,      \
+                                       unsigned int n)                                              \
+{                                                                                                   \
+    assert(n % vec<F>::size == 0);                                                                  \
+    switch (channels) {                                                                             \
+    case 1:                                                                                         \
+        detail::deinterleave_frames<1, src_aligned, dst_aligned>(dest, src, n);                     \
+        return;                                                                                     \
+    case 2:                                                                                         \
+        detail::deinterleave_frames<2, src_aligned, dst_aligned>(dest, src, n);                     \
+        return;                                                                                     \
+    case 4:                                                                                         \
+        detail::deinterleave_frames<4, src_aligned, dst_aligned>(dest, src, n);                     \
+        return;                                                                                     \
+    case 6:                                                                                         \
+        detail::deinterleave_frames_blocked<6, dst_aligned>(dest, src, n);                          \
+        return;                                                                                     \
+    case 8:                                                                                         \
+        detail::deinterleave_frames<8, src_aligned, dst_aligned>(dest, src, n);                     \
+        return;                                                                                     \
+    case 12:                                                                                        \
+        detail::deinterleave_frames_blocked<12, dst_aligned>(dest, src, n);                         \
+        return;                                                                                     \
+    case 16:                                                                                        \
+        detail::deinterleave_frames<16, src_aligned, dst_aligned>(dest, src, n);                    \
+        return;                                                                                     \
+    default:                                                                                        \
+        detail::deinterleave_frames_generic<dst_aligned>(dest, src, channels, n);                   \
+    }                                                                                               \
+}                                                                                                   \
+                                                                                                    \
+template <unsigned int n, typename F>                                                               \
+inline void deinterleave_##name##_simd(F * const * dest, const F * src, unsigned int channels)      \
+{                                                                                                   \
+    deinterleave_##name##_simd(dest, src, channels, n);                                             \
+}
+
+/* the first letter gives the alignment of the source, the second the alignment of the destination.
+ * for planar buffers, all channels need to be aligned */
+INTERLEAVE_FUNCTION(aa, true, true)
+INTERLEAVE_FUNCTION(na, false, true)
+INTERLEAVE_FUNCTION(an, true, false)
+INTERLEAVE_FUNCTION(nn, false, false)
+
+#undef INTERLEAVE_FUNCTION
+
+template <typename F>
+inline void interleave_simd(F * dest, const F * const * src, unsigned int channels, unsigned int n)
+{
+    interleave_aa_simd(dest, src, channels, n);
+}
+
+template <unsigned int n, typename F>
+inline void interleave_simd(F * dest, const F * const * src, unsigned int channels)
+{
+    interleave_aa_simd<n>(dest, src, channels);
+}
+
+template <typename F>
+inline void deinterleave_simd(F * const * dest, const F * src, unsigned int channels, unsigned int n)
+{
+    deinterleave_aa_simd(dest, src, channels, n);
+}
+
+template <unsigned int n, typename F>
+inline void deinterleave_simd(F * const * dest, const F * src, unsigned int channels)
+{
+    deinterleave_aa_simd<n>(dest, src, channels);
+}
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_INTERLEAVE_HPP */
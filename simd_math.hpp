@@ -51,25 +51,119 @@ struct NAME##_                                                          \
 DEFINE_UNARY_FUNCTOR(NAME)                              \
 NOVA_SIMD_DEFINE_UNARY_WRAPPER(NAME, detail::NAME##_)
 
+/* functions with accuracy tiers: NAME uses the standard tier, fast_NAME and precise_NAME the others */
+#define DEFINE_UNARY_ACCURACY_FUNCTOR(NAME)                             \
+namespace detail {                                                      \
+template <typename Accuracy = accuracy::standard>                       \
+struct NAME##_                                                          \
+{                                                                       \
+    template <typename FloatType>                                       \
+    always_inline FloatType operator()(FloatType arg) const             \
+    {                                                                   \
+        return NAME(arg, Accuracy());                                   \
+    }                                                                   \
+};                                                                      \
+} // namespace detail
+
+#define DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(NAME)                                  \
+DEFINE_UNARY_ACCURACY_FUNCTOR(NAME)                                                 \
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(NAME, detail::NAME##_<>)                             \
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(fast_##NAME, detail::NAME##_<accuracy::fast>)        \
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(precise_##NAME, detail::NAME##_<accuracy::precise>)
 
-DEFINE_UNARY_MATH_FUNCTIONS(sin)
-DEFINE_UNARY_MATH_FUNCTIONS(cos)
+
+DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(sin)
+DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(cos)
 DEFINE_UNARY_MATH_FUNCTIONS(tan)
 DEFINE_UNARY_MATH_FUNCTIONS(asin)
 DEFINE_UNARY_MATH_FUNCTIONS(acos)
 DEFINE_UNARY_MATH_FUNCTIONS(atan)
 
-DEFINE_UNARY_MATH_FUNCTIONS(tanh)
+DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(tanh)
+DEFINE_UNARY_MATH_FUNCTIONS(sinh)
+DEFINE_UNARY_MATH_FUNCTIONS(cosh)
+DEFINE_UNARY_MATH_FUNCTIONS(asinh)
+DEFINE_UNARY_MATH_FUNCTIONS(acosh)
+DEFINE_UNARY_MATH_FUNCTIONS(atanh)
+
+DEFINE_UNARY_MATH_FUNCTIONS(erf)
+DEFINE_UNARY_MATH_FUNCTIONS(erfc)
 
-DEFINE_UNARY_MATH_FUNCTIONS(log)
+DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(log)
 DEFINE_UNARY_MATH_FUNCTIONS(log2)
 DEFINE_UNARY_MATH_FUNCTIONS(log10)
-DEFINE_UNARY_MATH_FUNCTIONS(exp)
+DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS(exp)
+DEFINE_UNARY_MATH_FUNCTIONS(exp2)
+DEFINE_UNARY_MATH_FUNCTIONS(expm1)
+DEFINE_UNARY_MATH_FUNCTIONS(log1p)
 
+DEFINE_UNARY_MATH_FUNCTIONS(cbrt)
 DEFINE_UNARY_MATH_FUNCTIONS(signed_sqrt)
 
 
 
+/* sin and cos of the same argument, computed with a single range reduction */
+template <typename F>
+inline void sincos_vec(F * out_sin, F * out_cos, const F * in, unsigned int n)
+{
+    do
+    {
+        F arg = *in++;
+        *out_sin++ = detail::sin(arg);
+        *out_cos++ = detail::cos(arg);
+    } while(--n);
+}
+
+namespace detail
+{
+
+template <typename F, unsigned int n>
+struct sincos_vec
+{
+    static const int offset = vec<F>::size;
+
+    static always_inline void mp_iteration(F * out_sin, F * out_cos, const F * in)
+    {
+        vec<F> vin, vsin, vcos;
+        vin.load_aligned(in);
+
+        sincos(vin, vsin, vcos);
+
+        vsin.store_aligned(out_sin);
+        vcos.store_aligned(out_cos);
+
+        sincos_vec<F, n-offset>::mp_iteration(out_sin+offset, out_cos+offset, in+offset);
+    }
+};
+
+template <typename F>
+struct sincos_vec<F, 0>
+{
+    static always_inline void mp_iteration(F *, F *, const F *)
+    {}
+};
+
+} /* namespace detail */
+
+template <typename F>
+inline void sincos_vec_simd(F * out_sin, F * out_cos, const F * in, unsigned int n)
+{
+    const int per_loop = vec<F>::objects_per_cacheline;
+
+    n /= per_loop;
+    do {
+        detail::sincos_vec<F, per_loop>::mp_iteration(out_sin, out_cos, in);
+        out_sin += per_loop; out_cos += per_loop; in += per_loop;
+    } while(--n);
+}
+
+template <unsigned int n, typename F>
+inline void sincos_vec_simd(F * out_sin, F * out_cos, const F * in)
+{
+    detail::sincos_vec<F, n>::mp_iteration(out_sin, out_cos, in);
+}
+
+
 #define DEFINE_BINARY_MATH_FUNCTOR(NAME)                                \
 namespace detail {                                                      \
 struct NAME##_                                                          \
@@ -84,17 +178,164 @@ struct NAME##_                                                          \
 }
 
 
-DEFINE_BINARY_MATH_FUNCTOR(pow)
 DEFINE_BINARY_MATH_FUNCTOR(signed_pow)
 
-NOVA_SIMD_DEFINE_BINARY_WRAPPER(pow, detail::pow_)
+namespace detail {
+
+template <typename Accuracy = accuracy::standard>
+struct pow_
+{
+    template <typename FloatType>
+    always_inline FloatType operator()(FloatType lhs, FloatType rhs) const
+    {
+        return pow(lhs, rhs, Accuracy());
+    }
+};
+
+}
+
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(pow, detail::pow_<>)
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(fast_pow, detail::pow_<accuracy::fast>)
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(precise_pow, detail::pow_<accuracy::precise>)
 NOVA_SIMD_DEFINE_BINARY_WRAPPER(spow, detail::signed_pow_)
 
+DEFINE_BINARY_MATH_FUNCTOR(atan2)
+DEFINE_BINARY_MATH_FUNCTOR(hypot)
+
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(atan2, detail::atan2_)
+NOVA_SIMD_DEFINE_BINARY_WRAPPER(hypot, detail::hypot_)
+
+
+/* magnitude and phase of complex numbers, given as separate real and imaginary buffers */
+template <typename F>
+inline void cartesian_to_polar_vec(F * out_magnitude, F * out_phase, const F * real, const F * imag, unsigned int n)
+{
+    do
+    {
+        F re = *real++;
+        F im = *imag++;
+        *out_magnitude++ = detail::hypot(re, im);
+        *out_phase++     = detail::atan2(im, re);
+    } while(--n);
+}
+
+/* real and imaginary parts from magnitude and phase */
+template <typename F>
+inline void polar_to_cartesian_vec(F * out_real, F * out_imag, const F * magnitude, const F * phase, unsigned int n)
+{
+    do
+    {
+        F mag = *magnitude++;
+        F ph  = *phase++;
+        *out_real++ = mag * detail::cos(ph);
+        *out_imag++ = mag * detail::sin(ph);
+    } while(--n);
+}
+
+namespace detail
+{
+
+template <typename F, unsigned int n>
+struct cartesian_to_polar_vec
+{
+    static const int offset = vec<F>::size;
+
+    static always_inline void mp_iteration(F * out_magnitude, F * out_phase, const F * real, const F * imag)
+    {
+        vec<F> re, im;
+        re.load_aligned(real);
+        im.load_aligned(imag);
+
+        hypot(re, im).store_aligned(out_magnitude);
+        atan2(im, re).store_aligned(out_phase);
+
+        cartesian_to_polar_vec<F, n-offset>::mp_iteration(out_magnitude+offset, out_phase+offset,
+                                                         real+offset, imag+offset);
+    }
+};
+
+template <typename F>
+struct cartesian_to_polar_vec<F, 0>
+{
+    static always_inline void mp_iteration(F *, F *, const F *, const F *)
+    {}
+};
+
+template <typename F, unsigned int n>
+struct polar_to_cartesian_vec
+{
+    static const int offset = vec<F>::size;
+
+    static always_inline void mp_iteration(F * out_real, F * out_imag, const F * magnitude, const F * phase)
+    {
+        vec<F> mag, ph, vsin, vcos;
+        mag.load_aligned(magnitude);
+        ph.load_aligned(phase);
+
+        sincos(ph, vsin, vcos);
+
+        (mag * vcos).store_aligned(out_real);
+        (mag * vsin).store_aligned(out_imag);
+
+        polar_to_cartesian_vec<F, n-offset>::mp_iteration(out_real+offset, out_imag+offset,
+                                                         magnitude+offset, phase+offset);
+    }
+};
+
+template <typename F>
+struct polar_to_cartesian_vec<F, 0>
+{
+    static always_inline void mp_iteration(F *, F *, const F *, const F *)
+    {}
+};
+
+} /* namespace detail */
+
+template <typename F>
+inline void cartesian_to_polar_vec_simd(F * out_magnitude, F * out_phase, const F * real, const F * imag,
+                                        unsigned int n)
+{
+    const int per_loop = vec<F>::objects_per_cacheline;
+
+    n /= per_loop;
+    do {
+        detail::cartesian_to_polar_vec<F, per_loop>::mp_iteration(out_magnitude, out_phase, real, imag);
+        out_magnitude += per_loop; out_phase += per_loop; real += per_loop; imag += per_loop;
+    } while(--n);
+}
+
+template <unsigned int n, typename F>
+inline void cartesian_to_polar_vec_simd(F * out_magnitude, F * out_phase, const F * real, const F * imag)
+{
+    detail::cartesian_to_polar_vec<F, n>::mp_iteration(out_magnitude, out_phase, real, imag);
+}
+
+template <typename F>
+inline void polar_to_cartesian_vec_simd(F * out_real, F * out_imag, const F * magnitude, const F * phase,
+                                        unsigned int n)
+{
+    const int per_loop = vec<F>::objects_per_cacheline;
+
+    n /= per_loop;
+    do {
+        detail::polar_to_cartesian_vec<F, per_loop>::mp_iteration(out_real, out_imag, magnitude, phase);
+        out_real += per_loop; out_imag += per_loop; magnitude += per_loop; phase += per_loop;
+    } while(--n);
+}
+
+template <unsigned int n, typename F>
+inline void polar_to_cartesian_vec_simd(F * out_real, F * out_imag, const F * magnitude, const F * phase)
+{
+    detail::polar_to_cartesian_vec<F, n>::mp_iteration(out_real, out_imag, magnitude, phase);
+}
+
 }
 
 #undef DEFINE_UNARY_FUNCTOR
 #undef DEFINE_BINARY_MATH_FUNCTOR
 #undef DEFINE_UNARY_MATH_FUNCTIONS
+#undef DEFINE_UNARY_ACCURACY_FUNCTOR
+#undef DEFINE_UNARY_ACCURACY_MATH_FUNCTIONS
 #undef DEFINE_BINARY_MATH_FUNCTIONS
 #undef always_inline
 
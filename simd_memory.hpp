@@ -24,6 +24,7 @@
 #include <cstring>
 
 #include "vec.hpp"
+#include "simd_unroll_constraints.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -60,26 +61,35 @@ inline void store_aligned(vec<F> const & value, F * dest)
         value.store(dest);
 }
 
-template <typename F, unsigned int n, bool aligned>
+template <bool aligned, bool stream, typename F>
+inline void store_aligned(vec<F> const & value, F * dest)
+{
+    if (stream)
+        value.store_aligned_stream(dest);
+    else
+        store_aligned<aligned>(value, dest);
+}
+
+template <typename F, unsigned int n, bool aligned, bool stream = false>
 struct setvec
 {
     static const int offset = vec<F>::size;
 
     static always_inline void mp_iteration(F * dst, vec<F> const & val)
     {
-        store_aligned<aligned>(val, dst);
-        setvec<F, n-offset, aligned>::mp_iteration(dst+offset, val);
+        store_aligned<aligned, stream>(val, dst);
+        setvec<F, n-offset, aligned, stream>::mp_iteration(dst+offset, val);
     }
 };
 
-template <typename F, bool aligned>
-struct setvec<F, 0, aligned>
+template <typename F, bool aligned, bool stream>
+struct setvec<F, 0, aligned, stream>
 {
     static always_inline void mp_iteration(F * dst, vec<F> const & val)
     {}
 };
 
-template <typename F, bool aligned>
+template <typename F, bool aligned, bool stream = false>
 inline void setvec_simd(F * dest, vec<F> const & val, unsigned int n)
 {
     const unsigned int offset = vec<F>::objects_per_cacheline;
@@ -87,7 +97,7 @@ inline void setvec_simd(F * dest, vec<F> const & val, unsigned int n)
 
     do
     {
-        setvec<F, offset, aligned>::mp_iteration(dest, val);
+        setvec<F, offset, aligned, stream>::mp_iteration(dest, val);
         dest += offset;
     }
     while (--unroll);
@@ -132,6 +142,24 @@ inline void setvec_simd(F * dest, F f, unsigned int n)
     detail::setvec_simd<F, true>(dest, val, n);
 }
 
+/* non-temporal stores for large buffers, see NOVA_SIMD_STREAM_THRESHOLD */
+template <typename F>
+inline void setvec_simd_stream(F * dest, F f, unsigned int n)
+{
+    vec<F> val(f);
+    if (detail::use_stream_stores<F>(n)) {
+        detail::setvec_simd<F, true, true>(dest, val, n);
+        vec<F>::stream_fence();
+    } else
+        detail::setvec_simd<F, true>(dest, val, n);
+}
+
+template <typename F>
+inline void zerovec_simd_stream(F * dest, unsigned int n)
+{
+    setvec_simd_stream(dest, F(0), n);
+}
+
 template <unsigned int n, typename F>
 inline void setvec_simd(F *dest, F f)
 {
@@ -275,10 +303,13 @@ inline void copyvec(F * dest, const F * src, unsigned int n)
 
 namespace detail {
 
-template <typename F, bool src_aligned, bool dst_aligned, unsigned int n>
+/* the source buffer is prefetched prefetch_distance bytes ahead, see NOVA_SIMD_PREFETCH_DISTANCE */
+template <typename F, bool src_aligned, bool dst_aligned, unsigned int n, bool stream = false,
+          unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE>
 struct copyvec
 {
     static const int offset = vec<F>::size;
+    static const bool cacheline_start = n % vec<F>::objects_per_cacheline == 0;
 
     static always_inline void mp_iteration(F * dst, const F * src)
     {
@@ -293,6 +324,9 @@ struct copyvec
 
     static always_inline void mp_iteration(F * dst, const F * src, vec<F> const & loaded_value)
     {
+        if (cacheline_start)
+            prefetch_ahead(src, prefetch_distance);
+
         vec<F> val;
 
         if (src_aligned)
@@ -300,13 +334,13 @@ struct copyvec
         else
             val.load(src);
 
-        store_aligned<dst_aligned>(loaded_value, dst);
-        copyvec<F, src_aligned, dst_aligned, n-offset>::mp_iteration(dst+offset, src+offset, val);
+        store_aligned<dst_aligned, stream>(loaded_value, dst);
+        copyvec<F, src_aligned, dst_aligned, n-offset, stream, prefetch_distance>::mp_iteration(dst+offset, src+offset, val);
     }
 };
 
-template <typename F, bool src_aligned, bool dst_aligned>
-struct copyvec<F, src_aligned, dst_aligned, 0>
+template <typename F, bool src_aligned, bool dst_aligned, bool stream, unsigned int prefetch_distance>
+struct copyvec<F, src_aligned, dst_aligned, 0, stream, prefetch_distance>
 {
     static always_inline void mp_iteration(F * dst, const F * src, vec<F> loaded_value)
     {}
@@ -351,6 +385,26 @@ inline void copyvec_simd(F * dest, const F * src)
     copyvec_aa_simd<n, F>(dest, src);
 }
 
+/* non-temporal stores for large buffers, see NOVA_SIMD_STREAM_THRESHOLD */
+template <typename F>
+inline void copyvec_simd_stream(F * dest, const F * src, unsigned int n)
+{
+    if (!detail::use_stream_stores<F>(n)) {
+        copyvec_aa_simd(dest, src, n);
+        return;
+    }
+
+    const int per_loop = vec<F>::objects_per_cacheline;
+    n /= per_loop;
+    do
+    {
+        detail::copyvec<F, true, true, per_loop, true>::mp_iteration(dest, src);
+        dest += per_loop; src += per_loop;
+    }
+    while (--n);
+    vec<F>::stream_fence();
+}
+
 template <typename F>
 inline void addvec(F * out, const F * in, unsigned int n)
 {
@@ -378,43 +432,55 @@ inline void addvec(F * out, const F in, const F slope, unsigned int n)
 namespace detail
 {
 
-template <typename F, unsigned int n>
+template <typename F, unsigned int n, unsigned int prefetch_distance = NOVA_SIMD_PREFETCH_DISTANCE>
 struct addvec
 {
     static const int offset = vec<F>::size;
+    static const bool cacheline_start = n % vec<F>::objects_per_cacheline == 0;
 
     static always_inline void mp_iteration(F * dst, const F * src)
     {
+        if (cacheline_start) {
+            prefetch_ahead(dst, prefetch_distance);
+            prefetch_ahead(src, prefetch_distance);
+        }
+
         vec<F> v1, v2;
         v1.load_aligned(dst);
         v2.load_aligned(src);
         v1 += v2;
         v1.store_aligned(dst);
-        addvec<F, n-offset>::mp_iteration(dst+offset, src+offset);
+        addvec<F, n-offset, prefetch_distance>::mp_iteration(dst+offset, src+offset);
     }
 
     static always_inline void mp_iteration(F * dst, vec<F> const & in)
     {
+        if (cacheline_start)
+            prefetch_ahead(dst, prefetch_distance);
+
         vec<F> v1;
         v1.load_aligned(dst);
         v1 += in;
         v1.store_aligned(dst);
-        addvec<F, n-offset>::mp_iteration(dst+offset, in);
+        addvec<F, n-offset, prefetch_distance>::mp_iteration(dst+offset, in);
     }
 
     static always_inline void mp_iteration(F * dst, vec<F> & in, vec<F> const & vslope)
     {
+        if (cacheline_start)
+            prefetch_ahead(dst, prefetch_distance);
+
         vec<F> v1;
         v1.load_aligned(dst);
         v1 += in;
         v1.store_aligned(dst);
         in += vslope;
-        addvec<F, n-offset>::mp_iteration(dst+offset, in, vslope);
+        addvec<F, n-offset, prefetch_distance>::mp_iteration(dst+offset, in, vslope);
     }
 };
 
-template <typename F>
-struct addvec<F, 0>
+template <typename F, unsigned int prefetch_distance>
+struct addvec<F, 0, prefetch_distance>
 {
     static always_inline void mp_iteration(F * dst, const F * src)
     {}
@@ -0,0 +1,425 @@
+//  block-parallel execution of the simd functions
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_PARALLEL_HPP
+#define SIMD_PARALLEL_HPP
+
+/* the buffer is split into chunks of a fixed size, which are distributed over the threads of a
+ * thread_pool. chunk boundaries only depend on the chunk size of the policy, never on the number of
+ * threads, and partial results of reductions are combined in the order of the chunks, so the results
+ * don't depend on the number of threads or on the scheduling.
+ *
+ * ramps are evaluated at the chunk boundaries as base + offset * slope, so they may differ from the
+ * single-threaded functions by a rounding error.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "vec.hpp"
+#include "detail/define_macros.hpp"
+#include "simd_horizontal_functions.hpp"
+#include "simd_peakmeter.hpp"
+
+namespace nova     {
+namespace parallel {
+
+class thread_pool
+{
+public:
+    /* the calling thread takes part in the computation, so thread_count - 1 workers are started */
+    explicit thread_pool(unsigned int thread_count = std::thread::hardware_concurrency()):
+        task_count(0), next_task(0), active_workers(0), generation(0), stop(false)
+    {
+        for (unsigned int i = 1; i < thread_count; ++i)
+            workers.push_back(std::thread(&thread_pool::worker_loop, this));
+    }
+
+    ~thread_pool(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+
+        for (size_t i = 0; i != workers.size(); ++i)
+            workers[i].join();
+    }
+
+    thread_pool(thread_pool const &) = delete;
+    thread_pool & operator=(thread_pool const &) = delete;
+
+    unsigned int size(void) const
+    {
+        return (unsigned int)workers.size() + 1;
+    }
+
+    /* calls f(index) for each index in [0, count) and returns after all calls are done.
+     * must not be called concurrently from several threads */
+    template <typename Functor>
+    void run(unsigned int count, Functor const & f)
+    {
+        if (workers.empty() || count < 2) {
+            for (unsigned int i = 0; i != count; ++i)
+                f(i);
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        job = std::cref(f);
+        task_count = count;
+        next_task.store(0, std::memory_order_relaxed);
+        active_workers = (unsigned int)workers.size();
+        ++generation;
+        lock.unlock();
+        wake.notify_all();
+
+        run_tasks();
+
+        lock.lock();
+        done.wait(lock, [this] { return active_workers == 0; });
+        job = nullptr;
+    }
+
+private:
+    void run_tasks(void)
+    {
+        for (;;) {
+            const unsigned int task = next_task.fetch_add(1, std::memory_order_relaxed);
+            if (task >= task_count)
+                return;
+            job(task);
+        }
+    }
+
+    void worker_loop(void)
+    {
+        unsigned int seen_generation = 0;
+        for (;;) {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stop || generation != seen_generation; });
+            if (stop)
+                return;
+            seen_generation = generation;
+            lock.unlock();
+
+            run_tasks();
+
+            lock.lock();
+            if (--active_workers == 0)
+                done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake, done;
+
+    std::function<void (unsigned int)> job;
+    unsigned int task_count;
+    std::atomic<unsigned int> next_task;
+    unsigned int active_workers;
+    unsigned int generation;
+    bool stop;
+};
+
+class policy
+{
+public:
+    /* chunk_size is rounded up to a multiple of the unroll constraints of all simd functions */
+    explicit policy(thread_pool & pool, unsigned int chunk_size = 65536):
+        pool(pool), requested_chunk_size(chunk_size)
+    {}
+
+    template <typename FloatType>
+    unsigned int chunk_size(void) const
+    {
+        const unsigned int granularity = 4 * vec<FloatType>::objects_per_cacheline;
+        const unsigned int size = std::max(requested_chunk_size, granularity);
+        return (size + granularity - 1) / granularity * granularity;
+    }
+
+    template <typename FloatType>
+    unsigned int chunk_count(unsigned int n) const
+    {
+        const unsigned int size = chunk_size<FloatType>();
+        return (n + size - 1) / size;
+    }
+
+    /* calls f(chunk, offset, count) for all chunks of a buffer with n samples */
+    template <typename FloatType, typename Functor>
+    void for_each_chunk(unsigned int n, Functor const & f) const
+    {
+        const unsigned int size = chunk_size<FloatType>();
+        pool.run(chunk_count<FloatType>(n), [&](unsigned int chunk) {
+            const unsigned int offset = chunk * size;
+            f(chunk, offset, std::min(size, n - offset));
+        });
+    }
+
+private:
+    thread_pool & pool;
+    const unsigned int requested_chunk_size;
+};
+
+} /* namespace parallel */
+
+namespace detail {
+
+/* arguments for the chunk starting at offset */
+template <typename FloatType, bool aligned>
+inline scalar_pointer_argument<FloatType, aligned>
+advance_argument(scalar_pointer_argument<FloatType, aligned> const & arg, unsigned int offset)
+{
+    return scalar_pointer_argument<FloatType, aligned>(arg.data + offset);
+}
+
+template <typename FloatType>
+inline scalar_scalar_argument<FloatType>
+advance_argument(scalar_scalar_argument<FloatType> const & arg, unsigned int)
+{
+    return arg;
+}
+
+template <typename FloatType>
+inline scalar_ramp_argument<FloatType>
+advance_argument(scalar_ramp_argument<FloatType> const & arg, unsigned int offset)
+{
+    return scalar_ramp_argument<FloatType>(arg.data + FloatType(offset) * arg.slope_, arg.slope_);
+}
+
+template <typename Format>
+inline scalar_half_argument<Format>
+advance_argument(scalar_half_argument<Format> const & arg, unsigned int offset)
+{
+    return scalar_half_argument<Format>(arg.data + offset);
+}
+
+template <typename Functor, typename Arg1>
+inline unary_expression<Functor, Arg1>
+advance_argument(unary_expression<Functor, Arg1> const & e, unsigned int offset)
+{
+    return unary_expression<Functor, Arg1>(advance_argument(e.arg1, offset));
+}
+
+template <typename Functor, typename Arg1, typename Arg2>
+inline binary_expression<Functor, Arg1, Arg2>
+advance_argument(binary_expression<Functor, Arg1, Arg2> const & e, unsigned int offset)
+{
+    return binary_expression<Functor, Arg1, Arg2>(advance_argument(e.arg1, offset),
+                                                  advance_argument(e.arg2, offset));
+}
+
+template <typename Functor, typename Arg1, typename Arg2, typename Arg3>
+inline ternary_expression<Functor, Arg1, Arg2, Arg3>
+advance_argument(ternary_expression<Functor, Arg1, Arg2, Arg3> const & e, unsigned int offset)
+{
+    return ternary_expression<Functor, Arg1, Arg2, Arg3>(advance_argument(e.arg1, offset),
+                                                         advance_argument(e.arg2, offset),
+                                                         advance_argument(e.arg3, offset));
+}
+
+template <typename Functor, typename FloatType>
+struct parallel_functor
+{
+    static void perform_vec_simd(parallel::policy const & policy, FloatType * out, const FloatType * arg, unsigned int n)
+    {
+        policy.for_each_chunk<FloatType>(n, [&](unsigned int, unsigned int offset, unsigned int count) {
+            unary_functor<Functor>::template perform_vec_simd<FloatType>(out + offset, arg + offset, count);
+        });
+    }
+
+    template <typename Arg1Type, typename Arg2Type>
+    static void perform_vec_simd(parallel::policy const & policy, FloatType * out, Arg1Type arg1, Arg2Type arg2,
+                                 unsigned int n)
+    {
+        auto wrapped1 = wrap_argument(arg1);
+        auto wrapped2 = wrap_argument(arg2);
+        policy.for_each_chunk<FloatType>(n, [&](unsigned int, unsigned int offset, unsigned int count) {
+            binary_functor<Functor>::template perform_vec_simd<FloatType>(out + offset,
+                                                                          advance_argument(wrapped1, offset),
+                                                                          advance_argument(wrapped2, offset),
+                                                                          count);
+        });
+    }
+
+    template <typename Arg1Type, typename Arg2Type, typename Arg3Type>
+    static void perform_vec_simd(parallel::policy const & policy, FloatType * out, Arg1Type arg1, Arg2Type arg2,
+                                 Arg3Type arg3, unsigned int n)
+    {
+        auto wrapped1 = wrap_argument(arg1);
+        auto wrapped2 = wrap_argument(arg2);
+        auto wrapped3 = wrap_argument(arg3);
+        policy.for_each_chunk<FloatType>(n, [&](unsigned int, unsigned int offset, unsigned int count) {
+            ternary_functor<Functor>::template perform_vec_simd<FloatType>(out + offset,
+                                                                           advance_argument(wrapped1, offset),
+                                                                           advance_argument(wrapped2, offset),
+                                                                           advance_argument(wrapped3, offset),
+                                                                           count);
+        });
+    }
+
+    template <typename Arg1Type, typename Arg2Type, typename Arg3Type, typename Arg4Type>
+    static void perform_vec_simd(parallel::policy const & policy, FloatType * out, Arg1Type arg1, Arg2Type arg2,
+                                 Arg3Type arg3, Arg4Type arg4, unsigned int n)
+    {
+        auto wrapped1 = wrap_argument(arg1);
+        auto wrapped2 = wrap_argument(arg2);
+        auto wrapped3 = wrap_argument(arg3);
+        auto wrapped4 = wrap_argument(arg4);
+        policy.for_each_chunk<FloatType>(n, [&](unsigned int, unsigned int offset, unsigned int count) {
+            quarternary_functor<Functor>::template perform_vec_simd<FloatType>(out + offset,
+                                                                               advance_argument(wrapped1, offset),
+                                                                               advance_argument(wrapped2, offset),
+                                                                               advance_argument(wrapped3, offset),
+                                                                               advance_argument(wrapped4, offset),
+                                                                               count);
+        });
+    }
+};
+
+} /* namespace detail */
+
+template <typename Expression>
+inline void fused_vec_simd(parallel::policy const & policy, typename Expression::value_type * out, Expression expr,
+                           unsigned int n)
+{
+    typedef typename Expression::value_type float_type;
+    policy.for_each_chunk<float_type>(n, [&](unsigned int, unsigned int offset, unsigned int count) {
+        fused_vec_simd(out + offset, detail::advance_argument(expr, offset), count);
+    });
+}
+
+/* reductions: partial results of the chunks are combined in chunk order. like the serial versions,
+ * all but horizontal_sum_vec_simd need at least one chunk (n > 0) */
+template <typename F>
+inline F horizontal_max_vec_simd(parallel::policy const & policy, const F * in, unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial(policy.chunk_count<F>(n));
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        partial[chunk] = horizontal_max_vec_simd(in + offset, count);
+    });
+
+    F result = partial[0];
+    for (size_t i = 1; i != partial.size(); ++i)
+        result = std::max(result, partial[i]);
+    return result;
+}
+
+template <typename F>
+inline F horizontal_min_vec_simd(parallel::policy const & policy, const F * in, unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial(policy.chunk_count<F>(n));
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        partial[chunk] = horizontal_min_vec_simd(in + offset, count);
+    });
+
+    F result = partial[0];
+    for (size_t i = 1; i != partial.size(); ++i)
+        result = std::min(result, partial[i]);
+    return result;
+}
+
+template <typename F>
+inline F horizontal_sum_vec_simd(parallel::policy const & policy, const F * in, unsigned int n)
+{
+    std::vector<F> partial(policy.chunk_count<F>(n));
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        partial[chunk] = horizontal_sum_vec_simd(in + offset, count);
+    });
+
+    F result = 0;
+    for (size_t i = 0; i != partial.size(); ++i)
+        result += partial[i];
+    return result;
+}
+
+template <typename F>
+inline void horizontal_minmax_vec_simd(parallel::policy const & policy, F & rmin, F & rmax, const F * in,
+                                       unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial_min(policy.chunk_count<F>(n)), partial_max(partial_min.size());
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        horizontal_minmax_vec_simd(partial_min[chunk], partial_max[chunk], in + offset, count);
+    });
+
+    rmin = *std::min_element(partial_min.begin(), partial_min.end());
+    rmax = *std::max_element(partial_max.begin(), partial_max.end());
+}
+
+template <typename F>
+inline void horizontal_maxsum_vec_simd(parallel::policy const & policy, F & rmax, F & rsum, const F * in,
+                                       unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial_max(policy.chunk_count<F>(n)), partial_sum(partial_max.size());
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        horizontal_maxsum_vec_simd(partial_max[chunk], partial_sum[chunk], in + offset, count);
+    });
+
+    rmax = *std::max_element(partial_max.begin(), partial_max.end());
+    rsum = 0;
+    for (size_t i = 0; i != partial_sum.size(); ++i)
+        rsum += partial_sum[i];
+}
+
+template <typename F>
+inline F peak_vec_simd(parallel::policy const & policy, const F * in, F * peak, unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial_peak(policy.chunk_count<F>(n), F(0)), partial_last(partial_peak.size());
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        partial_last[chunk] = peak_vec_simd(in + offset, &partial_peak[chunk], count);
+    });
+
+    *peak = std::max(*peak, *std::max_element(partial_peak.begin(), partial_peak.end()));
+    return partial_last.back();
+}
+
+template <typename F>
+inline void peak_rms_vec_simd(parallel::policy const & policy, const F * in, F * peak, F * squared_sum,
+                              unsigned int n)
+{
+    assert(n > 0);
+    std::vector<F> partial_peak(policy.chunk_count<F>(n), F(0)), partial_sum(partial_peak.size(), F(0));
+    policy.for_each_chunk<F>(n, [&](unsigned int chunk, unsigned int offset, unsigned int count) {
+        peak_rms_vec_simd(in + offset, &partial_peak[chunk], &partial_sum[chunk], count);
+    });
+
+    F local_squared_sum = *squared_sum;
+    for (size_t i = 0; i != partial_sum.size(); ++i)
+        local_squared_sum += partial_sum[i];
+
+    *peak = std::max(*peak, *std::max_element(partial_peak.begin(), partial_peak.end()));
+    *squared_sum = local_squared_sum;
+}
+
+} /* namespace nova */
+
+#endif /* SIMD_PARALLEL_HPP */
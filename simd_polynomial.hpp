@@ -0,0 +1,227 @@
+//  polynomial and rational approximations with compile-time coefficients
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_POLYNOMIAL_HPP
+#define SIMD_POLYNOMIAL_HPP
+
+#include "detail/math.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* polynomials are described by a class with a static constexpr array of coefficients, lowest order
+ * first:
+ *
+ *     struct shaper_coefficients
+ *     {
+ *         static constexpr double coefficients[] = { 0.0, 1.5, 0.0, -0.5 }; // 1.5 x - 0.5 x**3
+ *     };
+ *
+ *     vec<float> y = horner<shaper_coefficients>(x);
+ *
+ * the coefficients are only read in constant expressions, so they need no definition outside of the
+ * class. the evaluation works on vec<> and on float and double. with Fused, the steps are computed
+ * with madd, which maps to fma instructions where available. otherwise they are written as separate
+ * multiplications and additions, though the compiler may still contract them (see -ffp-contract) */
+
+namespace nova {
+namespace detail {
+
+template <typename T>
+struct polynomial_float_type
+{
+    typedef typename T::float_type type;
+};
+
+template <>
+struct polynomial_float_type<float>
+{
+    typedef float type;
+};
+
+template <>
+struct polynomial_float_type<double>
+{
+    typedef double type;
+};
+
+template <typename Coefficients>
+struct polynomial_size
+{
+    static const unsigned int value = sizeof(Coefficients::coefficients) / sizeof(Coefficients::coefficients[0]);
+};
+
+/* reading a constexpr scalar is no odr-use, unlike indexing the array */
+template <typename Coefficients, unsigned int Index>
+struct polynomial_coefficient_value
+{
+    static constexpr double value = Coefficients::coefficients[Index];
+};
+
+template <typename Coefficients, unsigned int Index, typename VecType>
+always_inline VecType polynomial_coefficient(void)
+{
+    typedef typename polynomial_float_type<VecType>::type float_type;
+    return VecType(float_type(polynomial_coefficient_value<Coefficients, Index>::value));
+}
+
+template <bool Fused>
+struct polynomial_madd
+{
+    template <typename VecType>
+    static always_inline VecType apply(VecType const & a, VecType const & b, VecType const & c)
+    {
+        return madd(a, b, c);
+    }
+};
+
+template <>
+struct polynomial_madd<false>
+{
+    template <typename VecType>
+    static always_inline VecType apply(VecType const & a, VecType const & b, VecType const & c)
+    {
+        return a * b + c;
+    }
+};
+
+/* c[first] + x c[first+1] + ... + x**(count-1) c[first+count-1] */
+template <typename Coefficients, bool Fused, unsigned int First, unsigned int Count>
+struct horner_impl
+{
+    template <typename VecType>
+    static always_inline VecType evaluate(VecType const & x)
+    {
+        const VecType higher = horner_impl<Coefficients, Fused, First + 1, Count - 1>::evaluate(x);
+        return polynomial_madd<Fused>::apply(higher, x, polynomial_coefficient<Coefficients, First, VecType>());
+    }
+};
+
+template <typename Coefficients, bool Fused, unsigned int First>
+struct horner_impl<Coefficients, Fused, First, 1>
+{
+    template <typename VecType>
+    static always_inline VecType evaluate(VecType const &)
+    {
+        return polynomial_coefficient<Coefficients, First, VecType>();
+    }
+};
+
+/* largest power of two, which is smaller than n */
+template <unsigned int n, unsigned int power = 1, bool done = (power * 2 >= n)>
+struct estrin_split
+{
+    static const unsigned int value = estrin_split<n, power * 2>::value;
+    static const unsigned int log2 = estrin_split<n, power * 2>::log2 + 1;
+};
+
+template <unsigned int n, unsigned int power>
+struct estrin_split<n, power, true>
+{
+    static const unsigned int value = power;
+    static const unsigned int log2 = 0;
+};
+
+/* splits the coefficients into a lower half with a power-of-two length and an upper half, which is
+ * scaled by x**split. both halves are independent, so the dependency chain has a length of
+ * log2(count) instead of count */
+template <typename Coefficients, bool Fused, unsigned int First, unsigned int Count>
+struct estrin_impl
+{
+    typedef estrin_split<Count> split;
+
+    /* powers[i] = x**(2**i) */
+    template <typename VecType>
+    static always_inline VecType evaluate(VecType const * powers)
+    {
+        const VecType lower = estrin_impl<Coefficients, Fused, First, split::value>::evaluate(powers);
+        const VecType upper = estrin_impl<Coefficients, Fused, First + split::value, Count - split::value>::evaluate(powers);
+        return polynomial_madd<Fused>::apply(upper, powers[split::log2], lower);
+    }
+};
+
+template <typename Coefficients, bool Fused, unsigned int First>
+struct estrin_impl<Coefficients, Fused, First, 1>
+{
+    template <typename VecType>
+    static always_inline VecType evaluate(VecType const *)
+    {
+        return polynomial_coefficient<Coefficients, First, VecType>();
+    }
+};
+
+}
+
+struct horner_scheme
+{
+    template <typename Coefficients, bool Fused, typename VecType>
+    static always_inline VecType evaluate(VecType const & x)
+    {
+        return detail::horner_impl<Coefficients, Fused, 0, detail::polynomial_size<Coefficients>::value>::evaluate(x);
+    }
+};
+
+struct estrin_scheme
+{
+    template <typename Coefficients, bool Fused, typename VecType>
+    static always_inline VecType evaluate(VecType const & x)
+    {
+        static const unsigned int size = detail::polynomial_size<Coefficients>::value;
+        static const unsigned int powers_count = detail::estrin_split<size>::log2 + 1;
+
+        VecType powers[powers_count];
+        powers[0] = x;
+        for (unsigned int i = 1; i != powers_count; ++i)
+            powers[i] = powers[i-1] * powers[i-1];
+
+        return detail::estrin_impl<Coefficients, Fused, 0, size>::evaluate(powers);
+    }
+};
+
+/* horner's scheme: one multiply-add per coefficient, each depending on the previous one */
+template <typename Coefficients, bool Fused = true, typename VecType>
+always_inline VecType horner(VecType const & x)
+{
+    return horner_scheme::evaluate<Coefficients, Fused>(x);
+}
+
+/* estrin's scheme: a few more multiplications for the powers of x, but shorter dependency chains */
+template <typename Coefficients, bool Fused = true, typename VecType>
+always_inline VecType estrin(VecType const & x)
+{
+    return estrin_scheme::evaluate<Coefficients, Fused>(x);
+}
+
+/* P(x) / Q(x), numerator and denominator are evaluated independently */
+template <typename NumeratorCoefficients, typename DenominatorCoefficients,
+          typename Scheme = horner_scheme, bool Fused = true, typename VecType>
+always_inline VecType rational(VecType const & x)
+{
+    const VecType numerator   = Scheme::template evaluate<NumeratorCoefficients, Fused>(x);
+    const VecType denominator = Scheme::template evaluate<DenominatorCoefficients, Fused>(x);
+    return numerator / denominator;
+}
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_POLYNOMIAL_HPP */
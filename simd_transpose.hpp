@@ -0,0 +1,153 @@
+//  matrix transposition
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_TRANSPOSE_HPP
+#define SIMD_TRANSPOSE_HPP
+
+#include <algorithm>
+
+#include "vec.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* matrices are stored row by row, dest[column * dest_stride + row] = src[row * src_stride + column].
+ *
+ * the simd functions split the matrix into tiles of vec<F>::size x vec<F>::size samples, which are
+ * transposed in registers with the transpose primitive of the vec class: transpose(rows) transposes the
+ * vec<F>::size x vec<F>::size matrix, whose rows are given in rows[0], ..., rows[size - 1]. the buffers
+ * have no alignment requirements and must not overlap */
+
+namespace nova {
+
+namespace detail {
+
+template <typename F>
+inline void transpose_scalar(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride,
+                             unsigned int rows, unsigned int columns)
+{
+    for (unsigned int row = 0; row != rows; ++row)
+        for (unsigned int column = 0; column != columns; ++column)
+            dest[column * dest_stride + row] = src[row * src_stride + column];
+}
+
+template <typename F>
+always_inline void transpose_tile(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride)
+{
+    const int size = vec<F>::size;
+
+    vec<F> rows[size];
+    for (int i = 0; i != size; ++i)
+        rows[i].load(src + i * src_stride);
+
+    transpose(rows);
+
+    for (int i = 0; i != size; ++i)
+        rows[i].store(dest + i * dest_stride);
+}
+
+/* blocks, which are narrower than vec<F>, are transposed by the vec class with the registers of a
+ * narrower instruction set */
+template <unsigned int n, typename F, bool narrow = (n < vec<F>::size)>
+struct block_transposer
+{
+    static always_inline void run(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride)
+    {
+        const unsigned int size = vec<F>::size;
+
+        for (unsigned int row = 0; row != n; row += size)
+            for (unsigned int column = 0; column != n; column += size)
+                transpose_tile(dest + column * dest_stride + row, dest_stride,
+                               src + row * src_stride + column, src_stride);
+    }
+};
+
+template <typename F>
+struct block_transposer<4, F, true>
+{
+    static always_inline void run(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride)
+    {
+        vec<F>::transpose_4x4(dest, dest_stride, src, src_stride);
+    }
+};
+
+template <typename F>
+struct block_transposer<8, F, true>
+{
+    static always_inline void run(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride)
+    {
+        vec<F>::transpose_8x8(dest, dest_stride, src, src_stride);
+    }
+};
+
+/* the tiles are processed in blocks of transpose_block_size x transpose_block_size samples, so that
+ * the cache lines of the destination are completed before they are evicted */
+static const unsigned int transpose_block_size = 64;
+
+}
+
+/* transpose of a rows x columns matrix, dest has columns rows of rows samples */
+template <typename F>
+inline void transpose_vec(F * dest, const F * src, unsigned int rows, unsigned int columns)
+{
+    detail::transpose_scalar(dest, rows, src, columns, rows, columns);
+}
+
+template <typename F>
+inline void transpose_vec_simd(F * dest, const F * src, unsigned int rows, unsigned int columns)
+{
+    const unsigned int size = vec<F>::size;
+    const unsigned int block = detail::transpose_block_size;
+    const unsigned int tiled_rows    = rows    - rows % size;
+    const unsigned int tiled_columns = columns - columns % size;
+
+    for (unsigned int row_block = 0; row_block < tiled_rows; row_block += block) {
+        const unsigned int row_end = std::min(row_block + block, tiled_rows);
+
+        for (unsigned int column_block = 0; column_block < tiled_columns; column_block += block) {
+            const unsigned int column_end = std::min(column_block + block, tiled_columns);
+
+            for (unsigned int row = row_block; row != row_end; row += size)
+                for (unsigned int column = column_block; column != column_end; column += size)
+                    detail::transpose_tile(dest + column * rows + row, rows, src + row * columns + column, columns);
+        }
+    }
+
+    /* the last columns of all rows, then the last rows */
+    detail::transpose_scalar(dest + tiled_columns * rows, rows, src + tiled_columns, columns,
+                             rows, columns - tiled_columns);
+    detail::transpose_scalar(dest + tiled_rows, rows, src + tiled_rows * columns, columns,
+                             rows - tiled_rows, tiled_columns);
+}
+
+/* transpose of an n x n block of a larger matrix, n has to be 4, 8 or 16 */
+template <unsigned int n, typename F>
+inline void transpose_block(F * dest, unsigned int dest_stride, const F * src, unsigned int src_stride)
+{
+    static_assert(n == 4 || n == 8 || n == 16, "transpose_block supports 4x4, 8x8 and 16x16 blocks");
+    detail::block_transposer<n, F>::run(dest, dest_stride, src, src_stride);
+}
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_TRANSPOSE_HPP */
@@ -54,6 +54,9 @@ DEFINE_UNARY_FUNCTOR(sign, sign)
 DEFINE_UNARY_FUNCTOR(square, square)
 DEFINE_UNARY_FUNCTOR(cube, cube)
 DEFINE_UNARY_FUNCTOR(reciprocal, reciprocal)
+DEFINE_UNARY_FUNCTOR(sqrt, sqrt)
+DEFINE_UNARY_FUNCTOR(rsqrt, rsqrt)
+DEFINE_UNARY_FUNCTOR(fast_rsqrt, fast_rsqrt)
 
 DEFINE_UNARY_FUNCTOR(round, round)
 DEFINE_UNARY_FUNCTOR(frac, frac)
@@ -77,6 +80,11 @@ NOVA_SIMD_DEFINE_UNARY_WRAPPER(trunc, detail::trunc_)
 
 NOVA_SIMD_DEFINE_UNARY_WRAPPER(undenormalize, detail::undenormalize_)
 NOVA_SIMD_DEFINE_UNARY_WRAPPER(reciprocal, detail::reciprocal_)
+
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(sqrt, detail::sqrt_)
+/* 1/sqrt(x): fast_rsqrt uses the hardware estimate, rsqrt refines it, see NOVA_SIMD_RSQRT_NEWTON_STEPS */
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(rsqrt, detail::rsqrt_)
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(fast_rsqrt, detail::fast_rsqrt_)
 } /* namespace nova */
 
 #undef always_inline
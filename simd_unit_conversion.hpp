@@ -45,8 +45,7 @@ struct midi2freq
     template <typename FloatType>
     always_inline FloatType operator()(const FloatType & midi) const
     {
-        return (FloatType)440. * pow_()(FloatType(2.),
-                                                     (midi - FloatType(69.)) * FloatType(0.083333333333));
+        return (FloatType)440. * exp2_()((midi - FloatType(69.)) * FloatType(0.083333333333));
     }
 };
 
@@ -64,7 +63,7 @@ struct midi2ratio
     template <typename FloatType>
     always_inline FloatType operator()(const FloatType & midi) const
     {
-        return pow_()(FloatType(2.), midi * FloatType(0.083333333333));
+        return exp2_()(midi * FloatType(0.083333333333));
     }
 };
 
@@ -82,7 +81,7 @@ struct oct2freq
     template <typename FloatType>
     always_inline FloatType operator()(const FloatType & note) const
     {
-        return FloatType(440.) * pow_()(FloatType(2.), note - FloatType(4.75));
+        return FloatType(440.) * exp2_()(note - FloatType(4.75));
     }
 };
 
@@ -110,7 +109,8 @@ struct db2amp
     template <typename FloatType>
     always_inline FloatType operator()(const FloatType & db) const
     {
-        return pow_()(FloatType(10.), db * FloatType(0.05));
+        /* 10**(db/20) = 2**(db log2(10)/20) */
+        return exp2_()(db * FloatType(0.16609640474436813));
     }
 };
 
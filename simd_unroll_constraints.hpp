@@ -20,8 +20,30 @@
 #ifndef SIMD_UNROLL_CONSTRAINTS_HPP
 #define SIMD_UNROLL_CONSTRAINTS_HPP
 
+#include <cstddef>
+
 #include "vec.hpp"
 
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* the _simd_stream functions use non-temporal stores for output buffers of at least
+ * NOVA_SIMD_STREAM_THRESHOLD bytes. for smaller buffers, regular stores are faster, since the
+ * output usually stays in the cache until it is used */
+#ifndef NOVA_SIMD_STREAM_THRESHOLD
+#define NOVA_SIMD_STREAM_THRESHOLD (4 * 1024 * 1024)
+#endif
+
+/* the unrolled loops prefetch their input buffers NOVA_SIMD_PREFETCH_DISTANCE bytes ahead, once per
+ * cache line. the hardware prefetchers usually handle a few streams well, so software prefetching is
+ * disabled by default. it may help kernels that read many streams, e.g. when mixing many channels */
+#ifndef NOVA_SIMD_PREFETCH_DISTANCE
+#define NOVA_SIMD_PREFETCH_DISTANCE 0
+#endif
+
 namespace nova
 {
 
@@ -29,8 +51,33 @@ template <typename float_type>
 struct unroll_constraints
 {
     static const unsigned int samples_per_loop = vec<float_type>::objects_per_cacheline;
+
+    /* with avx512, a single vector fills a whole cache line */
+    static const unsigned int vectors_per_loop = samples_per_loop / vec<float_type>::size;
+
+    static_assert(samples_per_loop % vec<float_type>::size == 0,
+                  "unrolled loops need to process whole vectors");
 };
 
+namespace detail {
+
+template <typename float_type>
+inline bool use_stream_stores(unsigned int n)
+{
+    return std::size_t(n) * sizeof(float_type) >= std::size_t(NOVA_SIMD_STREAM_THRESHOLD);
+}
+
+template <typename float_type>
+always_inline void prefetch_ahead(const float_type * address, std::size_t distance)
+{
+    if (distance)
+        vec<float_type>::prefetch(address + distance / sizeof(float_type));
+}
+
+} /* namespace detail */
+
 } /* namespace nova */
 
+#undef always_inline
+
 #endif /* SIMD_UNROLL_CONSTRAINTS_HPP */
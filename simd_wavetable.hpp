@@ -0,0 +1,161 @@
+//  table lookup with interpolation
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef SIMD_WAVETABLE_HPP
+#define SIMD_WAVETABLE_HPP
+
+#include "vec.hpp"
+
+#include "detail/table_index.hpp"
+#include "detail/wrap_argument_vector.hpp"
+#include "detail/unroll_helpers.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* the table is periodic and its size needs to be a power of two. the phase is given in samples and
+ * needs to be in the range [0, table_size). the points around the phase are wrapped into the table,
+ * so the interpolation of the last segment uses the first samples of the table */
+
+namespace nova {
+namespace interpolation {
+
+struct none {};     /* table[floor(phase)] */
+struct linear {};   /* two points */
+struct cubic {};    /* four points, hermite */
+
+}
+
+namespace detail {
+
+template <typename FloatType, typename Interpolation>
+struct table_read
+{
+    typedef vec<FloatType> vec_type;
+    typedef table_index<vec_type> index_traits;
+    typedef typename index_traits::type index_vec;
+
+    table_read(const FloatType * table, unsigned int table_size):
+        table_(table), mask_(table_size - 1)
+    {}
+
+    always_inline FloatType operator()(FloatType phase) const
+    {
+        const int index = int(phase);
+        return interpolate(index, phase - FloatType(index), Interpolation());
+    }
+
+    always_inline vec_type operator()(vec_type const & phase) const
+    {
+        const index_vec index = index_traits::truncate(phase);
+        return interpolate(index, phase - vec_type(index.convert_to_float()), Interpolation());
+    }
+
+private:
+    always_inline FloatType load(int index) const
+    {
+        return table_[index & mask_];
+    }
+
+    always_inline vec_type load(index_vec const & index) const
+    {
+        return index_traits::gather(table_, index & index_vec(mask_));
+    }
+
+    template <typename IndexType, typename ValueType>
+    always_inline ValueType interpolate(IndexType const & index, ValueType const &, interpolation::none) const
+    {
+        return load(index);
+    }
+
+    template <typename IndexType, typename ValueType>
+    always_inline ValueType interpolate(IndexType const & index, ValueType const & frac, interpolation::linear) const
+    {
+        const ValueType y0 = load(index);
+        const ValueType y1 = load(index + IndexType(1));
+        return y0 + frac * (y1 - y0);
+    }
+
+    template <typename IndexType, typename ValueType>
+    always_inline ValueType interpolate(IndexType const & index, ValueType const & frac, interpolation::cubic) const
+    {
+        const ValueType ym1 = load(index + IndexType(-1));
+        const ValueType y0  = load(index);
+        const ValueType y1  = load(index + IndexType(1));
+        const ValueType y2  = load(index + IndexType(2));
+
+        const ValueType half(0.5);
+        const ValueType c1 = half * (y1 - ym1);
+        const ValueType c2 = ym1 - ValueType(2.5) * y0 + (y1 + y1) - half * y2;
+        const ValueType c3 = half * (y2 - ym1) + ValueType(1.5) * (y0 - y1);
+
+        return ((c3 * frac + c2) * frac + c1) * frac + y0;
+    }
+
+    const FloatType * table_;
+    int mask_;
+};
+
+template <typename FloatType, typename PhaseArg, typename Functor>
+always_inline void table_read_loop(FloatType * out, PhaseArg phase, unsigned int n, Functor const & f)
+{
+    do {
+        *out++ = f(phase.consume());
+    } while (--n);
+}
+
+template <unsigned int n, typename FloatType, typename PhaseArg, typename Functor>
+always_inline void table_read_unrolled(FloatType * out, PhaseArg phase, Functor const & f)
+{
+    compile_time_unroller<FloatType, n>::run(out, phase, f);
+}
+
+}
+
+/* out[i] = table[phase[i]], phase is a buffer or a ramp, e.g. wrap_argument(base, slope) */
+template <typename Interpolation, typename FloatType, typename PhaseArg>
+inline void table_read_vec(FloatType * out, const FloatType * table, unsigned int table_size, PhaseArg phase,
+                           unsigned int n)
+{
+    const detail::table_read<FloatType, Interpolation> f(table, table_size);
+    detail::table_read_loop(out, wrap_argument(phase), n, f);
+}
+
+template <typename Interpolation, typename FloatType, typename PhaseArg>
+inline void table_read_vec_simd(FloatType * out, const FloatType * table, unsigned int table_size, PhaseArg phase,
+                                unsigned int n)
+{
+    const detail::table_read<FloatType, Interpolation> f(table, table_size);
+    detail::generate_simd_loop(out, detail::wrap_vector_arg(wrap_argument(phase)), n, f);
+}
+
+template <unsigned int n, typename Interpolation, typename FloatType, typename PhaseArg>
+inline void table_read_vec_simd(FloatType * out, const FloatType * table, unsigned int table_size, PhaseArg phase)
+{
+    const detail::table_read<FloatType, Interpolation> f(table, table_size);
+    detail::table_read_unrolled<n>(out, detail::wrap_vector_arg(wrap_argument(phase)), f);
+}
+
+}
+
+#undef always_inline
+
+#endif /* SIMD_WAVETABLE_HPP */
@@ -19,6 +19,7 @@
 #ifndef SIMD_SOFTCLIP_HPP
 #define SIMD_SOFTCLIP_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -88,9 +89,80 @@ struct softclip
 #endif
 };
 
+/* algebraic sigmoids x / (1 + |x|**order)**(1/order): smooth saturation curves with unity gain
+ * around 0, which approach -1 and 1. higher orders have a sharper knee.
+ * the argument is clamped, so that |x|**order does not overflow */
+template <unsigned int Order>
+struct algebraic_sigmoid;
+
+template <>
+struct algebraic_sigmoid<1>
+{
+    template <typename FloatType>
+    always_inline FloatType operator()(FloatType arg) const
+    {
+        const FloatType x = std::max(std::min(arg, FloatType(1e30)), FloatType(-1e30));
+        return x / (FloatType(1) + std::fabs(x));
+    }
+
+    template <typename FloatType>
+    always_inline vec<FloatType> operator()(vec<FloatType> arg) const
+    {
+        typedef vec<FloatType> vec_type;
+
+        const vec_type x = max_(min_(arg, vec_type(FloatType(1e30))), vec_type(FloatType(-1e30)));
+        return x / (vec_type(FloatType(1)) + abs(x));
+    }
+};
+
+template <>
+struct algebraic_sigmoid<2>
+{
+    template <typename FloatType>
+    always_inline FloatType operator()(FloatType arg) const
+    {
+        const FloatType x = std::max(std::min(arg, FloatType(1e18)), FloatType(-1e18));
+        return x / std::sqrt(FloatType(1) + x * x);
+    }
+
+    template <typename FloatType>
+    always_inline vec<FloatType> operator()(vec<FloatType> arg) const
+    {
+        typedef vec<FloatType> vec_type;
+
+        const vec_type x = max_(min_(arg, vec_type(FloatType(1e18))), vec_type(FloatType(-1e18)));
+        return x * rsqrt(madd(x, x, vec_type(FloatType(1))));
+    }
+};
+
+template <>
+struct algebraic_sigmoid<4>
+{
+    template <typename FloatType>
+    always_inline FloatType operator()(FloatType arg) const
+    {
+        const FloatType x = std::max(std::min(arg, FloatType(1e9)), FloatType(-1e9));
+        const FloatType x2 = x * x;
+        return x / std::sqrt(std::sqrt(FloatType(1) + x2 * x2));
+    }
+
+    template <typename FloatType>
+    always_inline vec<FloatType> operator()(vec<FloatType> arg) const
+    {
+        typedef vec<FloatType> vec_type;
+
+        const vec_type x = max_(min_(arg, vec_type(FloatType(1e9))), vec_type(FloatType(-1e9)));
+        const vec_type x2 = x * x;
+        return x * sqrt(rsqrt(madd(x2, x2, vec_type(FloatType(1)))));
+    }
+};
+
 } /* namespace detail */
 
 NOVA_SIMD_DEFINE_UNARY_WRAPPER(softclip, detail::softclip)
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(algebraic_sigmoid1, detail::algebraic_sigmoid<1>)
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(algebraic_sigmoid2, detail::algebraic_sigmoid<2>)
+NOVA_SIMD_DEFINE_UNARY_WRAPPER(algebraic_sigmoid4, detail::algebraic_sigmoid<4>)
 
 
 } /* namespace nova */
@@ -0,0 +1,17 @@
+# the dispatch objects may only export their kernel table. other global symbols (e.g. inline std::
+# functions) would be shared with the other translation units, although they have been compiled
+# with the instruction set of the target. symbols of the target-specific namespace are unique.
+foreach(object ${OBJECTS})
+  execute_process(COMMAND ${NM} -g --defined-only ${object}
+                  OUTPUT_VARIABLE symbols RESULT_VARIABLE status)
+  if(NOT status EQUAL 0)
+    message(FATAL_ERROR "cannot read the symbols of ${object}")
+  endif()
+
+  string(REPLACE "\n" ";" symbols "${symbols}")
+  foreach(symbol ${symbols})
+    if(NOT symbol MATCHES "kernel_tables_" AND NOT symbol MATCHES "nova_dispatch_")
+      message(FATAL_ERROR "${object} shares a symbol with other translation units: ${symbol}")
+    endif()
+  endforeach()
+endforeach()
@@ -0,0 +1,176 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "test_helper.hpp"
+
+#include "../simd_allocator.hpp"
+#include "../simd_binary_arithmetic.hpp"
+
+using namespace nova;
+using namespace std;
+
+static bool is_aligned(const void * ptr)
+{
+    return (size_t(ptr) & (malloc_memory_alignment - 1)) == 0;
+}
+
+BOOST_AUTO_TEST_CASE( alignment_test )
+{
+    static const size_t sizes[] = {1, 63, 64, 65, 200, 256, 1000, 4096, 16383, 16384, 16385, 100000};
+    const size_t count = sizeof(sizes) / sizeof(sizes[0]);
+
+    aligned_pool & pool = aligned_pool::this_thread();
+    BOOST_REQUIRE_EQUAL( &pool, &aligned_pool::this_thread() );
+
+    for (int run = 0; run != 100; ++run) {
+        vector<pair<char*, size_t> > buffers;
+        for (size_t i = 0; i != count; ++i) {
+            char * buffer = static_cast<char*>(pool.allocate(sizes[i]));
+            BOOST_REQUIRE( buffer );
+            BOOST_REQUIRE( is_aligned(buffer) );
+            memset(buffer, int(i), sizes[i]);
+            buffers.push_back(make_pair(buffer, sizes[i]));
+        }
+
+        /* no buffer overlaps another one */
+        sort(buffers.begin(), buffers.end());
+        for (size_t i = 1; i != count; ++i)
+            BOOST_REQUIRE( buffers[i - 1].first + buffers[i - 1].second <= buffers[i].first );
+
+        for (size_t i = 0; i != count; ++i)
+            pool.deallocate(buffers[i].first, buffers[i].second);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( reuse_test )
+{
+    aligned_pool & pool = aligned_pool::this_thread();
+
+    void * buffer = pool.allocate(256);
+    pool.deallocate(buffer, 256);
+    BOOST_REQUIRE_EQUAL( pool.allocate(200), buffer ); /* same size class */
+    pool.deallocate(buffer, 200);
+}
+
+/* buffers freed by other threads are returned to the pool they were allocated from */
+BOOST_AUTO_TEST_CASE( remote_deallocation_test )
+{
+    const size_t bytes = 8192;
+    const size_t count = 1000;
+    const size_t thread_count = 4;
+
+    aligned_pool & pool = aligned_pool::this_thread();
+
+    vector<void*> buffers;
+    for (size_t i = 0; i != count; ++i)
+        buffers.push_back(pool.allocate(bytes));
+
+    vector<thread> threads;
+    for (size_t t = 0; t != thread_count; ++t)
+        threads.push_back(thread([&, t] {
+            for (size_t i = t; i < count; i += thread_count)
+                pool.deallocate(buffers[i], bytes);
+        }));
+    for (size_t t = 0; t != thread_count; ++t)
+        threads[t].join();
+
+    set<void*> freed(buffers.begin(), buffers.end());
+    for (size_t i = 0; i != count; ++i) {
+        void * buffer = pool.allocate(bytes);
+        BOOST_REQUIRE_EQUAL( freed.erase(buffer), 1u );
+    }
+}
+
+/* the pool of an exited thread is reused by the next thread */
+BOOST_AUTO_TEST_CASE( thread_exit_test )
+{
+    aligned_pool * first_pool = nullptr;
+    void * buffer = nullptr;
+
+    thread([&] {
+        first_pool = &aligned_pool::this_thread();
+        buffer = first_pool->allocate(512);
+        first_pool->deallocate(buffer, 512);
+    }).join();
+
+    thread([&] {
+        aligned_pool & pool = aligned_pool::this_thread();
+        BOOST_REQUIRE_EQUAL( &pool, first_pool );
+        BOOST_REQUIRE_EQUAL( pool.allocate(512), buffer );
+        pool.deallocate(buffer, 512);
+    }).join();
+
+    BOOST_REQUIRE( &aligned_pool::this_thread() != first_pool );
+}
+
+BOOST_AUTO_TEST_CASE( allocator_test )
+{
+    typedef vector<float, pool_allocator<float> > buffer_type;
+    const unsigned int size = 1024;
+
+    buffer_type in1(size), in2(size), out(size);
+    BOOST_REQUIRE( is_aligned(in1.data()) && is_aligned(in2.data()) && is_aligned(out.data()) );
+    BOOST_REQUIRE( in1.get_allocator() == pool_allocator<int>() );
+
+    randomize_buffer<float>(in1.data(), size);
+    randomize_buffer<float>(in2.data(), size);
+    plus_vec_simd(out.data(), in1.data(), in2.data(), size);
+    for (unsigned int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL( out[i], in1[i] + in2[i] );
+
+    /* larger than max_block_size */
+    buffer_type large(100000, 1.f);
+    BOOST_REQUIRE( is_aligned(large.data()) );
+
+    /* node-based containers rebind the allocator */
+    list<int, pool_allocator<int> > nodes;
+    for (int i = 0; i != 1000; ++i)
+        nodes.push_back(i);
+    BOOST_REQUIRE_EQUAL( nodes.size(), 1000u );
+
+    /* destroyed by another thread */
+    buffer_type * moved = new buffer_type(std::move(out));
+    thread([=] { delete moved; }).join();
+}
+
+/* containers, which are copied or grown by another thread, allocate from the pool of that thread */
+BOOST_AUTO_TEST_CASE( allocator_thread_test )
+{
+    typedef vector<float, pool_allocator<float> > buffer_type;
+    const unsigned int size = 1024;
+
+    buffer_type buffer(size, 1.f);
+    aligned_pool * owner = &buffer.get_allocator().pool();
+
+    for (int run = 0; run != 10; ++run) {
+        thread([&] {
+            aligned_pool & pool = aligned_pool::this_thread();
+
+            buffer_type copy(buffer);
+            BOOST_REQUIRE_EQUAL( &copy.get_allocator().pool(), &pool );
+            for (unsigned int i = 0; i != 10 * size; ++i)
+                copy.push_back(float(i));
+            BOOST_REQUIRE( is_aligned(copy.data()) );
+
+            /* still bound to the pool of the main thread */
+            for (unsigned int i = 0; i != 10 * size; ++i)
+                buffer.push_back(float(i));
+            BOOST_REQUIRE( is_aligned(buffer.data()) );
+            buffer.resize(size);
+            buffer.shrink_to_fit();
+        }).join();
+
+        BOOST_REQUIRE_EQUAL( &buffer.get_allocator().pool(), owner );
+        BOOST_REQUIRE_EQUAL( buffer.size(), size );
+        for (unsigned int i = 0; i != size; ++i)
+            BOOST_REQUIRE_EQUAL( buffer[i], 1.f );
+    }
+}
@@ -0,0 +1,208 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include "../simd_convert.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "test_helper.hpp"
+
+using namespace nova;
+using namespace std;
+
+
+static const unsigned int size = 80; /* not a multiple of the block size */
+
+/* random samples slightly beyond full scale, so that the saturation is covered */
+template <typename float_type>
+void fill_samples(float_type * buffer)
+{
+    randomize_buffer<float_type>(buffer, size);
+    for (unsigned int i = 0; i != size; ++i)
+        buffer[i] *= float_type(1.25);
+
+    buffer[0] = 1;
+    buffer[1] = -1;
+    buffer[2] = 0;
+}
+
+template <typename float_type>
+void int16_tests(void)
+{
+    aligned_array<float_type, size> in, out, out_simd;
+    int16_t pcm[size], pcm_simd[size];
+    fill_samples(in.c_array());
+
+    float_to_int16_vec(pcm, in.c_array(), size);
+    float_to_int16_vec_simd(pcm_simd, in.c_array(), size);
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(pcm[i], pcm_simd[i]);
+        BOOST_REQUIRE_EQUAL(pcm[i], int16_t(max(min(nearbyint(double(in[i]) * 32768.0), 32767.0), -32768.0)));
+    }
+    BOOST_REQUIRE_EQUAL(pcm[0], 32767);
+    BOOST_REQUIRE_EQUAL(pcm[1], -32768);
+
+    int16_to_float_vec(out.c_array(), pcm, size);
+    int16_to_float_vec_simd(out_simd.c_array(), pcm, size);
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(out[i], out_simd[i]);
+        BOOST_REQUIRE_EQUAL(out[i], float_type(pcm[i]) / float_type(32768));
+    }
+}
+
+BOOST_AUTO_TEST_CASE( int16_test )
+{
+    int16_tests<float>();
+    int16_tests<double>();
+}
+
+template <typename float_type>
+void int24_tests(void)
+{
+    aligned_array<float_type, size> in, out, out_simd;
+    uint8_t pcm[3 * size], pcm_simd[3 * size];
+    fill_samples(in.c_array());
+
+    float_to_int24_vec(pcm, in.c_array(), size);
+    float_to_int24_vec_simd(pcm_simd, in.c_array(), size);
+    for (unsigned int i = 0; i != 3 * size; ++i)
+        BOOST_REQUIRE_EQUAL(pcm[i], pcm_simd[i]);
+
+    /* full scale, little endian */
+    BOOST_REQUIRE_EQUAL(pcm[0], 0xff); BOOST_REQUIRE_EQUAL(pcm[1], 0xff); BOOST_REQUIRE_EQUAL(pcm[2], 0x7f);
+    BOOST_REQUIRE_EQUAL(pcm[3], 0x00); BOOST_REQUIRE_EQUAL(pcm[4], 0x00); BOOST_REQUIRE_EQUAL(pcm[5], 0x80);
+
+    int24_to_float_vec(out.c_array(), pcm, size);
+    int24_to_float_vec_simd(out_simd.c_array(), pcm, size);
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(out[i], out_simd[i]);
+
+        const double expected = max(min(nearbyint(double(in[i]) * 8388608.0), 8388607.0), -8388608.0) / 8388608.0;
+        BOOST_REQUIRE_EQUAL(out[i], float_type(expected));
+    }
+    BOOST_REQUIRE_EQUAL(out[1], float_type(-1));
+}
+
+BOOST_AUTO_TEST_CASE( int24_test )
+{
+    int24_tests<float>();
+    int24_tests<double>();
+}
+
+template <typename float_type>
+void int32_tests(void)
+{
+    aligned_array<float_type, size> in, out, out_simd;
+    int32_t pcm[size], pcm_simd[size];
+    fill_samples(in.c_array());
+
+    float_to_int32_vec(pcm, in.c_array(), size);
+    float_to_int32_vec_simd(pcm_simd, in.c_array(), size);
+    for (unsigned int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL(pcm[i], pcm_simd[i]);
+
+    /* 2**31 - 1 for double, the largest float below 2**31 for float */
+    BOOST_REQUIRE_EQUAL(pcm[0], sizeof(float_type) == 4 ? 2147483520 : 2147483647);
+    BOOST_REQUIRE_EQUAL(pcm[1], -2147483647 - 1);
+
+    int32_to_float_vec(out.c_array(), pcm, size);
+    int32_to_float_vec_simd(out_simd.c_array(), pcm, size);
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(out[i], out_simd[i]);
+        BOOST_REQUIRE_CLOSE_FRACTION(out[i], max(min(in[i], float_type(1)), float_type(-1)), 1e-6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( int32_test )
+{
+    int32_tests<float>();
+    int32_tests<double>();
+}
+
+/* the dither adds at most one lsb and has zero mean */
+template <typename float_type>
+void dither_tests(void)
+{
+    const unsigned int blocks = 1024;
+    aligned_array<float_type, size> in;
+    int16_t pcm[size], pcm_dithered[size], pcm_dithered_simd[size];
+
+    tpdf_dither<float_type> dither(42), dither_simd(42);
+    double sum = 0, sum_simd = 0;
+    bool simd_changed = false;
+
+    for (unsigned int block = 0; block != blocks; ++block) {
+        randomize_buffer<float_type>(in.c_array(), size);
+        for (unsigned int i = 0; i != size; ++i)
+            in[i] *= float_type(0.5);
+
+        float_to_int16_vec(pcm, in.c_array(), size);
+        float_to_int16_vec(pcm_dithered, in.c_array(), size, dither);
+        float_to_int16_vec_simd(pcm_dithered_simd, in.c_array(), size, dither_simd);
+
+        for (unsigned int i = 0; i != size; ++i) {
+            const double exact = double(in[i]) * 32768.0;
+            BOOST_REQUIRE_LE(abs(pcm_dithered[i] - exact), 1.5);
+            BOOST_REQUIRE_LE(abs(pcm_dithered_simd[i] - exact), 1.5);
+            sum      += pcm_dithered[i] - exact;
+            sum_simd += pcm_dithered_simd[i] - exact;
+            if (pcm_dithered_simd[i] != pcm[i])
+                simd_changed = true;
+        }
+    }
+
+    BOOST_REQUIRE_LE(abs(sum / (blocks * size)), 0.02);
+    BOOST_REQUIRE_LE(abs(sum_simd / (blocks * size)), 0.02);
+    BOOST_REQUIRE(simd_changed);
+}
+
+BOOST_AUTO_TEST_CASE( dither_test )
+{
+    dither_tests<float>();
+    dither_tests<double>();
+}
+
+/* nan is converted to 0 */
+template <typename float_type>
+void nan_tests(void)
+{
+    aligned_array<float_type, size> in;
+    fill_samples(in.c_array());
+    for (unsigned int i = 0; i < size; i += 3)
+        in[i] = std::numeric_limits<float_type>::quiet_NaN();
+
+    int16_t pcm16[size], pcm16_simd[size], pcm16_dithered_simd[size];
+    uint8_t pcm24[3 * size], pcm24_simd[3 * size];
+    int32_t pcm32[size], pcm32_simd[size];
+    tpdf_dither<float_type> dither(42);
+
+    float_to_int16_vec(pcm16, in.c_array(), size);
+    float_to_int16_vec_simd(pcm16_simd, in.c_array(), size);
+    float_to_int16_vec_simd(pcm16_dithered_simd, in.c_array(), size, dither);
+    float_to_int24_vec(pcm24, in.c_array(), size);
+    float_to_int24_vec_simd(pcm24_simd, in.c_array(), size);
+    float_to_int32_vec(pcm32, in.c_array(), size);
+    float_to_int32_vec_simd(pcm32_simd, in.c_array(), size);
+
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(pcm16[i], pcm16_simd[i]);
+        BOOST_REQUIRE_EQUAL(pcm32[i], pcm32_simd[i]);
+        for (unsigned int byte = 0; byte != 3; ++byte)
+            BOOST_REQUIRE_EQUAL(pcm24[3 * i + byte], pcm24_simd[3 * i + byte]);
+
+        if (i % 3 == 0) {
+            BOOST_REQUIRE_EQUAL(pcm16[i], 0);
+            BOOST_REQUIRE_EQUAL(pcm16_dithered_simd[i], 0);
+            BOOST_REQUIRE_EQUAL(pcm32[i], 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( nan_test )
+{
+    nan_tests<float>();
+    nan_tests<double>();
+}
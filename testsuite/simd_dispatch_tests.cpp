@@ -0,0 +1,74 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_dispatch.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 64;
+
+BOOST_AUTO_TEST_CASE( resolve_on_first_call )
+{
+    aligned_array<float, size> out, in;
+    randomize_buffer<float>(in.c_array(), size);
+
+    dispatch::abs_vec_simd(out.c_array(), in.c_array(), size);
+    BOOST_REQUIRE_EQUAL( dispatch::current_target(), dispatch::best_target() );
+    BOOST_REQUIRE( dispatch::target_supported(dispatch::target_default) );
+}
+
+template <typename float_type>
+void compare_target(dispatch::simd_target target, float_type difference)
+{
+    aligned_array<float_type, size> out, out_dispatch, in0, in1, in2;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(in1.c_array(), size);
+    randomize_buffer<float_type>(in2.c_array(), size, float_type(1));
+
+    BOOST_REQUIRE( dispatch::set_target(target) );
+    BOOST_REQUIRE_EQUAL( dispatch::current_target(), target );
+
+    exp_vec(out.c_array(), in0.c_array(), size);
+    dispatch::exp_vec_simd(out_dispatch.c_array(), in0.c_array(), size);
+    compare_buffers(out.c_array(), out_dispatch.c_array(), size, difference);
+
+    sin_vec(out.c_array(), in0.c_array(), size);
+    dispatch::sin_vec_simd(out_dispatch.c_array(), in0.c_array(), size);
+    compare_buffers(out.c_array(), out_dispatch.c_array(), size, difference);
+
+    plus_vec(out.c_array(), in0.c_array(), in1.c_array(), size);
+    dispatch::plus_vec_simd(out_dispatch.c_array(), in0.c_array(), in1.c_array(), size);
+    compare_buffers(out.c_array(), out_dispatch.c_array(), size, difference);
+
+    times_vec(out.c_array(), in0.c_array(), float_type(0.5), size);
+    dispatch::times_vec_simd(out_dispatch.c_array(), in0.c_array(), float_type(0.5), size);
+    compare_buffers(out.c_array(), out_dispatch.c_array(), size, difference);
+
+    clip_vec(out.c_array(), in2.c_array(), in0.c_array(), in1.c_array(), size);
+    dispatch::clip_vec_simd(out_dispatch.c_array(), in2.c_array(), in0.c_array(), in1.c_array(), size);
+    compare_buffers(out.c_array(), out_dispatch.c_array(), size, difference);
+}
+
+BOOST_AUTO_TEST_CASE( dispatch_targets )
+{
+    for (int target = dispatch::target_default; target != dispatch::target_count; ++target) {
+        if (!dispatch::target_supported(dispatch::simd_target(target))) {
+            BOOST_REQUIRE( !dispatch::set_target(dispatch::simd_target(target)) );
+            continue;
+        }
+
+        compare_target<float>(dispatch::simd_target(target), 1e-5f);
+        compare_target<double>(dispatch::simd_target(target), 1e-5);
+    }
+}
@@ -0,0 +1,94 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_unary_arithmetic.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 256;
+
+/* out = tanh(a*b+c) * gain_ramp, compared with three separate passes. the fused kernels compute the
+ * same operations in the same order as the separate passes, so they agree to a few ulp */
+template <typename float_type>
+void test_fused(void)
+{
+    aligned_array<float_type, size> a, b, c, tmp, out, out_fused, out_simd, out_unrolled, out_any;
+    randomize_buffer<float_type>(a.c_array(), size);
+    randomize_buffer<float_type>(b.c_array(), size);
+    randomize_buffer<float_type>(c.c_array(), size);
+
+    const float_type * pa = a.c_array();
+    const float_type * pb = b.c_array();
+    const float_type * pc = c.c_array();
+    const float_type gain = 0.5, slope = 0.001;
+    const float difference = 4 * std::numeric_limits<float_type>::epsilon();
+
+    muladd_vec(tmp.c_array(), pa, pb, pc, size);
+    tanh_vec(tmp.c_array(), tmp.c_array(), size);
+    times_vec(out.c_array(), tmp.c_array(), slope_argument(gain, slope), size);
+
+    fused_vec(out_fused.c_array(), times_expr(tanh_expr(muladd_expr(pa, pb, pc)), slope_argument(gain, slope)), size);
+    compare_buffers(out.c_array(), out_fused.c_array(), size, difference);
+
+    /* the vectorized tanh differs from libm, the simd kernels are compared with the simd passes */
+    muladd_vec_simd(tmp.c_array(), pa, pb, pc, size);
+    tanh_vec_simd(tmp.c_array(), tmp.c_array(), size);
+    times_vec_simd(out.c_array(), tmp.c_array(), slope_argument(gain, slope), size);
+
+    fused_vec_simd(out_simd.c_array(), times_expr(tanh_expr(muladd_expr(pa, pb, pc)), slope_argument(gain, slope)), size);
+    fused_vec_simd<size>(out_unrolled.c_array(), times_expr(tanh_expr(muladd_expr(pa, pb, pc)), slope_argument(gain, slope)));
+    fused_vec_simd_any(out_any.c_array(), times_expr(tanh_expr(muladd_expr(pa, pb, pc)), slope_argument(gain, slope)), size);
+
+    compare_buffers(out.c_array(), out_simd.c_array(), size, difference);
+    compare_buffers(out.c_array(), out_unrolled.c_array(), size, difference);
+    compare_buffers(out.c_array(), out_any.c_array(), size, difference);
+}
+
+BOOST_AUTO_TEST_CASE( fused_tests )
+{
+    test_fused<float>();
+    test_fused<double>();
+}
+
+/* scalar arguments, arbitrary sizes and unaligned buffers */
+template <typename float_type>
+void test_fused_any(void)
+{
+    const unsigned int sizes[] = {1, 7, 37, 100, 253};
+    for (unsigned int s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s) {
+        const unsigned int n = sizes[s];
+        aligned_array<float_type, size> a, b, out, out_any;
+        randomize_buffer<float_type>(a.c_array(), size);
+        randomize_buffer<float_type>(b.c_array(), size);
+        for (unsigned int i = 0; i != size; ++i)
+            out[i] = out_any[i] = float_type(-1);
+
+        const float_type * pa = a.c_array() + 1;
+        const float_type * pb = b.c_array() + 2;
+
+        for (unsigned int i = 0; i != n; ++i)
+            out[i + 3] = std::max(std::abs(pa[i] - pb[i]), float_type(0.25)) * float_type(2);
+
+        fused_vec_simd_any(out_any.c_array() + 3, times_expr(max_expr(abs_expr(minus_expr(pa, pb)), float_type(0.25)),
+                                                             float_type(2)), n);
+
+        compare_buffers(out.c_array(), out_any.c_array(), size);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( fused_any_tests )
+{
+    test_fused_any<float>();
+    test_fused_any<double>();
+}
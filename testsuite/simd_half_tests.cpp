@@ -0,0 +1,213 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <limits>
+
+#include "../simd_half.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_unary_arithmetic.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "test_helper.hpp"
+
+using namespace nova;
+using namespace std;
+
+
+static const unsigned int size = 64;
+
+BOOST_AUTO_TEST_CASE( fp16_scalar_test )
+{
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(1.f), 0x3c00);
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(-2.f), 0xc000);
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(65504.f), 0x7bff);
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(65520.f), 0x7c00);                /* rounds to inf */
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(ldexp(1.f, -24)), 0x0001);        /* smallest subnormal */
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(ldexp(1.f, -25)), 0x0000);        /* tie, rounds to even */
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(1.f + ldexp(1.f, -11)), 0x3c00);  /* tie, rounds to even */
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(1.f + ldexp(3.f, -11)), 0x3c02);
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(-numeric_limits<float>::infinity()), 0xfc00);
+    BOOST_REQUIRE_EQUAL(detail::float_to_fp16(numeric_limits<float>::quiet_NaN()) & 0x7e00, 0x7e00);
+
+    /* every fp16 value is exactly representable in single precision */
+    for (unsigned int i = 0; i != 0x10000; ++i) {
+        const uint16_t half = uint16_t(i);
+        const float value = detail::fp16_to_float(half);
+        if ((half & 0x7fff) > 0x7c00)
+            BOOST_REQUIRE(std::isnan(value));
+        else
+            BOOST_REQUIRE_EQUAL(detail::float_to_fp16(value), half);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( bf16_scalar_test )
+{
+    BOOST_REQUIRE_EQUAL(detail::float_to_bf16(1.f), 0x3f80);
+    BOOST_REQUIRE_EQUAL(detail::float_to_bf16(1.f + ldexp(1.f, -8)), 0x3f80);   /* tie, rounds to even */
+    BOOST_REQUIRE_EQUAL(detail::float_to_bf16(1.f + ldexp(3.f, -8)), 0x3f82);
+    BOOST_REQUIRE_EQUAL(detail::float_to_bf16(numeric_limits<float>::max()), 0x7f80);
+    BOOST_REQUIRE_EQUAL(detail::float_to_bf16(numeric_limits<float>::infinity()), 0x7f80);
+    BOOST_REQUIRE(std::isnan(detail::bf16_to_float(detail::float_to_bf16(numeric_limits<float>::quiet_NaN()))));
+    BOOST_REQUIRE_EQUAL(detail::bf16_to_float(0xc040), -3.f);
+}
+
+/* the vector conversions have to match the scalar code bit by bit */
+template <typename Format>
+void vec_conversion_tests(void)
+{
+    const int vec_size = vec<float>::size;
+    uint16_t halves[vec_size], halves_simd[vec_size];
+    float values[vec_size];
+
+    for (unsigned int i = 0; i != 0x10000; i += vec_size) {
+        for (int j = 0; j != vec_size; ++j)
+            halves[j] = uint16_t(i + j);
+
+        vec<float> value;
+        Format::load(value, halves);
+        for (int j = 0; j != vec_size; ++j) {
+            const float expected = Format::to_float(halves[j]);
+            if (std::isnan(expected))
+                BOOST_REQUIRE(std::isnan(value.get(j)));
+            else
+                BOOST_REQUIRE_EQUAL(detail::float_bits(value.get(j)), detail::float_bits(expected));
+        }
+    }
+
+    /* a sample of all bit patterns, including subnormals, infinities and nans */
+    for (uint64_t bits = 0; bits < 0x100000000ull; bits += 4093 * vec_size) {
+        for (int j = 0; j != vec_size; ++j)
+            values[j] = detail::bits_float(uint32_t(bits + 4093 * j));
+
+        vec<float> value;
+        value.load(values);
+        Format::store(value, halves_simd);
+        for (int j = 0; j != vec_size; ++j)
+            halves[j] = Format::from_float(values[j]);
+
+        for (int j = 0; j != vec_size; ++j)
+            BOOST_REQUIRE_EQUAL(halves[j], halves_simd[j]);
+    }
+}
+
+struct fp16_test_format:
+    detail::fp16_format
+{
+    static uint16_t from_float(float arg)                       { return detail::float_to_fp16(arg); }
+    static void store(vec<float> const & arg, uint16_t * dest)  { arg.store_fp16(dest); }
+};
+
+struct bf16_test_format:
+    detail::bf16_format
+{
+    static uint16_t from_float(float arg)                       { return detail::float_to_bf16(arg); }
+    static void store(vec<float> const & arg, uint16_t * dest)  { arg.store_bf16(dest); }
+};
+
+BOOST_AUTO_TEST_CASE( vec_conversion_test )
+{
+    vec_conversion_tests<fp16_test_format>();
+    vec_conversion_tests<bf16_test_format>();
+}
+
+/* random samples and the special cases, the rounding of the simd functions has to match the scalar code */
+static void fill_samples(float * buffer)
+{
+    randomize_buffer<float>(buffer, size, 4.f, -2.f);
+    buffer[0] = 0.f;
+    buffer[1] = -0.f;
+    buffer[2] = 1.f + ldexp(1.f, -11);
+    buffer[3] = 1.f + ldexp(1.f, -8);
+    buffer[4] = 65520.f;
+    buffer[5] = ldexp(1.f, -20);
+    buffer[6] = numeric_limits<float>::infinity();
+    buffer[7] = -numeric_limits<float>::max();
+}
+
+BOOST_AUTO_TEST_CASE( fp16_test )
+{
+    aligned_array<float, size> in, out, out_simd;
+    uint16_t half[size], half_simd[size];
+    fill_samples(in.c_array());
+
+    float_to_fp16_vec(half, in.c_array(), size);
+    float_to_fp16_vec_simd(half_simd, in.c_array(), size);
+    for (unsigned int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL(half[i], half_simd[i]);
+
+    fp16_to_float_vec(out.c_array(), half, size);
+    fp16_to_float_vec_simd(out_simd.c_array(), half, size);
+    for (unsigned int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL(out[i], out_simd[i]);
+        if (fabs(in[i]) < 65504.f)
+            BOOST_REQUIRE_LE(fabs(out[i] - in[i]), ldexp(fabs(in[i]), -11) + ldexp(1.f, -25));
+    }
+}
+
+BOOST_AUTO_TEST_CASE( bf16_test )
+{
+    aligned_array<float, size> in, out, out_simd;
+    uint16_t half[size], half_simd[size];
+    fill_samples(in.c_array());
+    in[8] = numeric_limits<float>::quiet_NaN();
+
+    float_to_bf16_vec(half, in.c_array(), size);
+    float_to_bf16_vec_simd(half_simd, in.c_array(), size);
+    for (unsigned int i = 0; i != size; ++i)
+        BOOST_REQUIRE_EQUAL(half[i], half_simd[i]);
+
+    bf16_to_float_vec(out.c_array(), half, size);
+    bf16_to_float_vec_simd(out_simd.c_array(), half, size);
+    for (unsigned int i = 0; i != size; ++i) {
+        if (i == 8) {
+            BOOST_REQUIRE(std::isnan(out[i]) && std::isnan(out_simd[i]));
+            continue;
+        }
+        BOOST_REQUIRE_EQUAL(out[i], out_simd[i]);
+        if (fabs(in[i]) < numeric_limits<float>::max())
+            BOOST_REQUIRE_LE(fabs(out[i] - in[i]), ldexp(fabs(in[i]), -8));
+    }
+}
+
+/* half precision buffers as inputs of the argument-wrapping functions */
+BOOST_AUTO_TEST_CASE( half_argument_test )
+{
+    const unsigned int n = size - 3; /* covers the tail of the _any functions */
+    aligned_array<float, size> in, reference, out;
+    uint16_t half[size + 1];
+    randomize_buffer<float>(in.c_array(), size);
+    float_to_fp16_vec(half, in.c_array(), size);
+
+    for (unsigned int i = 0; i != size; ++i)
+        reference[i] = in[i] + detail::fp16_to_float(half[i]);
+
+    plus_vec(out.c_array(), fp16_argument(half), in.c_array(), size);
+    compare_buffers(reference.c_array(), out.c_array(), size);
+
+    out.assign(0);
+    plus_vec_simd(out.c_array(), fp16_argument(half), in.c_array(), size);
+    compare_buffers(reference.c_array(), out.c_array(), size);
+
+    out.assign(0);
+    plus_vec_simd<size>(out.c_array(), in.c_array(), fp16_argument(half));
+    compare_buffers(reference.c_array(), out.c_array(), size);
+
+    out.assign(0);
+    plus_vec_simd_any(out.c_array(), fp16_argument(half), in.c_array(), n);
+    compare_buffers(reference.c_array(), out.c_array(), n);
+
+    /* unaligned half precision buffer */
+    float_to_bf16_vec(half + 1, in.c_array(), size);
+    for (unsigned int i = 0; i != size; ++i)
+        reference[i] = fabs(detail::bf16_to_float(half[i + 1]));
+
+    out.assign(0);
+    abs_vec_na_simd(out.c_array(), bf16_argument(half + 1), size);
+    compare_buffers(reference.c_array(), out.c_array(), size);
+
+    out.assign(0);
+    abs_vec_na_simd<size>(out.c_array(), bf16_argument(half + 1));
+    compare_buffers(reference.c_array(), out.c_array(), size);
+}
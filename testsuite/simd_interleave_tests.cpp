@@ -0,0 +1,127 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include "../simd_interleave.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "test_helper.hpp"
+
+using namespace nova;
+using namespace std;
+
+
+static const unsigned int frames = 64;
+static const unsigned int max_channels = 16;
+
+/* unaligned buffers are offset by one sample */
+template <typename float_type, bool src_aligned, bool dst_aligned>
+void interleave_tests(unsigned int channels)
+{
+    const unsigned int src_offset = src_aligned ? 0 : 1;
+    const unsigned int dst_offset = dst_aligned ? 0 : 1;
+
+    aligned_array<float_type, max_channels * (frames + 16)> planar, planar_ref, planar_simd, planar_mp;
+    aligned_array<float_type, max_channels * frames + 16> interleaved, interleaved_simd, interleaved_mp;
+
+    const float_type * in[max_channels];
+    float_type * out_simd[max_channels];
+    float_type * out_mp[max_channels];
+    float_type * out[max_channels];
+    for (unsigned int i = 0; i != channels; ++i) {
+        in[i]       = planar.c_array() + i * (frames + 16) + src_offset;
+        out[i]      = planar_ref.c_array() + i * (frames + 16);
+        out_simd[i] = planar_simd.c_array() + i * (frames + 16) + dst_offset;
+        out_mp[i]   = planar_mp.c_array() + i * (frames + 16) + dst_offset;
+    }
+    randomize_buffer<float_type>(planar.c_array(), planar.size());
+
+    interleave_vec(interleaved.c_array(), in, channels, frames);
+
+    /* samples behind the interleaved frames must not be written */
+    interleaved_simd.assign(float_type(-1));
+    interleaved_mp.assign(float_type(-1));
+
+    if (src_aligned && dst_aligned) {
+        interleave_simd(interleaved_simd.c_array(), in, channels, frames);
+        interleave_simd<frames>(interleaved_mp.c_array(), in, channels);
+    } else if (dst_aligned) {
+        interleave_na_simd(interleaved_simd.c_array(), in, channels, frames);
+        interleave_na_simd<frames>(interleaved_mp.c_array(), in, channels);
+    } else if (src_aligned) {
+        interleave_an_simd(interleaved_simd.c_array() + 1, in, channels, frames);
+        interleave_an_simd<frames>(interleaved_mp.c_array() + 1, in, channels);
+    } else {
+        interleave_nn_simd(interleaved_simd.c_array() + 1, in, channels, frames);
+        interleave_nn_simd<frames>(interleaved_mp.c_array() + 1, in, channels);
+    }
+
+    compare_buffers(interleaved.c_array(), interleaved_simd.c_array() + dst_offset, channels * frames);
+    compare_buffers(interleaved.c_array(), interleaved_mp.c_array() + dst_offset, channels * frames);
+    for (unsigned int i = dst_offset + channels * frames; i != interleaved_simd.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(interleaved_simd[i], float_type(-1));
+        BOOST_REQUIRE_EQUAL(interleaved_mp[i], float_type(-1));
+    }
+
+    /* round trip, the interleaved buffer is copied to the source offset */
+    for (unsigned int i = 0; i != channels * frames; ++i)
+        interleaved_simd[i + src_offset] = interleaved[i];
+    const float_type * interleaved_in = interleaved_simd.c_array() + src_offset;
+
+    deinterleave_vec(out, interleaved.c_array(), channels, frames);
+
+    if (src_aligned && dst_aligned) {
+        deinterleave_simd(out_simd, interleaved_in, channels, frames);
+        deinterleave_simd<frames>(out_mp, interleaved_in, channels);
+    } else if (dst_aligned) {
+        deinterleave_na_simd(out_simd, interleaved_in, channels, frames);
+        deinterleave_na_simd<frames>(out_mp, interleaved_in, channels);
+    } else if (src_aligned) {
+        deinterleave_an_simd(out_simd, interleaved_in, channels, frames);
+        deinterleave_an_simd<frames>(out_mp, interleaved_in, channels);
+    } else {
+        deinterleave_nn_simd(out_simd, interleaved_in, channels, frames);
+        deinterleave_nn_simd<frames>(out_mp, interleaved_in, channels);
+    }
+
+    for (unsigned int i = 0; i != channels; ++i) {
+        compare_buffers(in[i], out[i], frames);
+        compare_buffers(in[i], out_simd[i], frames);
+        compare_buffers(in[i], out_mp[i], frames);
+    }
+}
+
+template <typename float_type>
+void interleave_tests(void)
+{
+    for (unsigned int channels = 1; channels <= max_channels; ++channels) {
+        interleave_tests<float_type, true, true>(channels);
+        interleave_tests<float_type, false, true>(channels);
+        interleave_tests<float_type, true, false>(channels);
+        interleave_tests<float_type, false, false>(channels);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( interleave_test )
+{
+    interleave_tests<float>();
+    interleave_tests<double>();
+}
+
+BOOST_AUTO_TEST_CASE( interleave_layout_test )
+{
+    aligned_array<float, 6 * frames> interleaved;
+    aligned_array<float, 6 * frames> planar;
+    float * channels[6];
+    for (unsigned int i = 0; i != 6; ++i)
+        channels[i] = planar.c_array() + i * frames;
+
+    for (unsigned int i = 0; i != 6 * frames; ++i)
+        planar[i] = float(i);
+
+    interleave_simd(interleaved.c_array(), channels, 6, frames);
+
+    for (unsigned int frame = 0; frame != frames; ++frame)
+        for (unsigned int channel = 0; channel != 6; ++channel)
+            BOOST_REQUIRE_EQUAL(interleaved[frame * 6 + channel], float(channel * frames + frame));
+}
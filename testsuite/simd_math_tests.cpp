@@ -52,8 +52,46 @@ COMPARE_TEST(asin, -1, 1)
 COMPARE_TEST(acos, -0.9, 0.9)
 COMPARE_TEST(atan, -10, 10)
 COMPARE_TEST(tanh, -10, 10)
+COMPARE_TEST(sinh, -10, 10)
+COMPARE_TEST(cosh, -10, 10)
+COMPARE_TEST(asinh, -100, 100)
+COMPARE_TEST(acosh, 1, 100)
+COMPARE_TEST(atanh, -0.99, 0.99)
+COMPARE_TEST(erf, -6, 6)
+COMPARE_TEST(erfc, -4, 9)
+COMPARE_TEST(cbrt, -1000, 1000)
 COMPARE_TEST(signed_sqrt, -20, 20)
 
+/* test range: subnormals and the smallest normalized numbers, geometrically spaced */
+template <typename float_type>
+void test_cbrt_subnormal(void)
+{
+    aligned_array<float_type, size> sseval, libmval, args;
+
+    const float_type low  = std::numeric_limits<float_type>::denorm_min();
+    const float_type high = std::numeric_limits<float_type>::min() * 4;
+    const float_type factor = std::pow(high / low, float_type(2) / float_type(size));
+
+    float_type init = low;
+    for (int i = 0; i != size; i += 2)
+    {
+        args[i]     = init;
+        args[i + 1] = -init;
+        init *= factor;
+    }
+
+    cbrt_vec(libmval.begin(), args.begin(), size);
+    cbrt_vec_simd(sseval.begin(), args.begin(), size);
+
+    compare_buffers(sseval.begin(), libmval.begin(), size, 5e-6f);
+}
+
+BOOST_AUTO_TEST_CASE( cbrt_subnormal_tests )
+{
+    test_cbrt_subnormal<float>();
+    test_cbrt_subnormal<double>();
+}
+
 
 /* test range: 0, 20 */
 BOOST_AUTO_TEST_CASE( pow_tests_float_1 )
@@ -111,3 +149,436 @@ COMPARE_TEST(log, 0.01, 100)
 COMPARE_TEST(log2, 0.01, 100)
 COMPARE_TEST(log10, 0.01, 100)
 COMPARE_TEST(exp, -10, 10)
+COMPARE_TEST(exp2, -20, 20)
+COMPARE_TEST(expm1, -10, 10)
+COMPARE_TEST(log1p, -0.99, 100)
+
+
+#define COMPARE_TEST_DOUBLE(name, low, high)                            \
+BOOST_AUTO_TEST_CASE( name##_tests_double_precision)                    \
+{                                                                       \
+    aligned_array<double, size> sseval, libmval, args;                  \
+                                                                        \
+    double init = low;                                                  \
+    double diff = (double(high) - double(low)) / double(size);          \
+                                                                        \
+    for (int i = 0; i != size; ++i)                                     \
+    {                                                                   \
+        args[i] = init;                                                 \
+        init += diff;                                                   \
+    }                                                                   \
+                                                                        \
+    name##_vec(libmval.begin(), args.begin(), size);                    \
+    name##_vec_simd(sseval.begin(), args.begin(), size);                \
+                                                                        \
+    compare_buffers(sseval.begin(), libmval.begin(), size, 1e-13f);     \
+}
+
+COMPARE_TEST_DOUBLE(sin, -100, 100)
+COMPARE_TEST_DOUBLE(cos, -100, 100)
+COMPARE_TEST_DOUBLE(tan, -1.5, 1.5)
+COMPARE_TEST_DOUBLE(asin, -1, 1)
+COMPARE_TEST_DOUBLE(acos, -1, 1)
+COMPARE_TEST_DOUBLE(atan, -100, 100)
+COMPARE_TEST_DOUBLE(tanh, -30, 30)
+COMPARE_TEST_DOUBLE(cbrt, -1e10, 1e10)
+COMPARE_TEST_DOUBLE(sinh, -100, 100)
+COMPARE_TEST_DOUBLE(cosh, -100, 100)
+COMPARE_TEST_DOUBLE(asinh, -1e10, 1e10)
+COMPARE_TEST_DOUBLE(acosh, 1, 1e10)
+COMPARE_TEST_DOUBLE(atanh, -0.999, 0.999)
+COMPARE_TEST_DOUBLE(erf, -6, 6)
+COMPARE_TEST_DOUBLE(erfc, -6, 26)
+COMPARE_TEST_DOUBLE(log, 0.0001, 10000)
+COMPARE_TEST_DOUBLE(log2, 0.01, 100)
+COMPARE_TEST_DOUBLE(log10, 0.01, 100)
+COMPARE_TEST_DOUBLE(exp, -700, 700)
+COMPARE_TEST_DOUBLE(exp2, -1000, 1000)
+COMPARE_TEST_DOUBLE(expm1, -30, 700)
+COMPARE_TEST_DOUBLE(log1p, -0.999, 1e10)
+
+template <typename float_type>
+void test_sincos(float_type low, float_type high, float difference)
+{
+    aligned_array<float_type, size> sinval, cosval, mp_sinval, mp_cosval, libm_sinval, libm_cosval, args;
+
+    float_type init = low;
+    float_type diff = (high - low) / float_type(size);
+
+    for (int i = 0; i != size; ++i)
+    {
+        args[i] = init;
+        init += diff;
+    }
+
+    sincos_vec(libm_sinval.begin(), libm_cosval.begin(), args.begin(), size);
+    sincos_vec_simd(sinval.begin(), cosval.begin(), args.begin(), size);
+    sincos_vec_simd<64>(mp_sinval.begin(), mp_cosval.begin(), args.begin());
+
+    compare_buffers(sinval.begin(), libm_sinval.begin(), size, difference);
+    compare_buffers(cosval.begin(), libm_cosval.begin(), size, difference);
+    compare_buffers(mp_sinval.begin(), libm_sinval.begin(), 64, difference);
+    compare_buffers(mp_cosval.begin(), libm_cosval.begin(), 64, difference);
+
+    /* same results as the separate functions */
+    aligned_array<float_type, size> separate_sinval, separate_cosval;
+    sin_vec_simd(separate_sinval.begin(), args.begin(), size);
+    cos_vec_simd(separate_cosval.begin(), args.begin(), size);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( sinval[i], separate_sinval[i] );
+        BOOST_REQUIRE_EQUAL( cosval[i], separate_cosval[i] );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( sincos_tests )
+{
+    test_sincos<float>(-3.2f, 3.2f, 5e-6f);
+    test_sincos<double>(-100, 100, 1e-13f);
+    test_sincos<double>(-1e10, 1e10, 1e-13f);
+}
+
+/* the octant of the double precision range reduction does not fit into 32bit integers for large
+ * arguments, those lanes are computed by libm */
+BOOST_AUTO_TEST_CASE( large_argument_trig_tests )
+{
+    aligned_array<double, size> args, sseval, libmval;
+    for (int i = 0; i != size; ++i)
+        args[i] = (i % 2) ? (i % 3 ? 3e9 : -1e10) * (1 + i * 1e-3) : 0.5 + i * 1e-2;
+
+    sin_vec(libmval.begin(), args.begin(), size);
+    sin_vec_simd(sseval.begin(), args.begin(), size);
+    compare_buffers(sseval.begin(), libmval.begin(), size, 1e-13f);
+
+    cos_vec(libmval.begin(), args.begin(), size);
+    cos_vec_simd(sseval.begin(), args.begin(), size);
+    compare_buffers(sseval.begin(), libmval.begin(), size, 1e-13f);
+
+    tan_vec(libmval.begin(), args.begin(), size);
+    tan_vec_simd(sseval.begin(), args.begin(), size);
+    compare_buffers(sseval.begin(), libmval.begin(), size, 1e-13f);
+
+    BOOST_REQUIRE_CLOSE_FRACTION(sin(vec<double>(3e9)).get(0), std::sin(3e9), 1e-13);
+    BOOST_REQUIRE_CLOSE_FRACTION(cos(vec<double>(3e9)).get(0), std::cos(3e9), 1e-13);
+    BOOST_REQUIRE_CLOSE_FRACTION(sin(vec<double>(1e10)).get(0), std::sin(1e10), 1e-13);
+    BOOST_REQUIRE(std::isnan(sin(vec<double>(std::numeric_limits<double>::infinity())).get(0)));
+
+    BOOST_REQUIRE_EQUAL(sin(vec<double>(3e9), accuracy::precise()).get(0), std::sin(3e9));
+    BOOST_REQUIRE_EQUAL(cos(vec<double>(1e10), accuracy::precise()).get(0), std::cos(1e10));
+
+    /* the precise float range reduction is exact for |x| < 8192 */
+    const float float_args[] = {1e5f, -3e6f, 1e9f};
+    for (int i = 0; i != 3; ++i) {
+        const float x = float_args[i];
+        BOOST_REQUIRE_EQUAL(sin(vec<float>(x), accuracy::precise()).get(0), float(std::sin(double(x))));
+        BOOST_REQUIRE_EQUAL(cos(vec<float>(x), accuracy::precise()).get(0), float(std::cos(double(x))));
+    }
+}
+
+/* poles and domain boundaries of log1p and atanh */
+template <typename float_type>
+void test_log1p_atanh_domain(void)
+{
+    typedef vec<float_type> vec_type;
+    const float_type infinity = std::numeric_limits<float_type>::infinity();
+
+    BOOST_REQUIRE_EQUAL(log1p(vec_type(float_type(-1))).get(0), -infinity);
+    BOOST_REQUIRE_EQUAL(log1p(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE(std::isnan(log1p(vec_type(float_type(-2))).get(0)));
+    BOOST_REQUIRE(std::signbit(log1p(vec_type(float_type(-0.0))).get(0)));
+
+    BOOST_REQUIRE_EQUAL(atanh(vec_type(float_type(1))).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(atanh(vec_type(float_type(-1))).get(0), -infinity);
+    BOOST_REQUIRE(std::isnan(atanh(vec_type(float_type(100))).get(0)));
+    BOOST_REQUIRE(std::isnan(atanh(vec_type(float_type(-1.5))).get(0)));
+    BOOST_REQUIRE(std::isnan(atanh(vec_type(infinity)).get(0)));
+}
+
+BOOST_AUTO_TEST_CASE( log1p_atanh_domain_tests )
+{
+    test_log1p_atanh_domain<float>();
+    test_log1p_atanh_domain<double>();
+}
+
+/* nan, infinity, overflow and signed zero of the exponential and hyperbolic functions */
+template <typename float_type>
+void test_hyperbolic_special_values(float_type large, float_type overflowing)
+{
+    typedef vec<float_type> vec_type;
+    const float_type infinity = std::numeric_limits<float_type>::infinity();
+    const float_type nan = std::numeric_limits<float_type>::quiet_NaN();
+
+    BOOST_REQUIRE(std::isnan(sinh(vec_type(nan)).get(0)));
+    BOOST_REQUIRE(std::isnan(cosh(vec_type(nan)).get(0)));
+    BOOST_REQUIRE(std::isnan(asinh(vec_type(nan)).get(0)));
+    BOOST_REQUIRE(std::isnan(acosh(vec_type(nan)).get(0)));
+    BOOST_REQUIRE(std::isnan(expm1(vec_type(nan)).get(0)));
+
+    BOOST_REQUIRE_EQUAL(sinh(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(sinh(vec_type(-infinity)).get(0), -infinity);
+    BOOST_REQUIRE_EQUAL(cosh(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(cosh(vec_type(-infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(asinh(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(asinh(vec_type(-infinity)).get(0), -infinity);
+    BOOST_REQUIRE_EQUAL(acosh(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(expm1(vec_type(infinity)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(expm1(vec_type(-infinity)).get(0), float_type(-1));
+
+    BOOST_REQUIRE_EQUAL(sinh(vec_type(overflowing)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(sinh(vec_type(-overflowing)).get(0), -infinity);
+    BOOST_REQUIRE_EQUAL(cosh(vec_type(overflowing)).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(expm1(vec_type(overflowing)).get(0), infinity);
+
+    /* finite results close to the overflow threshold */
+    BOOST_REQUIRE_CLOSE_FRACTION(sinh(vec_type(large)).get(0), std::sinh(large), 1e-5);
+    BOOST_REQUIRE_CLOSE_FRACTION(cosh(vec_type(large)).get(0), std::cosh(large), 1e-5);
+
+    BOOST_REQUIRE(std::signbit(expm1(vec_type(float_type(-0.0))).get(0)));
+    BOOST_REQUIRE(std::signbit(sinh(vec_type(float_type(-0.0))).get(0)));
+    BOOST_REQUIRE(std::signbit(asinh(vec_type(float_type(-0.0))).get(0)));
+}
+
+BOOST_AUTO_TEST_CASE( hyperbolic_special_value_tests )
+{
+    test_hyperbolic_special_values<float>(89.f, 100.f);
+    test_hyperbolic_special_values<double>(710.0, 800.0);
+}
+
+/* expm1, log1p, sinh, asinh, atanh and erf keep their relative accuracy for tiny arguments */
+template <typename float_type>
+void test_small_arguments(float difference)
+{
+    aligned_array<float_type, size> sseval, libmval, args;
+
+    for (int i = 0; i != size; ++i)
+        args[i] = float_type(1e-3) * std::pow(float_type(1e-4), float_type(i) / size) * (i % 2 ? 1 : -1);
+
+#define COMPARE_SMALL_ARGUMENTS(name)                           \
+    name##_vec(libmval.begin(), args.begin(), size);            \
+    name##_vec_simd(sseval.begin(), args.begin(), size);        \
+    compare_buffers(sseval.begin(), libmval.begin(), size, difference);
+
+    COMPARE_SMALL_ARGUMENTS(expm1)
+    COMPARE_SMALL_ARGUMENTS(log1p)
+    COMPARE_SMALL_ARGUMENTS(sinh)
+    COMPARE_SMALL_ARGUMENTS(asinh)
+    COMPARE_SMALL_ARGUMENTS(atanh)
+    COMPARE_SMALL_ARGUMENTS(erf)
+
+#undef COMPARE_SMALL_ARGUMENTS
+}
+
+BOOST_AUTO_TEST_CASE( small_argument_tests )
+{
+    test_small_arguments<float>(5e-7f);
+    test_small_arguments<double>(1e-15f);
+}
+
+/* arguments on a grid, which covers all four quadrants */
+template <typename float_type>
+void fill_cartesian_grid(float_type * real, float_type * imag)
+{
+    for (int i = 0; i != size; ++i) {
+        real[i] = float_type(-50.5) + float_type(i % 100);
+        imag[i] = float_type(-49.75) + float_type(i / 100);
+    }
+}
+
+template <typename float_type>
+void test_atan2_hypot(float difference)
+{
+    aligned_array<float_type, size> sseval, libmval, real, imag;
+    fill_cartesian_grid(real.begin(), imag.begin());
+
+    atan2_vec(libmval.begin(), imag.begin(), real.begin(), size);
+    atan2_vec_simd(sseval.begin(), imag.begin(), real.begin(), size);
+    compare_buffers(sseval.begin(), libmval.begin(), size, difference);
+
+    hypot_vec(libmval.begin(), real.begin(), imag.begin(), size);
+    hypot_vec_simd(sseval.begin(), real.begin(), imag.begin(), size);
+    compare_buffers(sseval.begin(), libmval.begin(), size, difference);
+
+    typedef vec<float_type> vec_type;
+    const float_type pi = float_type(3.14159265358979323846);
+    const float_type huge = std::numeric_limits<float_type>::max();
+    BOOST_REQUIRE_EQUAL(atan2(vec_type(float_type(0)), vec_type(float_type(0))).get(0), float_type(0));
+    BOOST_REQUIRE_CLOSE_FRACTION(atan2(vec_type(float_type(1)), vec_type(float_type(0))).get(0), pi / 2, difference);
+    BOOST_REQUIRE_CLOSE_FRACTION(atan2(vec_type(float_type(0)), vec_type(float_type(-1))).get(0), pi, difference);
+
+    /* signed zeros and infinities */
+    const float_type inf = std::numeric_limits<float_type>::infinity();
+    const float_type special[] = {float_type(0), -float_type(0), float_type(1), float_type(-1), inf, -inf};
+    for (int i = 0; i != 6; ++i) {
+        for (int j = 0; j != 6; ++j) {
+            const float_type result = atan2(vec_type(special[i]), vec_type(special[j])).get(0);
+            const float_type reference = std::atan2(special[i], special[j]);
+            if (reference == 0) {
+                BOOST_REQUIRE_EQUAL(result, reference);
+                BOOST_REQUIRE_EQUAL(std::signbit(result), std::signbit(reference));
+            } else
+                BOOST_REQUIRE_CLOSE_FRACTION(result, reference, difference);
+        }
+    }
+    BOOST_REQUIRE_EQUAL(hypot(vec_type(float_type(0)), vec_type(float_type(0))).get(0), float_type(0));
+    BOOST_REQUIRE_CLOSE_FRACTION(hypot(vec_type(huge / 2), vec_type(huge / 2)).get(0), huge / std::sqrt(float_type(2)),
+                                 difference);
+}
+
+BOOST_AUTO_TEST_CASE( atan2_hypot_tests )
+{
+    test_atan2_hypot<float>(5e-6f);
+    test_atan2_hypot<double>(1e-13f);
+}
+
+template <typename float_type>
+void test_cartesian_polar(float difference)
+{
+    aligned_array<float_type, size> real, imag, magnitude, phase, libm_magnitude, libm_phase;
+    aligned_array<float_type, size> out_real, out_imag, libm_real, libm_imag;
+    fill_cartesian_grid(real.begin(), imag.begin());
+
+    cartesian_to_polar_vec(libm_magnitude.begin(), libm_phase.begin(), real.begin(), imag.begin(), size);
+    cartesian_to_polar_vec_simd(magnitude.begin(), phase.begin(), real.begin(), imag.begin(), size);
+    compare_buffers(magnitude.begin(), libm_magnitude.begin(), size, difference);
+    compare_buffers(phase.begin(), libm_phase.begin(), size, difference);
+
+    polar_to_cartesian_vec(libm_real.begin(), libm_imag.begin(), libm_magnitude.begin(), libm_phase.begin(), size);
+    polar_to_cartesian_vec_simd(out_real.begin(), out_imag.begin(), magnitude.begin(), phase.begin(), size);
+
+    /* the round trip restores the arguments, the components are compared relative to the magnitude */
+    for (int i = 0; i != size; ++i) {
+        const float_type tolerance = 4 * difference * magnitude[i];
+        BOOST_REQUIRE_SMALL(out_real[i] - real[i], tolerance);
+        BOOST_REQUIRE_SMALL(out_imag[i] - imag[i], tolerance);
+        BOOST_REQUIRE_SMALL(out_real[i] - libm_real[i], tolerance);
+        BOOST_REQUIRE_SMALL(out_imag[i] - libm_imag[i], tolerance);
+    }
+
+    aligned_array<float_type, 64> mp_magnitude, mp_phase;
+    cartesian_to_polar_vec_simd<64>(mp_magnitude.begin(), mp_phase.begin(), real.begin(), imag.begin());
+    polar_to_cartesian_vec_simd<64>(out_real.begin(), out_imag.begin(), mp_magnitude.begin(), mp_phase.begin());
+    for (int i = 0; i != 64; ++i) {
+        BOOST_REQUIRE_EQUAL(mp_magnitude[i], magnitude[i]);
+        BOOST_REQUIRE_EQUAL(mp_phase[i], phase[i]);
+        BOOST_REQUIRE_SMALL(out_real[i] - real[i], 4 * difference * magnitude[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( cartesian_polar_tests )
+{
+    test_cartesian_polar<float>(5e-6f);
+    test_cartesian_polar<double>(1e-13f);
+}
+
+/* error in units of the last place of the correctly rounded result, the reference is computed with
+ * higher precision */
+template <typename float_type>
+long double ulp_error(float_type result, long double reference)
+{
+    const float_type rounded = float_type(reference);
+    const long double ulp = std::nextafter(std::fabs(rounded), std::numeric_limits<float_type>::infinity())
+                            - std::fabs(rounded);
+    return std::fabs((long double)result - reference) / ulp;
+}
+
+/* fast: 5e-4 relative to max(1, |reference|), precise: 1 ulp */
+#define ACCURACY_TIER_TEST(name, low, high)                                 \
+template <typename float_type>                                              \
+void test_##name##_accuracy_tiers(float_type low_arg, float_type high_arg)  \
+{                                                                           \
+    aligned_array<float_type, size> fastval, preciseval, args;              \
+                                                                            \
+    float_type diff = (high_arg - low_arg) / float_type(size);              \
+    for (int i = 0; i != size; ++i)                                         \
+        args[i] = low_arg + diff * i;                                       \
+                                                                            \
+    fast_##name##_vec_simd(fastval.begin(), args.begin(), size);            \
+    precise_##name##_vec_simd(preciseval.begin(), args.begin(), size);      \
+                                                                            \
+    for (int i = 0; i != size; ++i) {                                       \
+        const long double reference = std::name((long double)args[i]);      \
+        const long double fast_error = std::fabs(fastval[i] - reference);   \
+        BOOST_REQUIRE_LE(fast_error, 5e-4 * std::max(std::fabs(reference), 1.0L)); \
+        BOOST_REQUIRE_LE(ulp_error(preciseval[i], reference), 1);           \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+BOOST_AUTO_TEST_CASE( name##_accuracy_tier_tests )                          \
+{                                                                           \
+    test_##name##_accuracy_tiers<float>(low, high);                         \
+    test_##name##_accuracy_tiers<double>(low, high);                        \
+}
+
+ACCURACY_TIER_TEST(sin, -100, 100)
+ACCURACY_TIER_TEST(cos, -100, 100)
+ACCURACY_TIER_TEST(tanh, -10, 10)
+ACCURACY_TIER_TEST(log, 0.001, 1000)
+ACCURACY_TIER_TEST(exp, -80, 80)
+
+template <typename float_type>
+void test_pow_accuracy_tiers(void)
+{
+    aligned_array<float_type, size> fastval, preciseval, args;
+
+    for (float_type exponent = -3; exponent < 3; exponent += float_type(0.7)) {
+        for (int i = 0; i != size; ++i)
+            args[i] = float_type(0.01) + float_type(20) * i / size;
+
+        fast_pow_vec_simd(fastval.begin(), args.begin(), exponent, size);
+        precise_pow_vec_simd(preciseval.begin(), args.begin(), exponent, size);
+
+        for (int i = 0; i != size; ++i) {
+            const long double reference = std::pow((long double)args[i], (long double)exponent);
+            BOOST_REQUIRE_CLOSE_FRACTION((long double)fastval[i], reference, 2e-3);
+            BOOST_REQUIRE_LE(ulp_error(preciseval[i], reference), 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( pow_accuracy_tier_tests )
+{
+    test_pow_accuracy_tiers<float>();
+    test_pow_accuracy_tiers<double>();
+}
+
+BOOST_AUTO_TEST_CASE( precise_special_value_tests )
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    BOOST_REQUIRE_EQUAL(exp(vec<float>(-infinity), accuracy::precise()).get(0), 0.f);
+    BOOST_REQUIRE_EQUAL(exp(vec<float>(100.f), accuracy::precise()).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(log(vec<float>(0.f), accuracy::precise()).get(0), -infinity);
+    BOOST_REQUIRE(std::isnan(log(vec<float>(-1.f), accuracy::precise()).get(0)));
+    BOOST_REQUIRE_EQUAL(pow(vec<float>(0.f), vec<float>(2.f), accuracy::precise()).get(0), 0.f);
+    BOOST_REQUIRE_EQUAL(pow(vec<float>(3.f), vec<float>(0.f), accuracy::precise()).get(0), 1.f);
+    BOOST_REQUIRE_EQUAL(tanh(vec<double>(40.0), accuracy::precise()).get(0), 1.0);
+    BOOST_REQUIRE_EQUAL(exp(vec<double>(-1000.0), accuracy::precise()).get(0), 0.0);
+
+    /* the high part of y log(x) is above the clamping range of exp, the sum is not */
+    BOOST_REQUIRE_CLOSE_FRACTION(pow(vec<double>(0.65897626545214905), vec<double>(-1695.6468295655402),
+                                     accuracy::precise()).get(0),
+                                 std::pow(0.65897626545214905, -1695.6468295655402), 1e-13);
+}
+
+/* exp2 and log2 are exact for powers of two */
+template <typename float_type>
+void test_exp2_log2_exact(int min_exponent, int max_exponent)
+{
+    typedef vec<float_type> vec_type;
+
+    for (int i = min_exponent; i <= max_exponent; ++i) {
+        const float_type power = std::ldexp(float_type(1), i);
+        BOOST_REQUIRE_EQUAL(exp2(vec_type(float_type(i))).get(0), power);
+        BOOST_REQUIRE_EQUAL(log2(vec_type(power)).get(0), float_type(i));
+    }
+
+    const float_type infinity = std::numeric_limits<float_type>::infinity();
+    BOOST_REQUIRE_EQUAL(exp2(vec_type(float_type(max_exponent + 1))).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(exp2(vec_type(-infinity)).get(0), float_type(0));
+}
+
+BOOST_AUTO_TEST_CASE( exp2_log2_exact_tests )
+{
+    test_exp2_log2_exact<float>(-126, 127);
+    test_exp2_log2_exact<double>(-1022, 1023);
+}
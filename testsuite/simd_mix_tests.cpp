@@ -132,3 +132,31 @@ BOOST_AUTO_TEST_CASE( sum_tests )
     test_sum4<float>();
     test_sum4<double>();
 }
+
+/* prefetching past the end of the buffers must not change the results */
+template <typename float_type>
+void test_sum4_prefetch(void)
+{
+    aligned_array<float_type, size>  sseval, generic, args0, args1, args2, args3;
+    randomize_buffer<float_type>(args0.c_array(), size);
+    randomize_buffer<float_type>(args1.c_array(), size);
+    randomize_buffer<float_type>(args2.c_array(), size);
+    randomize_buffer<float_type>(args3.c_array(), size);
+
+    sum_vec(generic.c_array(), args0.c_array(), args1.c_array(), args2.c_array(), args3.c_array(), size);
+    detail::generate_simd_loop<true, false, 1024>(sseval.c_array(),
+                                                  detail::wrap_vector_arg(wrap_argument(args0.c_array())),
+                                                  detail::wrap_vector_arg(wrap_argument(args1.c_array())),
+                                                  detail::wrap_vector_arg(wrap_argument(args2.c_array())),
+                                                  detail::wrap_vector_arg(wrap_argument(args3.c_array())),
+                                                  size, detail::sum());
+
+    for (int i = 0; i != size; ++i)
+        BOOST_CHECK_CLOSE( sseval[i], generic[i], 0.0001 );
+}
+
+BOOST_AUTO_TEST_CASE( sum_prefetch_tests )
+{
+    test_sum4_prefetch<float>();
+    test_sum4_prefetch<double>();
+}
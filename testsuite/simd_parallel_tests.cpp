@@ -0,0 +1,160 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_mix.hpp"
+#include "../simd_parallel.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 8192;
+static const unsigned int chunk_size = 512;
+static const unsigned int thread_counts[] = {1, 3, 8};
+
+BOOST_AUTO_TEST_CASE( thread_pool_tests )
+{
+    for (unsigned int t = 0; t != sizeof(thread_counts)/sizeof(thread_counts[0]); ++t) {
+        parallel::thread_pool pool(thread_counts[t]);
+        BOOST_REQUIRE_EQUAL( pool.size(), thread_counts[t] );
+
+        for (unsigned int run = 0; run != 10; ++run) {
+            std::vector<unsigned int> calls(100, 0);
+            pool.run(calls.size(), [&](unsigned int i) { calls[i] += 1; });
+            for (unsigned int i = 0; i != calls.size(); ++i)
+                BOOST_REQUIRE_EQUAL( calls[i], 1u );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( chunk_tests )
+{
+    parallel::thread_pool pool(2);
+    parallel::policy policy(pool, 100);
+
+    /* rounded up to a multiple of the unroll constraints */
+    BOOST_REQUIRE_EQUAL( policy.chunk_size<float>() % (4 * vec<float>::objects_per_cacheline), 0u );
+    BOOST_REQUIRE_EQUAL( policy.chunk_size<double>() % (4 * vec<double>::objects_per_cacheline), 0u );
+    BOOST_REQUIRE( policy.chunk_size<float>() >= 100 );
+}
+
+template <typename float_type>
+void test_kernels(void)
+{
+    aligned_array<float_type, size> in0, in1, in2, in3, out, out_parallel;
+    randomize_buffer<float_type>(in0.c_array(), size);
+    randomize_buffer<float_type>(in1.c_array(), size);
+    randomize_buffer<float_type>(in2.c_array(), size);
+    randomize_buffer<float_type>(in3.c_array(), size);
+
+    const float_type * i0 = in0.c_array();
+    const float_type * i1 = in1.c_array();
+    const float_type * i2 = in2.c_array();
+    const float_type * i3 = in3.c_array();
+
+    for (unsigned int t = 0; t != sizeof(thread_counts)/sizeof(thread_counts[0]); ++t) {
+        parallel::thread_pool pool(thread_counts[t]);
+        parallel::policy policy(pool, chunk_size);
+
+        tanh_vec_simd(out.c_array(), i0, size);
+        tanh_vec_simd(policy, out_parallel.c_array(), i0, size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 0);
+
+        times_vec_simd(out.c_array(), i0, float_type(0.5), size);
+        times_vec_simd(policy, out_parallel.c_array(), i0, float_type(0.5), size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 0);
+
+        plus_vec_simd(out.c_array(), i0, slope_argument(float_type(0), float_type(0.0001)), size);
+        plus_vec_simd(policy, out_parallel.c_array(), i0, slope_argument(float_type(0), float_type(0.0001)), size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 1e-4);
+
+        muladd_vec_simd(out.c_array(), i0, i1, i2, size);
+        muladd_vec_simd(policy, out_parallel.c_array(), i0, i1, i2, size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 0);
+
+        sum_vec_simd(out.c_array(), i0, i1, i2, i3, size);
+        sum_vec_simd(policy, out_parallel.c_array(), i0, i1, i2, i3, size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 0);
+
+        fused_vec_simd(out.c_array(), times_expr(tanh_expr(muladd_expr(i0, i1, i2)), float_type(0.5)), size);
+        fused_vec_simd(policy, out_parallel.c_array(), times_expr(tanh_expr(muladd_expr(i0, i1, i2)), float_type(0.5)),
+                       size);
+        compare_buffers(out.c_array(), out_parallel.c_array(), size, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( kernel_tests )
+{
+    test_kernels<float>();
+    test_kernels<double>();
+}
+
+/* results of reductions are identical for any number of threads */
+template <typename float_type>
+void test_reductions(void)
+{
+    aligned_array<float_type, size> in;
+    randomize_buffer<float_type>(in.c_array(), size);
+    const float_type * i = in.c_array();
+
+    float_type sum[3], max[3], min[3], mm_min[3], mm_max[3], ms_max[3], ms_sum[3];
+    float_type peak[3], rms_peak[3], squares[3], last[3];
+
+    for (unsigned int t = 0; t != sizeof(thread_counts)/sizeof(thread_counts[0]); ++t) {
+        parallel::thread_pool pool(thread_counts[t]);
+        parallel::policy policy(pool, chunk_size);
+
+        sum[t] = horizontal_sum_vec_simd(policy, i, size);
+        max[t] = horizontal_max_vec_simd(policy, i, size);
+        min[t] = horizontal_min_vec_simd(policy, i, size);
+        horizontal_minmax_vec_simd(policy, mm_min[t], mm_max[t], i, size);
+        horizontal_maxsum_vec_simd(policy, ms_max[t], ms_sum[t], i, size);
+
+        peak[t] = 0;
+        last[t] = peak_vec_simd(policy, i, &peak[t], size);
+
+        rms_peak[t] = 0;
+        squares[t] = 1;
+        peak_rms_vec_simd(policy, i, &rms_peak[t], &squares[t], size);
+    }
+
+    for (unsigned int t = 1; t != 3; ++t) {
+        BOOST_REQUIRE_EQUAL( sum[t], sum[0] );
+        BOOST_REQUIRE_EQUAL( max[t], max[0] );
+        BOOST_REQUIRE_EQUAL( min[t], min[0] );
+        BOOST_REQUIRE_EQUAL( mm_min[t], mm_min[0] );
+        BOOST_REQUIRE_EQUAL( mm_max[t], mm_max[0] );
+        BOOST_REQUIRE_EQUAL( ms_max[t], ms_max[0] );
+        BOOST_REQUIRE_EQUAL( ms_sum[t], ms_sum[0] );
+        BOOST_REQUIRE_EQUAL( peak[t], peak[0] );
+        BOOST_REQUIRE_EQUAL( last[t], last[0] );
+        BOOST_REQUIRE_EQUAL( rms_peak[t], rms_peak[0] );
+        BOOST_REQUIRE_EQUAL( squares[t], squares[0] );
+    }
+
+    /* and match the single-threaded functions */
+    float_type serial_peak = 0, serial_squares = 1;
+    peak_rms_vec_simd(i, &serial_peak, &serial_squares, size);
+
+    BOOST_REQUIRE_CLOSE_FRACTION( sum[0], horizontal_sum_vec_simd(i, size), 1e-3 );
+    BOOST_REQUIRE_EQUAL( max[0], horizontal_max_vec_simd(i, size) );
+    BOOST_REQUIRE_EQUAL( rms_peak[0], serial_peak );
+    BOOST_REQUIRE_CLOSE_FRACTION( squares[0], serial_squares, 1e-5 );
+    BOOST_REQUIRE_EQUAL( last[0], std::abs(i[size - 1]) );
+}
+
+BOOST_AUTO_TEST_CASE( reduction_tests )
+{
+    test_reductions<float>();
+    test_reductions<double>();
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../vec.hpp"
+#include "../simd_polynomial.hpp"
+
+using namespace nova;
+
+/* taylor series of exp, sin and atan */
+struct exp_coefficients
+{
+    static constexpr double coefficients[] = { 1.0, 1.0, 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040,
+                                               1.0/40320, 1.0/362880, 1.0/3628800 };
+};
+
+struct sin_coefficients
+{
+    static constexpr double coefficients[] = { 0.0, 1.0, 0.0, -1.0/6, 0.0, 1.0/120, 0.0, -1.0/5040, 0.0, 1.0/362880 };
+};
+
+struct constant_coefficients
+{
+    static constexpr double coefficients[] = { 0.25 };
+};
+
+struct linear_coefficients
+{
+    static constexpr double coefficients[] = { 0.25, 2.0 };
+};
+
+/* pade approximant of exp: (1 + x/2 + x**2/12) / (1 - x/2 + x**2/12) */
+struct pade_numerator
+{
+    static constexpr double coefficients[] = { 1.0, 0.5, 1.0/12 };
+};
+
+struct pade_denominator
+{
+    static constexpr double coefficients[] = { 1.0, -0.5, 1.0/12 };
+};
+
+/* the reference reads the coefficients at run time, so they need a definition */
+constexpr double exp_coefficients::coefficients[];
+constexpr double linear_coefficients::coefficients[];
+constexpr double pade_numerator::coefficients[];
+constexpr double pade_denominator::coefficients[];
+
+template <typename Coefficients>
+double reference_polynomial(double x)
+{
+    const unsigned int size = sizeof(Coefficients::coefficients) / sizeof(double);
+    double result = 0;
+    double power = 1;
+    for (unsigned int i = 0; i != size; ++i) {
+        result += Coefficients::coefficients[i] * power;
+        power *= x;
+    }
+    return result;
+}
+
+template <typename Coefficients, typename float_type>
+void test_polynomial(float difference)
+{
+    typedef vec<float_type> vec_type;
+
+    for (float_type x = -1; x <= 1; x += float_type(0.0625)) {
+        const float_type reference = float_type(reference_polynomial<Coefficients>(x));
+
+        BOOST_REQUIRE_CLOSE_FRACTION(horner<Coefficients>(x), reference, difference);
+        BOOST_REQUIRE_CLOSE_FRACTION(estrin<Coefficients>(x), reference, difference);
+        BOOST_REQUIRE_CLOSE_FRACTION((horner<Coefficients, false>(x)), reference, difference);
+        BOOST_REQUIRE_CLOSE_FRACTION((estrin<Coefficients, false>(x)), reference, difference);
+
+        const vec_type vx(x);
+        BOOST_REQUIRE_CLOSE_FRACTION(horner<Coefficients>(vx).get(0), reference, difference);
+        BOOST_REQUIRE_CLOSE_FRACTION(estrin<Coefficients>(vx).get(0), reference, difference);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( polynomial_tests )
+{
+    test_polynomial<exp_coefficients, float>(1e-6f);
+    test_polynomial<exp_coefficients, double>(1e-14f);
+    test_polynomial<linear_coefficients, float>(1e-6f);
+    test_polynomial<linear_coefficients, double>(1e-14f);
+
+    BOOST_REQUIRE_EQUAL(horner<constant_coefficients>(vec<float>(3.f)).get(0), 0.25f);
+    BOOST_REQUIRE_EQUAL(estrin<constant_coefficients>(vec<float>(3.f)).get(0), 0.25f);
+
+    /* sin has zero coefficients, so it is compared with an absolute tolerance */
+    for (float x = -1; x <= 1; x += 0.0625f) {
+        BOOST_REQUIRE_SMALL(horner<sin_coefficients>(vec<float>(x)).get(0) - std::sin(x), 1e-6f);
+        BOOST_REQUIRE_SMALL(estrin<sin_coefficients>(vec<float>(x)).get(0) - std::sin(x), 1e-6f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( rational_tests )
+{
+    for (double x = -0.5; x <= 0.5; x += 0.0625) {
+        const double reference = reference_polynomial<pade_numerator>(x) / reference_polynomial<pade_denominator>(x);
+
+        BOOST_REQUIRE_CLOSE_FRACTION((rational<pade_numerator, pade_denominator>(vec<double>(x)).get(0)), reference, 1e-14);
+        BOOST_REQUIRE_CLOSE_FRACTION((rational<pade_numerator, pade_denominator, estrin_scheme>(vec<double>(x)).get(0)),
+                                     reference, 1e-14);
+        BOOST_REQUIRE_CLOSE_FRACTION((rational<pade_numerator, pade_denominator>(float(x))), float(reference), 1e-6);
+        BOOST_REQUIRE_CLOSE_FRACTION(std::exp(x), reference, 1e-3);
+    }
+}
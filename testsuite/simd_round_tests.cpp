@@ -45,4 +45,35 @@ COMPARE_TEST(round)
 COMPARE_TEST(ceil)
 COMPARE_TEST(floor)
 COMPARE_TEST(frac)
-COMPARE_TEST(trunc)
\ No newline at end of file
+COMPARE_TEST(trunc)
+
+/* values above 2**23 (float) and 2**52 (double) are integers and must not be changed */
+template <typename float_type>
+void test_large_arguments(void)
+{
+    typedef vec<float_type> vec_type;
+    const int mantissa_bits = std::numeric_limits<float_type>::digits - 1;
+    const float_type threshold = std::ldexp(float_type(1), mantissa_bits);
+
+    const float_type args[] = {threshold, threshold + 1, 2 * threshold + 2, 3 * threshold + 1,
+                               std::ldexp(threshold, 7) + std::ldexp(float_type(1), 7),
+                               std::numeric_limits<float_type>::max()};
+
+    for (int i = 0; i != 6; ++i) {
+        for (int sign = 0; sign != 2; ++sign) {
+            const float_type arg = sign ? -args[i] : args[i];
+            const vec_type vec_arg(arg);
+
+            BOOST_REQUIRE_EQUAL( round(vec_arg).get(0), arg );
+            BOOST_REQUIRE_EQUAL( ceil(vec_arg).get(0),  arg );
+            BOOST_REQUIRE_EQUAL( floor(vec_arg).get(0), arg );
+            BOOST_REQUIRE_EQUAL( frac(vec_arg).get(0),  float_type(0) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( large_argument_tests )
+{
+    test_large_arguments<float>();
+    test_large_arguments<double>();
+}
@@ -0,0 +1,133 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+/* small threshold, so that both code paths are tested */
+#define NOVA_SIMD_STREAM_THRESHOLD 4096
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_memory.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 8192;
+static const unsigned int sizes[] = {64, 512, 2048, 8192};
+
+template <typename float_type>
+struct stream_buffers
+{
+    stream_buffers(void)
+    {
+        randomize_buffer<float_type>(in0.c_array(), size);
+        randomize_buffer<float_type>(in1.c_array(), size);
+        randomize_buffer<float_type>(in2.c_array(), size);
+
+        for (unsigned int i = 0; i != size; ++i)
+            out[i] = out_stream[i] = float_type(-1);
+    }
+
+    void compare(unsigned int n)
+    {
+        for (unsigned int i = 0; i != n; ++i)
+            BOOST_REQUIRE_EQUAL( out[i], out_stream[i] );
+
+        /* nothing is written past the end of the buffer */
+        for (unsigned int i = n; i != size; ++i)
+            BOOST_REQUIRE_EQUAL( out_stream[i], float_type(-1) );
+    }
+
+    aligned_array<float_type, size> out, out_stream, in0, in1, in2;
+};
+
+template <typename float_type>
+void test_stream_functions(void)
+{
+    for (unsigned int i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i) {
+        const unsigned int n = sizes[i];
+
+        {
+            stream_buffers<float_type> b;
+            exp_vec_simd(b.out.c_array(), b.in0.c_array(), n);
+            exp_vec_simd_stream(b.out_stream.c_array(), b.in0.c_array(), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            plus_vec_simd(b.out.c_array(), b.in0.c_array(), b.in1.c_array(), n);
+            plus_vec_simd_stream(b.out_stream.c_array(), b.in0.c_array(), b.in1.c_array(), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            plus_vec_simd(b.out.c_array(), b.in0.c_array(), float_type(0.5), n);
+            plus_vec_simd_stream(b.out_stream.c_array(), b.in0.c_array(), float_type(0.5), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            muladd_vec_simd(b.out.c_array(), b.in0.c_array(), b.in1.c_array(), b.in2.c_array(), n);
+            muladd_vec_simd_stream(b.out_stream.c_array(), b.in0.c_array(), b.in1.c_array(), b.in2.c_array(), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            fused_vec_simd(b.out.c_array(), times_expr(plus_expr(b.in0.c_array(), b.in1.c_array()),
+                                                        b.in2.c_array()), n);
+            fused_vec_simd_stream(b.out_stream.c_array(), times_expr(plus_expr(b.in0.c_array(), b.in1.c_array()),
+                                                                      b.in2.c_array()), n);
+            b.compare(n);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( stream_functions )
+{
+    test_stream_functions<float>();
+    test_stream_functions<double>();
+}
+
+template <typename float_type>
+void test_stream_memory(void)
+{
+    for (unsigned int i = 0; i != sizeof(sizes)/sizeof(sizes[0]); ++i) {
+        const unsigned int n = sizes[i];
+
+        {
+            stream_buffers<float_type> b;
+            copyvec_simd(b.out.c_array(), b.in0.c_array(), n);
+            copyvec_simd_stream(b.out_stream.c_array(), b.in0.c_array(), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            setvec_simd(b.out.c_array(), float_type(0.25), n);
+            setvec_simd_stream(b.out_stream.c_array(), float_type(0.25), n);
+            b.compare(n);
+        }
+
+        {
+            stream_buffers<float_type> b;
+            zerovec_simd(b.out.c_array(), n);
+            zerovec_simd_stream(b.out_stream.c_array(), n);
+            b.compare(n);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( stream_memory )
+{
+    test_stream_memory<float>();
+    test_stream_memory<double>();
+}
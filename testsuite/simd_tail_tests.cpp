@@ -0,0 +1,139 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_mix.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 512;
+static const unsigned int guard = 16;
+static const unsigned int sizes[] = {1, 3, 37, 64, 100, 441};
+static const unsigned int offsets[] = {0, 1, 3};
+
+template <typename float_type>
+struct tail_buffers
+{
+    tail_buffers(unsigned int offset):
+        offset(offset)
+    {
+        randomize_buffer<float_type>(in0.c_array(), size + guard);
+        randomize_buffer<float_type>(in1.c_array(), size + guard);
+        randomize_buffer<float_type>(in2.c_array(), size + guard);
+        randomize_buffer<float_type>(in3.c_array(), size + guard);
+
+        for (unsigned int i = 0; i != size + guard; ++i)
+            out[i] = out_simd[i] = float_type(-1);
+    }
+
+    float_type * o(void)      { return out.c_array() + offset; }
+    float_type * o_simd(void) { return out_simd.c_array() + offset; }
+    const float_type * i0(void) { return in0.c_array() + offset; }
+    const float_type * i1(void) { return in1.c_array() + offset; }
+    const float_type * i2(void) { return in2.c_array() + offset; }
+    const float_type * i3(void) { return in3.c_array() + offset; }
+
+    void compare(unsigned int n, float difference = 2e-7)
+    {
+        compare_buffers(o(), o_simd(), n, difference);
+
+        /* nothing is written past the end of the buffer */
+        for (unsigned int i = offset + n; i != size + guard; ++i)
+            BOOST_REQUIRE_EQUAL( out_simd[i], float_type(-1) );
+    }
+
+    unsigned int offset;
+    aligned_array<float_type, size + guard> out, out_simd, in0, in1, in2, in3;
+};
+
+template <typename float_type>
+void test_tails(void)
+{
+    for (unsigned int s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s) {
+        for (unsigned int a = 0; a != sizeof(offsets)/sizeof(offsets[0]); ++a) {
+            const unsigned int n = sizes[s];
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                exp_vec(b.o(), b.i0(), n);
+                exp_vec_simd_any(b.o_simd(), b.i0(), n);
+                b.compare(n, 1e-6);
+            }
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                plus_vec(b.o(), b.i0(), b.i1(), n);
+                plus_vec_simd_any(b.o_simd(), b.i0(), b.i1(), n);
+                b.compare(n);
+            }
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                times_vec(b.o(), b.i0(), float_type(0.25), n);
+                times_vec_simd_any(b.o_simd(), b.i0(), float_type(0.25), n);
+                b.compare(n);
+            }
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                plus_vec(b.o(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), n);
+                plus_vec_simd_any(b.o_simd(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), n);
+                b.compare(n, 5e-4);
+            }
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                muladd_vec(b.o(), b.i0(), b.i1(), b.i2(), n);
+                muladd_vec_simd_any(b.o_simd(), b.i0(), b.i1(), b.i2(), n);
+                b.compare(n, 1e-6);
+            }
+            {
+                tail_buffers<float_type> b(offsets[a]);
+                sum_vec(b.o(), b.i0(), b.i1(), b.i2(), b.i3(), n);
+                sum_vec_simd_any(b.o_simd(), b.i0(), b.i1(), b.i2(), b.i3(), n);
+                b.compare(n, 1e-6);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( tail_tests )
+{
+    test_tails<float>();
+    test_tails<double>();
+}
+
+template <typename float_type>
+void test_in_place(void)
+{
+    for (unsigned int s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s) {
+        const unsigned int n = sizes[s];
+        tail_buffers<float_type> b(1);
+
+        for (unsigned int i = 0; i != n; ++i)
+            b.o_simd()[i] = b.i0()[i];
+
+        plus_vec(b.o(), b.i0(), b.i1(), n);
+        plus_vec_simd_any(b.o_simd(), b.o_simd(), b.i1(), n);
+        b.compare(n);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( in_place_tests )
+{
+    test_in_place<float>();
+    test_in_place<double>();
+}
+
+BOOST_AUTO_TEST_CASE( empty_tests )
+{
+    aligned_array<float, 16> out, in;
+    out[0] = -1;
+    plus_vec_simd_any(out.c_array(), in.c_array(), 1.f, 0);
+    BOOST_REQUIRE_EQUAL( out[0], -1.f );
+}
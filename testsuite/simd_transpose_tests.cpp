@@ -0,0 +1,94 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include "../simd_transpose.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "test_helper.hpp"
+
+using namespace nova;
+using namespace std;
+
+
+template <typename float_type>
+void register_tests(void)
+{
+    const int size = vec<float_type>::size;
+
+    vec<float_type> rows[size];
+    for (int i = 0; i != size; ++i)
+        for (int j = 0; j != size; ++j)
+            rows[i].set(j, float_type(i * size + j));
+
+    transpose(rows);
+
+    for (int i = 0; i != size; ++i)
+        for (int j = 0; j != size; ++j)
+            BOOST_REQUIRE_EQUAL(rows[i].get(j), float_type(j * size + i));
+}
+
+BOOST_AUTO_TEST_CASE( register_test )
+{
+    register_tests<float>();
+    register_tests<double>();
+}
+
+/* the block is taken from the middle of a larger matrix */
+template <unsigned int n, typename float_type>
+void block_tests(void)
+{
+    const unsigned int stride = 2 * n + 3;
+    aligned_array<float_type, stride * stride> src, dest;
+    randomize_buffer<float_type>(src.c_array(), src.size());
+    dest.assign(0);
+
+    const unsigned int offset = 1 + stride;
+    transpose_block<n>(dest.c_array() + offset, stride, src.c_array() + offset, stride);
+
+    for (unsigned int i = 0; i != stride; ++i) {
+        for (unsigned int j = 0; j != stride; ++j) {
+            const bool in_block = i >= 1 && i < n + 1 && j >= 1 && j < n + 1;
+            BOOST_REQUIRE_EQUAL(dest[i * stride + j], in_block ? src[j * stride + i] : float_type(0));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( block_test )
+{
+    block_tests<4, float>();
+    block_tests<8, float>();
+    block_tests<16, float>();
+    block_tests<4, double>();
+    block_tests<8, double>();
+    block_tests<16, double>();
+}
+
+template <typename float_type>
+void buffer_tests(unsigned int rows, unsigned int columns)
+{
+    const unsigned int max_size = 150 * 150;
+    aligned_array<float_type, max_size> src, dest, dest_simd;
+    randomize_buffer<float_type>(src.c_array(), rows * columns);
+
+    transpose_vec(dest.c_array(), src.c_array(), rows, columns);
+    transpose_vec_simd(dest_simd.c_array(), src.c_array(), rows, columns);
+
+    for (unsigned int row = 0; row != rows; ++row)
+        for (unsigned int column = 0; column != columns; ++column)
+            BOOST_REQUIRE_EQUAL(dest[column * rows + row], src[row * columns + column]);
+
+    for (unsigned int i = 0; i != rows * columns; ++i)
+        BOOST_REQUIRE_EQUAL(dest[i], dest_simd[i]);
+}
+
+BOOST_AUTO_TEST_CASE( buffer_test )
+{
+    /* square, rectangular, more than one cache block and partial tiles */
+    const unsigned int sizes[][2] = { {16, 16}, {32, 64}, {150, 128}, {37, 53}, {3, 70}, {150, 150} };
+
+    for (unsigned int i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        buffer_tests<float>(sizes[i][0], sizes[i][1]);
+        buffer_tests<double>(sizes[i][0], sizes[i][1]);
+    }
+}
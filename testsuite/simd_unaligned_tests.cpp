@@ -0,0 +1,166 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "test_helper.hpp"
+
+#include "../benchmarks/cache_aligned_array.hpp"
+#include "../simd_math.hpp"
+#include "../simd_binary_arithmetic.hpp"
+#include "../simd_ternary_arithmetic.hpp"
+#include "../simd_mix.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const unsigned int size = 256;
+static const unsigned int guard = 16;
+static const unsigned int offsets[] = {0, 1, 3};
+
+template <typename float_type>
+struct unaligned_buffers
+{
+    unaligned_buffers(unsigned int offset):
+        offset(offset)
+    {
+        randomize_buffer<float_type>(in0.c_array(), size + guard);
+        randomize_buffer<float_type>(in1.c_array(), size + guard);
+        randomize_buffer<float_type>(in2.c_array(), size + guard);
+        randomize_buffer<float_type>(in3.c_array(), size + guard);
+
+        for (unsigned int i = 0; i != size + guard; ++i)
+            out[i] = out_simd[i] = float_type(-1);
+    }
+
+    float_type * o(void)      { return out.c_array() + offset; }
+    float_type * o_simd(void) { return out_simd.c_array() + offset; }
+    const float_type * i0(void) { return in0.c_array() + offset; }
+    const float_type * i1(void) { return in1.c_array() + offset; }
+    const float_type * i2(void) { return in2.c_array() + offset; }
+    const float_type * i3(void) { return in3.c_array() + offset; }
+
+    void compare(unsigned int n, float difference = 2e-7)
+    {
+        compare_buffers(o(), o_simd(), n, difference);
+
+        for (unsigned int i = offset + n; i != size + guard; ++i)
+            BOOST_REQUIRE_EQUAL( out_simd[i], float_type(-1) );
+    }
+
+    unsigned int offset;
+    aligned_array<float_type, size + guard> out, out_simd, in0, in1, in2, in3;
+};
+
+template <typename float_type>
+void test_na_simd(void)
+{
+    for (unsigned int a = 0; a != sizeof(offsets)/sizeof(offsets[0]); ++a) {
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            exp_vec(b.o(), b.i0(), size);
+            exp_vec_na_simd(b.o_simd(), b.i0(), size);
+            b.compare(size, 1e-6);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            exp_vec(b.o(), b.i0(), size);
+            exp_vec_na_simd<size>(b.o_simd(), b.i0());
+            b.compare(size, 1e-6);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            plus_vec(b.o(), b.i0(), b.i1(), size);
+            plus_vec_na_simd(b.o_simd(), b.i0(), b.i1(), size);
+            b.compare(size);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            times_vec(b.o(), b.i0(), float_type(0.25), size);
+            times_vec_na_simd<size>(b.o_simd(), b.i0(), float_type(0.25));
+            b.compare(size);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            plus_vec(b.o(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), size);
+            plus_vec_na_simd(b.o_simd(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), size);
+            b.compare(size, 5e-4);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            muladd_vec(b.o(), b.i0(), b.i1(), b.i2(), size);
+            muladd_vec_na_simd(b.o_simd(), b.i0(), b.i1(), b.i2(), size);
+            b.compare(size, 1e-6);
+        }
+        {
+            unaligned_buffers<float_type> b(offsets[a]);
+            sum_vec(b.o(), b.i0(), b.i1(), b.i2(), b.i3(), size);
+            sum_vec_na_simd<size>(b.o_simd(), b.i0(), b.i1(), b.i2(), b.i3());
+            b.compare(size, 1e-6);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( na_simd_tests )
+{
+    test_na_simd<float>();
+    test_na_simd<double>();
+}
+
+/* aligned output and aligned first argument, unaligned second argument */
+template <typename float_type>
+void test_mixed_alignment(void)
+{
+    aligned_array<float_type, size + guard> out, out_simd, out_na, in0, in1;
+    randomize_buffer<float_type>(in0.c_array(), size + guard);
+    randomize_buffer<float_type>(in1.c_array(), size + guard);
+
+    const float_type * unaligned_in = in1.c_array() + 1;
+
+    plus_vec(out.c_array(), in0.c_array(), unaligned_in, size);
+    plus_vec_simd(out_simd.c_array(), in0.c_array(), unaligned_vector_argument(unaligned_in), size);
+    plus_vec_na_simd(out_na.c_array(), aligned_vector_argument(in0.c_array()), unaligned_in, size);
+    compare_buffers(out.c_array(), out_simd.c_array(), size);
+    compare_buffers(out.c_array(), out_na.c_array(), size);
+
+    plus_vec_simd<size>(out_simd.c_array(), unaligned_vector_argument(unaligned_in), in0.c_array());
+    compare_buffers(out.c_array(), out_simd.c_array(), size);
+}
+
+BOOST_AUTO_TEST_CASE( mixed_alignment_tests )
+{
+    test_mixed_alignment<float>();
+    test_mixed_alignment<double>();
+}
+
+/* _simd_any peels the output to its alignment boundary, which also needs to advance the ramp */
+template <typename float_type>
+void test_peeling(void)
+{
+    const unsigned int sizes[] = {5, 37, 100, 253};
+    for (unsigned int s = 0; s != sizeof(sizes)/sizeof(sizes[0]); ++s) {
+        for (unsigned int a = 1; a != sizeof(offsets)/sizeof(offsets[0]); ++a) {
+            const unsigned int n = sizes[s];
+            {
+                unaligned_buffers<float_type> b(offsets[a]);
+                plus_vec(b.o(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), n);
+                plus_vec_simd_any(b.o_simd(), b.i0(), slope_argument(float_type(0.5), float_type(0.001)), n);
+                b.compare(n, 5e-4);
+            }
+            {
+                unaligned_buffers<float_type> b(offsets[a]);
+                times_vec(b.o(), b.i0() + 1, b.i1(), n);
+                times_vec_simd_any(b.o_simd(), b.i0() + 1, b.i1(), n);
+                b.compare(n);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( peeling_tests )
+{
+    test_peeling<float>();
+    test_peeling<double>();
+}
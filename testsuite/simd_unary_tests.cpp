@@ -181,3 +181,50 @@ BOOST_AUTO_TEST_CASE( reciprocal_tester )
     reciprical_compare<float>();
     reciprical_compare<double>();
 }
+
+template <typename float_type>
+void sqrt_compare(void)
+{
+    aligned_array<float_type, size> out, out_simd, out_mp, in;
+
+    for (int i = 0; i != size; ++i)
+        in [i] = (i * 100)/(float_type)size + float_type(0.01);
+
+    nova::sqrt_vec<float_type>(out.c_array(), in.c_array(), size);
+    nova::sqrt_vec_simd<float_type>(out_simd.c_array(), in.c_array(), size);
+    nova::sqrt_vec_simd<size>(out_mp.c_array(), in.c_array());
+    compare_buffers(out.c_array(), out_simd.c_array(), size, 1e-6f);
+    compare_buffers(out.c_array(), out_mp.c_array(), size, 1e-6f);
+
+    /* one newton step: about 22 bits for float, double is exact */
+    nova::rsqrt_vec<float_type>(out.c_array(), in.c_array(), size);
+    nova::rsqrt_vec_simd<float_type>(out_simd.c_array(), in.c_array(), size);
+    nova::rsqrt_vec_simd<size>(out_mp.c_array(), in.c_array());
+    compare_buffers(out.c_array(), out_simd.c_array(), size, 1e-6f);
+    compare_buffers(out.c_array(), out_mp.c_array(), size, 1e-6f);
+
+    /* the estimate has at least 12 bits */
+    nova::fast_rsqrt_vec_simd<float_type>(out_simd.c_array(), in.c_array(), size);
+    compare_buffers(out.c_array(), out_simd.c_array(), size, 4e-4f);
+
+    typedef nova::vec<float_type> vec_type;
+    const float_type infinity = std::numeric_limits<float_type>::infinity();
+    BOOST_REQUIRE_EQUAL(rsqrt(vec_type(float_type(0))).get(0), infinity);
+    BOOST_REQUIRE_EQUAL(rsqrt(vec_type(infinity)).get(0), float_type(0));
+
+    /* subnormal arguments */
+    const float_type min = std::numeric_limits<float_type>::min();
+    for (int i = 0; i != size; ++i)
+        in[i] = min * (i + 1) / (size + 1);
+    in[0] = std::numeric_limits<float_type>::denorm_min();
+
+    nova::rsqrt_vec<float_type>(out.c_array(), in.c_array(), size);
+    nova::rsqrt_vec_simd<float_type>(out_simd.c_array(), in.c_array(), size);
+    compare_buffers(out.c_array(), out_simd.c_array(), size, 1e-6f);
+}
+
+BOOST_AUTO_TEST_CASE( sqrt_tester )
+{
+    sqrt_compare<float>();
+    sqrt_compare<double>();
+}
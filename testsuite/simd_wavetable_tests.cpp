@@ -0,0 +1,103 @@
+#include <iostream>
+#define BOOST_TEST_MAIN
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+
+#include <cmath>
+
+#include "../simd_wavetable.hpp"
+#include "test_helper.hpp"
+#include "../benchmarks/cache_aligned_array.hpp"
+
+using namespace nova;
+using namespace std;
+
+static const int size = 512;
+static const int table_size = 256;
+
+template <typename float_type, typename Interpolation>
+void test_table_read(void)
+{
+    aligned_array<float_type, table_size> table;
+    aligned_array<float_type, size> phase, generic, sseval, mpval;
+    randomize_buffer<float_type>(table.c_array(), table_size);
+    randomize_buffer<float_type>(phase.c_array(), size, float_type(table_size), float_type(-0.1 * table_size));
+
+    for (int i = 0; i != size; ++i)
+        phase[i] = std::max(phase[i], float_type(0));
+
+    table_read_vec<Interpolation>(generic.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<Interpolation>(sseval.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<size, Interpolation>(mpval.c_array(), table.c_array(), table_size, phase.c_array());
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_CHECK_CLOSE( sseval[i], generic[i], 0.0001 );
+        BOOST_CHECK_CLOSE( mpval[i], generic[i], 0.0001 );
+    }
+
+    float_type base = 3.5, slope = 0.375; // exact, so both ramps hit the same points
+    table_read_vec<Interpolation>(generic.c_array(), table.c_array(), table_size, wrap_argument(base, slope), size);
+    table_read_vec_simd<Interpolation>(sseval.c_array(), table.c_array(), table_size, wrap_argument(base, slope), size);
+
+    for (int i = 0; i != size; ++i)
+        BOOST_CHECK_CLOSE( sseval[i], generic[i], 0.001 );
+}
+
+template <typename float_type>
+void test_table_read(void)
+{
+    test_table_read<float_type, interpolation::none>();
+    test_table_read<float_type, interpolation::linear>();
+    test_table_read<float_type, interpolation::cubic>();
+}
+
+BOOST_AUTO_TEST_CASE( table_read_tests )
+{
+    test_table_read<float>();
+    test_table_read<double>();
+}
+
+template <typename float_type>
+void test_table_read_points(void)
+{
+    aligned_array<float_type, table_size> table;
+    aligned_array<float_type, size> phase, none, linear, cubic;
+    randomize_buffer<float_type>(table.c_array(), table_size);
+
+    for (int i = 0; i != size; ++i)
+        phase[i] = float_type(i % table_size);
+
+    table_read_vec_simd<interpolation::none>(none.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<interpolation::linear>(linear.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<interpolation::cubic>(cubic.c_array(), table.c_array(), table_size, phase.c_array(), size);
+
+    /* all interpolations pass through the table points */
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( none[i], table[i % table_size] );
+        BOOST_REQUIRE_EQUAL( linear[i], table[i % table_size] );
+        BOOST_CHECK_CLOSE( cubic[i], table[i % table_size], 0.0001 );
+    }
+
+    /* the last segment wraps around to the start of the table */
+    for (int i = 0; i != size; ++i)
+        phase[i] = float_type(table_size) - float_type(0.5);
+
+    table_read_vec_simd<interpolation::none>(none.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<interpolation::linear>(linear.c_array(), table.c_array(), table_size, phase.c_array(), size);
+    table_read_vec_simd<interpolation::cubic>(cubic.c_array(), table.c_array(), table_size, phase.c_array(), size);
+
+    const float_type ym1 = table[table_size - 2], y0 = table[table_size - 1], y1 = table[0], y2 = table[1];
+    const float_type cubic_midpoint = (float_type(9) * (y0 + y1) - (ym1 + y2)) / float_type(16);
+
+    for (int i = 0; i != size; ++i) {
+        BOOST_REQUIRE_EQUAL( none[i], y0 );
+        BOOST_CHECK_CLOSE( linear[i], float_type(0.5) * (y0 + y1), 0.0001 );
+        BOOST_CHECK_CLOSE( cubic[i], cubic_midpoint, 0.0001 );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( table_read_point_tests )
+{
+    test_table_read_points<float>();
+    test_table_read_points<double>();
+}
@@ -4,6 +4,7 @@
 #include <boost/test/floating_point_comparison.hpp>
 
 #include <cmath>
+#include <limits>
 
 #include "../softclip.hpp"
 #include "../benchmarks/cache_aligned_array.hpp"
@@ -28,3 +29,52 @@ BOOST_AUTO_TEST_CASE( softclip_tests_float )
 
     compare_buffers(normal_val.begin(), simd_val.begin(), 10000, 1e-8f);
 }
+
+template <typename float_type>
+void test_algebraic_sigmoids(void)
+{
+    const int size = 10000;
+    aligned_array<float_type, size> simd_val, normal_val, arguments;
+
+    for (int i = 0; i != size; ++i)
+        arguments[i] = float_type(-20) + float_type(40) * float_type(i) / float_type(size);
+
+#define COMPARE_SIGMOID(name)                                               \
+    name##_vec_simd(simd_val.begin(), arguments.begin(), size);             \
+    name##_vec(normal_val.begin(), arguments.begin(), size);                \
+    compare_buffers(normal_val.begin(), simd_val.begin(), size, 1e-6f);
+
+    COMPARE_SIGMOID(algebraic_sigmoid1)
+    COMPARE_SIGMOID(algebraic_sigmoid2)
+    COMPARE_SIGMOID(algebraic_sigmoid4)
+
+#undef COMPARE_SIGMOID
+
+    /* unity gain around 0, saturation at -1 and 1 */
+    const float_type infinity = std::numeric_limits<float_type>::infinity();
+    const float_type special[] = { 0, float_type(1e-6), -float_type(1e-6), float_type(1e20), -float_type(1e20),
+                                   infinity, -infinity, 0 };
+    const float_type expected[] = { 0, float_type(1e-6), -float_type(1e-6), 1, -1, 1, -1, 0 };
+
+    for (int i = 0; i != size; i += 8)
+        for (int j = 0; j != 8; ++j)
+            arguments[i + j] = special[j];
+
+    algebraic_sigmoid1_vec_simd(simd_val.begin(), arguments.begin(), size);
+    for (int i = 0; i != 8; ++i)
+        BOOST_CHECK_CLOSE( simd_val[i], expected[i], 1e-3 );
+
+    algebraic_sigmoid2_vec_simd(simd_val.begin(), arguments.begin(), size);
+    for (int i = 0; i != 8; ++i)
+        BOOST_CHECK_CLOSE( simd_val[i], expected[i], 1e-3 );
+
+    algebraic_sigmoid4_vec_simd(simd_val.begin(), arguments.begin(), size);
+    for (int i = 0; i != 8; ++i)
+        BOOST_CHECK_CLOSE( simd_val[i], expected[i], 1e-3 );
+}
+
+BOOST_AUTO_TEST_CASE( algebraic_sigmoid_tests )
+{
+    test_algebraic_sigmoids<float>();
+    test_algebraic_sigmoids<double>();
+}
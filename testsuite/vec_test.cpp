@@ -110,10 +110,33 @@ void test_select(void)
     BOOST_REQUIRE(select_b.get(0) == 2);
 }
 
+template <typename T>
+void test_mask_select(void)
+{
+    typedef vec<T> vec_t;
+    vec_t ramp, threshold(T(vec_t::size / 2)), zero = vec_t::gen_zero();
+    ramp.set_slope(0, 1);
+
+    vec_t lt = mask_lt(ramp, threshold);
+    vec_t ge = mask_ge(ramp, threshold);
+    vec_t selected = select(ramp, zero, lt);
+    vec_t relational = ramp < threshold;
+
+    for (int i = 0; i != vec_t::size; ++i) {
+        bool expected = i < vec_t::size / 2;
+        BOOST_REQUIRE_EQUAL( selected.get(i), expected ? T(0) : T(i) );
+        BOOST_REQUIRE_EQUAL( relational.get(i), expected ? T(1) : T(0) );
+        BOOST_REQUIRE_EQUAL( select(zero, ramp, ge).get(i), expected ? T(0) : T(i) );
+        BOOST_REQUIRE_EQUAL( select(zero, ramp, andnot(lt, ge)).get(i), expected ? T(0) : T(i) );
+    }
+}
+
 BOOST_AUTO_TEST_CASE( select_tester )
 {
     test_select<float>();
     test_select<double>();
+    test_mask_select<float>();
+    test_mask_select<double>();
 }
 
 BOOST_AUTO_TEST_CASE( align_ )
@@ -30,13 +30,17 @@
 #  include "vec/vec_altivec.hpp"
 #endif
 
-#ifdef __AVX__
+#ifdef __AVX512F__
+#  include "vec/vec_avx512_float.hpp"
+#elif defined(__AVX__)
 #  include "vec/vec_avx_float.hpp"
 #elif defined(__SSE__)
 #  include "vec/vec_sse.hpp"
 #endif
 
-#ifdef __AVX__
+#ifdef __AVX512F__
+#  include "vec/vec_avx512_double.hpp"
+#elif defined(__AVX__)
 #  include "vec/vec_avx_double.hpp"
 #elif defined(__SSE2__)
 #  include "vec/vec_sse2.hpp"
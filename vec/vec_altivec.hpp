@@ -129,7 +129,7 @@ public:
     static const int size = 4;
     static const int objects_per_cacheline = 64/sizeof(float);
 
-    static bool is_aligned(float* ptr)
+    static bool is_aligned(const float * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(float) - 1)) == 0;
     }
@@ -420,6 +420,16 @@ public:
         return vec_sqrt(arg.data_);
     }
 
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return vec_rsqrte(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return detail::vec_rsqrt_newton<NOVA_SIMD_RSQRT_NEWTON_STEPS>(arg);
+    }
+
     friend inline vec cube(vec const & arg)
     {
         return vec_mul(arg.data_, vec_mul(arg.data_, arg.data_));
@@ -478,6 +488,48 @@ public:
     {
         return int_vec(vec_ctu(data_, 0));
     }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const float * base, int_vec const & index)
+    {
+        unsigned int indices[4] __attribute__((aligned(16)));
+        vec_st(index.data_, 0, indices);
+
+        vec ret;
+        for (int i = 0; i != 4; ++i)
+            ret.set(i, base[indices[i]]);
+        return ret;
+    }
+    /* @} */
+
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = vec_mergeh(lhs.data_, rhs.data_);
+        high = vec_mergel(lhs.data_, rhs.data_);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const vector unsigned char even_bytes = { 0,  1,  2,  3,  8,  9, 10, 11, 16, 17, 18, 19, 24, 25, 26, 27};
+        const vector unsigned char odd_bytes  = { 4,  5,  6,  7, 12, 13, 14, 15, 20, 21, 22, 23, 28, 29, 30, 31};
+        even = vec_perm(lhs.data_, rhs.data_, even_bytes);
+        odd  = vec_perm(lhs.data_, rhs.data_, odd_bytes);
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        const __vector float r02_high = vec_mergeh(rows[0].data_, rows[2].data_);
+        const __vector float r02_low  = vec_mergel(rows[0].data_, rows[2].data_);
+        const __vector float r13_high = vec_mergeh(rows[1].data_, rows[3].data_);
+        const __vector float r13_low  = vec_mergel(rows[1].data_, rows[3].data_);
+
+        rows[0] = vec_mergeh(r02_high, r13_high);
+        rows[1] = vec_mergel(r02_high, r13_high);
+        rows[2] = vec_mergeh(r02_low,  r13_low);
+        rows[3] = vec_mergel(r02_low,  r13_low);
+    }
     /* @} */
 
 
@@ -513,6 +565,13 @@ public:
         return detail::vec_cos_float(arg);
     }
 
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_float(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(float)
+
     friend inline vec tan(vec const & arg)
     {
         return detail::vec_tan_float(arg);
@@ -533,11 +592,56 @@ public:
         return detail::vec_atan_float(arg);
     }
 
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
     friend inline vec tanh(vec const & arg)
     {
         return detail::vec_tanh_float(arg);
     }
 
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
     friend inline vec signed_pow(vec const & lhs, vec const & rhs)
     {
         return detail::vec_signed_pow(lhs, rhs);
@@ -550,7 +654,27 @@ public:
 
     friend inline vec log2(vec const & arg)
     {
-        return detail::vec_log2(arg);
+        return detail::vec_log2_float(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_float(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_float(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
     }
 
     friend inline vec log10(vec const & arg)
@@ -564,14 +688,21 @@ public:
 
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(atan2)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(hypot)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp2)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(expm1)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log1p)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cbrt)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
+    NOVA_SIMD_DELEGATE_SINCOS_TO_BASE
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
@@ -579,6 +710,14 @@ public:
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atanh)
+
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erf)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erfc)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(signed_sqrt)
 
@@ -0,0 +1,671 @@
+//  avx512 double-precision vector class
+//
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef VEC_AVX512_DOUBLE_HPP
+#define VEC_AVX512_DOUBLE_HPP
+
+#include <immintrin.h>
+
+#include "../detail/vec_math.hpp"
+#include "vec_transpose_avx.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+#include "vec_int_avx512.hpp"
+#include "vec_base.hpp"
+
+#include "stdint.h"
+
+namespace nova
+{
+
+
+template <>
+struct vec<double>:
+    vec_base<double, __m512d, 8>
+{
+private:
+    typedef vec_base<double, __m512d, 8> base;
+
+public:
+    static const bool has_compare_bitmask = true;
+
+    typedef __m512d internal_vector_type;
+    typedef double float_type;
+
+    static inline __m512d gen_sign_mask(void)
+    {
+        return set_bitmask(0x8000000000000000);
+    }
+
+    static inline __m512d gen_abs_mask(void)
+    {
+        return set_bitmask(0x7fffffffffffffff);
+    }
+
+    static inline __m512d gen_one(void)
+    {
+        return _mm512_set1_pd(1.f);
+    }
+
+    static inline __m512d gen_05(void)
+    {
+        return _mm512_set1_pd(0.5f);
+    }
+
+    static inline __m512d set_bitmask(uint64_t mask)
+    {
+        return _mm512_castsi512_pd(_mm512_set1_epi64(mask));
+    }
+
+    static inline __m512d gen_exp_mask(void)
+    {
+        return set_bitmask(0x7FF0000000000000);
+    }
+
+    static inline __m512d gen_exp_mask_1(void)
+    {
+        return set_bitmask(0x3FE0000000000000);
+    }
+
+    static inline __m512d gen_ones(void)
+    {
+        return set_bitmask(0xffffffffffffffff);
+    }
+
+    static inline __m512d gen_zero(void)
+    {
+        return _mm512_setzero_pd();
+    }
+
+    vec(__m512d const & arg):
+        base(arg)
+    {}
+
+private:
+    /* compare results live in mask registers. they are expanded to lane-wise bitmasks for mask_*
+     * and turned back into mask registers by select */
+    static inline __m512d expand_mask(__mmask8 mask)
+    {
+        return _mm512_castsi512_pd(detail::int64_vec_avx512::expand_mask(mask));
+    }
+
+    static inline __mmask8 compress_mask(__m512d bitmask)
+    {
+        /* like blendv, only the sign bit of each lane is relevant */
+        return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(bitmask), _mm512_setzero_si512());
+    }
+
+    static inline __m512d bitwise_and(__m512d lhs, __m512d rhs)
+    {
+        return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+    }
+
+    static inline __m512d bitwise_or(__m512d lhs, __m512d rhs)
+    {
+        return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+    }
+
+    static inline __m512d bitwise_xor(__m512d lhs, __m512d rhs)
+    {
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+    }
+
+public:
+    static const int size = 8;
+    static const int objects_per_cacheline = 64/sizeof(double);
+
+    static bool is_aligned(const double * ptr)
+    {
+        return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(double) - 1)) == 0;
+    }
+
+    /* @{ */
+    /** constructors */
+    vec(void)
+    {}
+
+    vec(double f)
+    {
+        set_vec(f);
+    }
+
+    vec(float f)
+    {
+        set_vec((double)f);
+    }
+
+    vec(vec const & rhs)
+    {
+        data_ = rhs.data_;
+    }
+    /* @} */
+
+    /* @{ */
+    /** io */
+    void load(const double * data)
+    {
+        data_ = _mm512_loadu_pd(data);
+    }
+
+    void load_aligned(const double * data)
+    {
+        data_ = _mm512_load_pd(data);
+    }
+
+    void load_first(const double * data)
+    {
+        data_ = _mm512_maskz_loadu_pd(1, data);
+    }
+
+    void store(double * dest) const
+    {
+        _mm512_storeu_pd(dest, data_);
+    }
+
+    void store_aligned(double * dest) const
+    {
+        _mm512_store_pd(dest, data_);
+    }
+
+    void store_aligned_stream(double * dest) const
+    {
+        _mm512_stream_pd(dest, data_);
+    }
+
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
+    void clear(void)
+    {
+        data_ = gen_zero();
+    }
+
+    operator __m512d(void) const
+    {
+        return data_;
+    }
+
+    /* @} */
+
+    /* @{ */
+    /** element access */
+    void set_vec (double value)
+    {
+        data_ = _mm512_set1_pd(value);
+    }
+
+    double set_slope(double start, double slope)
+    {
+        double values[size];
+        values[0] = start;
+        for (int i = 1; i != size; ++i)
+            values[i] = values[i-1] + slope;
+        data_ = _mm512_loadu_pd(values);
+        return slope * size;
+    }
+
+    double set_exp(double start, double curve)
+    {
+        double values[size];
+        values[0] = start;
+        for (int i = 1; i != size; ++i)
+            values[i] = values[i-1] * curve;
+        data_ = _mm512_loadu_pd(values);
+        return values[size-1] * curve;
+    }
+    /* @} */
+
+    /* @{ */
+    /** arithmetic operators */
+#define OPERATOR_ASSIGNMENT(op, opcode) \
+    vec & operator op(vec const & rhs) \
+    { \
+        data_ = opcode(data_, rhs.data_);\
+        return *this;\
+    }
+
+    OPERATOR_ASSIGNMENT(+=, _mm512_add_pd)
+    OPERATOR_ASSIGNMENT(-=, _mm512_sub_pd)
+    OPERATOR_ASSIGNMENT(*=, _mm512_mul_pd)
+    OPERATOR_ASSIGNMENT(/=, _mm512_div_pd)
+
+#undef OPERATOR_ASSIGNMENT
+
+#define ARITHMETIC_OPERATOR(op, opcode) \
+    vec operator op(vec const & rhs) const \
+    { \
+        return opcode(data_, rhs.data_); \
+    } \
+ \
+    friend vec operator op(vec const & lhs, double f)  \
+    { \
+        return opcode(lhs.data_, vec(f).data_); \
+    } \
+    \
+    friend vec operator op(double f, vec const & rhs)  \
+    { \
+        return opcode(vec(f).data_, rhs.data_); \
+    }
+
+    ARITHMETIC_OPERATOR(+, _mm512_add_pd)
+    ARITHMETIC_OPERATOR(-, _mm512_sub_pd)
+    ARITHMETIC_OPERATOR(*, _mm512_mul_pd)
+    ARITHMETIC_OPERATOR(/, _mm512_div_pd)
+
+#undef ARITHMETIC_OPERATOR
+
+    friend vec operator -(const vec & arg)
+    {
+        return bitwise_xor(arg.data_, gen_sign_mask());
+    }
+
+    friend vec fast_reciprocal(const vec & arg)
+    {
+        return _mm512_rcp14_pd(arg.data_);
+    }
+
+    friend vec reciprocal(const vec & arg)
+    {
+        return detail::vec_reciprocal_newton(arg);
+    }
+
+    inline friend vec madd(vec const & arg1, vec const & arg2, vec const & arg3)
+    {
+        return _mm512_fmadd_pd(arg1.data_, arg2.data_, arg3.data_);
+    }
+
+#define RELATIONAL_OPERATOR(op, RELATION) \
+    vec operator op(vec const & rhs) const \
+    { \
+        const __m512d one = gen_one(); \
+        return _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(data_, rhs.data_, RELATION), one); \
+    }
+
+    RELATIONAL_OPERATOR(<, _CMP_LT_OS)
+    RELATIONAL_OPERATOR(<=, _CMP_LE_OS)
+    RELATIONAL_OPERATOR(>, _CMP_NLE_US)
+    RELATIONAL_OPERATOR(>=, _CMP_NLT_US)
+    RELATIONAL_OPERATOR(==, _CMP_EQ_OQ)
+    RELATIONAL_OPERATOR(!=, _CMP_NEQ_UQ)
+#undef RELATIONAL_OPERATOR
+
+    /* @{ */
+#define BITWISE_OPERATOR(op, opcode) \
+    vec operator op(vec const & rhs) const \
+    { \
+        return opcode(data_, rhs.data_); \
+    }
+
+    BITWISE_OPERATOR(&, bitwise_and)
+    BITWISE_OPERATOR(|, bitwise_or)
+    BITWISE_OPERATOR(^, bitwise_xor)
+
+#undef BITWISE_OPERATOR
+
+    friend inline vec andnot(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(lhs.data_),
+                                                       _mm512_castpd_si512(rhs.data_)));
+    }
+
+#define RELATIONAL_MASK_OPERATOR(op, RELATION) \
+    friend vec mask_##op(vec const & lhs, vec const & rhs) \
+    { \
+        return expand_mask(_mm512_cmp_pd_mask(lhs.data_, rhs.data_, RELATION)); \
+    }
+
+    RELATIONAL_MASK_OPERATOR(lt, _CMP_LT_OS)
+    RELATIONAL_MASK_OPERATOR(le, _CMP_LE_OS)
+    RELATIONAL_MASK_OPERATOR(gt, _CMP_NLE_US)
+    RELATIONAL_MASK_OPERATOR(ge, _CMP_NLT_US)
+    RELATIONAL_MASK_OPERATOR(eq, _CMP_EQ_OQ)
+    RELATIONAL_MASK_OPERATOR(neq, _CMP_NEQ_UQ)
+
+#undef RELATIONAL_MASK_OPERATOR
+
+    friend inline vec select(vec lhs, vec rhs, vec bitmask)
+    {
+        /* if bitmask is set, return value in rhs, else value in lhs */
+        return _mm512_mask_blend_pd(compress_mask(bitmask.data_), lhs.data_, rhs.data_);
+    }
+
+    /* @} */
+
+    /* @{ */
+    /** unary functions */
+    friend inline vec abs(vec const & arg)
+    {
+        return bitwise_and(gen_abs_mask(), arg.data_);
+    }
+
+    friend always_inline vec sign(vec const & arg)
+    {
+        return detail::vec_sign(arg);
+    }
+
+    friend inline vec square(vec const & arg)
+    {
+        return _mm512_mul_pd(arg.data_, arg.data_);
+    }
+
+    friend inline vec sqrt(vec const & arg)
+    {
+        return _mm512_sqrt_pd(arg.data_);
+    }
+
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return _mm512_rsqrt14_pd(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return vec(1.0) / sqrt(arg);
+    }
+
+    friend inline vec cube(vec const & arg)
+    {
+        return arg * arg * arg;
+    }
+    /* @} */
+
+    /* @{ */
+    /** binary functions */
+    friend inline vec max_(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_max_pd(lhs.data_, rhs.data_);
+    }
+
+    friend inline vec min_(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_min_pd(lhs.data_, rhs.data_);
+    }
+    /* @} */
+
+    /* @{ */
+    /** rounding functions */
+    friend inline vec round(vec const & arg)
+    {
+        return _mm512_roundscale_pd(arg.data_, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec frac(vec const & arg)
+    {
+        vec floor_result = floor(arg);
+        return arg - floor_result;
+    }
+
+    friend inline vec floor(vec const & arg)
+    {
+        return _mm512_roundscale_pd(arg.data_, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec ceil(vec const & arg)
+    {
+        return _mm512_roundscale_pd(arg.data_, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec trunc(vec const & arg)
+    {
+        return _mm512_roundscale_pd(arg.data_, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    }
+    /* @} */
+
+
+    /* @{ */
+    /** mathematical functions */
+    friend inline vec exp(vec const & arg)
+    {
+        return detail::vec_exp_double(arg);
+    }
+
+    friend inline vec log(vec const & arg)
+    {
+        return detail::vec_log_double(arg);
+    }
+
+    friend inline vec pow(vec const & arg1, vec const & arg2)
+    {
+        return detail::vec_pow(arg1, arg2);
+    }
+
+    friend inline vec sin(vec const & arg)
+    {
+        return detail::vec_sin_double(arg);
+    }
+
+    friend inline vec cos(vec const & arg)
+    {
+        return detail::vec_cos_double(arg);
+    }
+
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_double(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(double)
+
+    friend inline vec tan(vec const & arg)
+    {
+        return detail::vec_tan_double(arg);
+    }
+
+    friend inline vec asin(vec const & arg)
+    {
+        return detail::vec_asin_double(arg);
+    }
+
+    friend inline vec acos(vec const & arg)
+    {
+        return detail::vec_acos_double(arg);
+    }
+
+    friend inline vec atan(vec const & arg)
+    {
+        return detail::vec_atan_double(arg);
+    }
+
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
+    friend inline vec tanh(vec const & arg)
+    {
+        return detail::vec_tanh_double(arg);
+    }
+
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
+    friend inline vec signed_pow(vec const & lhs, vec const & rhs)
+    {
+        return detail::vec_signed_pow(lhs, rhs);
+    }
+
+    friend inline vec signed_sqrt(vec const & arg)
+    {
+        return detail::vec_signed_sqrt(arg);
+    }
+
+    friend inline vec log2(vec const & arg)
+    {
+        return detail::vec_log2_double(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_double(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_double(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
+    }
+
+    friend inline vec log10(vec const & arg)
+    {
+        return detail::vec_log10(arg);
+    }
+
+    friend inline vec undenormalize(vec const & arg)
+    {
+        return detail::vec_undenormalize(arg);
+    }
+    /* @} */
+
+    /* @{ */
+    /** horizontal functions */
+    inline double horizontal_min(void) const
+    {
+        return _mm512_reduce_min_pd(data_);
+    }
+
+    inline double horizontal_max(void) const
+    {
+        return _mm512_reduce_max_pd(data_);
+    }
+
+    inline double horizontal_sum(void) const
+    {
+        return _mm512_reduce_add_pd(data_);
+    }
+    /* @} */
+
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* indices 8 to 15 select from rhs */
+        const __m512i low_index  = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+        const __m512i high_index = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+        low  = _mm512_permutex2var_pd(lhs.data_, low_index, rhs.data_);
+        high = _mm512_permutex2var_pd(lhs.data_, high_index, rhs.data_);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const __m512i even_index = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+        const __m512i odd_index  = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+        even = _mm512_permutex2var_pd(lhs.data_, even_index, rhs.data_);
+        odd  = _mm512_permutex2var_pd(lhs.data_, odd_index, rhs.data_);
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        /* log2(size) rounds of zipping row i with row i + size/2 */
+        for (int round = 0; round != 3; ++round) {
+            vec zipped[8];
+            for (int i = 0; i != 4; ++i)
+                interleave(rows[i], rows[i + 4], zipped[2*i], zipped[2*i + 1]);
+
+            for (int i = 0; i != 8; ++i)
+                rows[i] = zipped[i];
+        }
+    }
+
+    static inline void transpose_4x4(double * dest, unsigned int dest_stride, const double * src, unsigned int src_stride)
+    {
+        detail::transpose_block_4x4(dest, dest_stride, src, src_stride);
+    }
+    /* @} */
+
+    /* @{ */
+    typedef nova::detail::int64_vec_avx512 int_vec;
+
+    vec (int_vec const & rhs):
+        base(_mm512_castsi512_pd(rhs.data_))
+    {}
+
+    int_vec truncate_to_int(void) const
+    {
+        __m256i int_val = _mm512_cvttpd_epi32(data_);
+        return int_vec::from_int32(int_val);
+    }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const double * base, int_vec const & index)
+    {
+        return _mm512_i64gather_pd(index.data_, base, 8);
+    }
+    /* @} */
+};
+
+} /* namespace nova */
+
+
+#undef always_inline
+
+#endif /* VEC_AVX512_DOUBLE_HPP */
@@ -0,0 +1,701 @@
+//  avx512 single-precision vector class
+//
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef VEC_AVX512_FLOAT_HPP
+#define VEC_AVX512_FLOAT_HPP
+
+#include <immintrin.h>
+
+#include "../detail/vec_math.hpp"
+#include "vec_transpose_avx.hpp"
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+#include "vec_int_avx512.hpp"
+#include "vec_base.hpp"
+
+namespace nova
+{
+
+
+template <>
+struct vec<float>:
+    vec_base<float, __m512, 16>
+{
+private:
+    typedef vec_base<float, __m512, 16> base;
+
+public:
+    static const bool has_compare_bitmask = true;
+
+    typedef __m512 internal_vector_type;
+    typedef float float_type;
+
+    static inline __m512 gen_sign_mask(void)
+    {
+        return set_bitmask(0x80000000);
+    }
+
+    static inline __m512 gen_abs_mask(void)
+    {
+        return set_bitmask(0x7fffffff);
+    }
+
+    static inline __m512 gen_one(void)
+    {
+        return _mm512_set1_ps(1.f);
+    }
+
+    static inline __m512 gen_05(void)
+    {
+        return _mm512_set1_ps(0.5f);
+    }
+
+    static inline __m512 set_bitmask(unsigned int mask)
+    {
+        return _mm512_castsi512_ps(_mm512_set1_epi32(mask));
+    }
+
+    static inline __m512 gen_exp_mask(void)
+    {
+        return set_bitmask(0x7F800000);
+    }
+
+    static inline __m512 gen_exp_mask_1(void)
+    {
+        return set_bitmask(0x3F000000);
+    }
+
+    static inline __m512 gen_ones(void)
+    {
+        return set_bitmask(0xffffffff);
+    }
+
+    static inline __m512 gen_zero(void)
+    {
+        return _mm512_setzero_ps();
+    }
+
+    vec(__m512 const & arg):
+        base(arg)
+    {}
+
+private:
+    /* compare results live in mask registers. they are expanded to lane-wise bitmasks for mask_*
+     * and turned back into mask registers by select */
+    static inline __m512 expand_mask(__mmask16 mask)
+    {
+        return _mm512_castsi512_ps(detail::int_vec_avx512::expand_mask(mask));
+    }
+
+    static inline __mmask16 compress_mask(__m512 bitmask)
+    {
+        /* like blendv, only the sign bit of each lane is relevant */
+        return _mm512_cmplt_epi32_mask(_mm512_castps_si512(bitmask), _mm512_setzero_si512());
+    }
+
+    static inline __m512 bitwise_and(__m512 lhs, __m512 rhs)
+    {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    }
+
+    static inline __m512 bitwise_or(__m512 lhs, __m512 rhs)
+    {
+        return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    }
+
+    static inline __m512 bitwise_xor(__m512 lhs, __m512 rhs)
+    {
+        return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    }
+
+public:
+    static const int size = 16;
+    static const int objects_per_cacheline = 64/sizeof(float);
+
+    static bool is_aligned(const float * ptr)
+    {
+        return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(float) - 1)) == 0;
+    }
+
+    /* @{ */
+    /** constructors */
+    vec(void)
+    {}
+
+    vec(float f)
+    {
+        set_vec(f);
+    }
+
+    vec(vec const & rhs)
+    {
+        data_ = rhs.data_;
+    }
+    /* @} */
+
+    /* @{ */
+    /** io */
+    void load(const float * data)
+    {
+        data_ = _mm512_loadu_ps(data);
+    }
+
+    void load_aligned(const float * data)
+    {
+        data_ = _mm512_load_ps(data);
+    }
+
+    void load_first(const float * data)
+    {
+        data_ = _mm512_maskz_loadu_ps(1, data);
+    }
+
+    void store(float * dest) const
+    {
+        _mm512_storeu_ps(dest, data_);
+    }
+
+    void store_aligned(float * dest) const
+    {
+        _mm512_store_ps(dest, data_);
+    }
+
+    void store_aligned_stream(float * dest) const
+    {
+        _mm512_stream_ps(dest, data_);
+    }
+
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
+    /* sign-extends sixteen int16 samples, they are not scaled */
+    void load_int16(const int16_t * src)
+    {
+        data_ = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)src)));
+    }
+
+    void load_fp16(const uint16_t * src)
+    {
+        data_ = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)src));
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        _mm256_storeu_si256((__m256i*)dest, _mm512_cvtps_ph(data_, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+    void load_bf16(const uint16_t * src)
+    {
+        const __m512i bits = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)src));
+        data_ = _mm512_castsi512_ps(_mm512_slli_epi32(bits, 16));
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        const __m512i bits = _mm512_castps_si512(data_);
+        const __m512i mantissa_odd = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+        const __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(mantissa_odd, _mm512_set1_epi32(0x7fff)));
+        const __mmask16 is_nan = _mm512_cmp_ps_mask(data_, data_, _CMP_UNORD_Q);
+        const __m512i result = _mm512_mask_or_epi32(rounded, is_nan, bits, _mm512_set1_epi32(0x400000));
+        _mm256_storeu_si256((__m256i*)dest, _mm512_cvtepi32_epi16(_mm512_srli_epi32(result, 16)));
+    }
+
+    void clear(void)
+    {
+        data_ = gen_zero();
+    }
+
+    operator __m512(void) const
+    {
+        return data_;
+    }
+
+    /* @} */
+
+    /* @{ */
+    /** element access */
+    void set_vec (float value)
+    {
+        data_ = _mm512_set1_ps(value);
+    }
+
+    float set_slope(float start, float slope)
+    {
+        float values[size];
+        values[0] = start;
+        for (int i = 1; i != size; ++i)
+            values[i] = values[i-1] + slope;
+        data_ = _mm512_loadu_ps(values);
+        return slope * size;
+    }
+
+    float set_exp(float start, float curve)
+    {
+        float values[size];
+        values[0] = start;
+        for (int i = 1; i != size; ++i)
+            values[i] = values[i-1] * curve;
+        data_ = _mm512_loadu_ps(values);
+        return values[size-1] * curve;
+    }
+    /* @} */
+
+    /* @{ */
+    /** arithmetic operators */
+#define OPERATOR_ASSIGNMENT(op, opcode) \
+    vec & operator op(vec const & rhs) \
+    { \
+        data_ = opcode(data_, rhs.data_);\
+        return *this;\
+    }
+
+    OPERATOR_ASSIGNMENT(+=, _mm512_add_ps)
+    OPERATOR_ASSIGNMENT(-=, _mm512_sub_ps)
+    OPERATOR_ASSIGNMENT(*=, _mm512_mul_ps)
+    OPERATOR_ASSIGNMENT(/=, _mm512_div_ps)
+
+#undef OPERATOR_ASSIGNMENT
+
+#define ARITHMETIC_OPERATOR(op, opcode) \
+    vec operator op(vec const & rhs) const \
+    { \
+        return opcode(data_, rhs.data_); \
+    } \
+ \
+    friend vec operator op(vec const & lhs, float f)  \
+    { \
+        return opcode(lhs.data_, vec(f).data_); \
+    } \
+    \
+    friend vec operator op(float f, vec const & rhs)  \
+    { \
+        return opcode(vec(f).data_, rhs.data_); \
+    }
+
+    ARITHMETIC_OPERATOR(+, _mm512_add_ps)
+    ARITHMETIC_OPERATOR(-, _mm512_sub_ps)
+    ARITHMETIC_OPERATOR(*, _mm512_mul_ps)
+    ARITHMETIC_OPERATOR(/, _mm512_div_ps)
+
+#undef ARITHMETIC_OPERATOR
+
+    friend vec operator -(const vec & arg)
+    {
+        return bitwise_xor(arg.data_, gen_sign_mask());
+    }
+
+    friend vec fast_reciprocal(const vec & arg)
+    {
+        return _mm512_rcp14_ps(arg.data_);
+    }
+
+    friend vec reciprocal(const vec & arg)
+    {
+        return detail::vec_reciprocal_newton(arg);
+    }
+
+    inline friend vec madd(vec const & arg1, vec const & arg2, vec const & arg3)
+    {
+        return _mm512_fmadd_ps(arg1.data_, arg2.data_, arg3.data_);
+    }
+
+#define RELATIONAL_OPERATOR(op, RELATION) \
+    vec operator op(vec const & rhs) const \
+    { \
+        const __m512 one = gen_one(); \
+        return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(data_, rhs.data_, RELATION), one); \
+    }
+
+    RELATIONAL_OPERATOR(<, _CMP_LT_OS)
+    RELATIONAL_OPERATOR(<=, _CMP_LE_OS)
+    RELATIONAL_OPERATOR(>, _CMP_NLE_US)
+    RELATIONAL_OPERATOR(>=, _CMP_NLT_US)
+    RELATIONAL_OPERATOR(==, _CMP_EQ_OQ)
+    RELATIONAL_OPERATOR(!=, _CMP_NEQ_UQ)
+#undef RELATIONAL_OPERATOR
+
+    /* @{ */
+#define BITWISE_OPERATOR(op, opcode) \
+    vec operator op(vec const & rhs) const \
+    { \
+        return opcode(data_, rhs.data_); \
+    }
+
+    BITWISE_OPERATOR(&, bitwise_and)
+    BITWISE_OPERATOR(|, bitwise_or)
+    BITWISE_OPERATOR(^, bitwise_xor)
+
+#undef BITWISE_OPERATOR
+
+    friend inline vec andnot(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(lhs.data_),
+                                                       _mm512_castps_si512(rhs.data_)));
+    }
+
+#define RELATIONAL_MASK_OPERATOR(op, RELATION) \
+    friend vec mask_##op(vec const & lhs, vec const & rhs) \
+    { \
+        return expand_mask(_mm512_cmp_ps_mask(lhs.data_, rhs.data_, RELATION)); \
+    }
+
+    RELATIONAL_MASK_OPERATOR(lt, _CMP_LT_OS)
+    RELATIONAL_MASK_OPERATOR(le, _CMP_LE_OS)
+    RELATIONAL_MASK_OPERATOR(gt, _CMP_NLE_US)
+    RELATIONAL_MASK_OPERATOR(ge, _CMP_NLT_US)
+    RELATIONAL_MASK_OPERATOR(eq, _CMP_EQ_OQ)
+    RELATIONAL_MASK_OPERATOR(neq, _CMP_NEQ_UQ)
+
+#undef RELATIONAL_MASK_OPERATOR
+
+    friend inline vec select(vec lhs, vec rhs, vec bitmask)
+    {
+        /* if bitmask is set, return value in rhs, else value in lhs */
+        return _mm512_mask_blend_ps(compress_mask(bitmask.data_), lhs.data_, rhs.data_);
+    }
+
+    /* @} */
+
+    /* @{ */
+    /** unary functions */
+    friend inline vec abs(vec const & arg)
+    {
+        return bitwise_and(gen_abs_mask(), arg.data_);
+    }
+
+    friend always_inline vec sign(vec const & arg)
+    {
+        return detail::vec_sign(arg);
+    }
+
+    friend inline vec square(vec const & arg)
+    {
+        return _mm512_mul_ps(arg.data_, arg.data_);
+    }
+
+    friend inline vec sqrt(vec const & arg)
+    {
+        return _mm512_sqrt_ps(arg.data_);
+    }
+
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return _mm512_rsqrt14_ps(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return detail::vec_rsqrt_newton<NOVA_SIMD_RSQRT_NEWTON_STEPS>(arg);
+    }
+
+    friend inline vec cube(vec const & arg)
+    {
+        return arg * arg * arg;
+    }
+    /* @} */
+
+    /* @{ */
+    /** binary functions */
+    friend inline vec max_(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_max_ps(lhs.data_, rhs.data_);
+    }
+
+    friend inline vec min_(vec const & lhs, vec const & rhs)
+    {
+        return _mm512_min_ps(lhs.data_, rhs.data_);
+    }
+    /* @} */
+
+    /* @{ */
+    /** rounding functions */
+    friend inline vec round(vec const & arg)
+    {
+        return _mm512_roundscale_ps(arg.data_, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec frac(vec const & arg)
+    {
+        vec floor_result = floor(arg);
+        return arg - floor_result;
+    }
+
+    friend inline vec floor(vec const & arg)
+    {
+        return _mm512_roundscale_ps(arg.data_, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec ceil(vec const & arg)
+    {
+        return _mm512_roundscale_ps(arg.data_, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    }
+
+    friend inline vec trunc(vec const & arg)
+    {
+        return _mm512_roundscale_ps(arg.data_, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    }
+    /* @} */
+
+
+    /* @{ */
+    /** mathematical functions */
+    friend inline vec exp(vec const & arg)
+    {
+        return detail::vec_exp_float(arg);
+    }
+
+    friend inline vec log(vec const & arg)
+    {
+        return detail::vec_log_float(arg);
+    }
+
+    friend inline vec pow(vec const & arg1, vec const & arg2)
+    {
+        return detail::vec_pow(arg1, arg2);
+    }
+
+    friend inline vec sin(vec const & arg)
+    {
+        return detail::vec_sin_float(arg);
+    }
+
+    friend inline vec cos(vec const & arg)
+    {
+        return detail::vec_cos_float(arg);
+    }
+
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_float(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(float)
+
+    friend inline vec tan(vec const & arg)
+    {
+        return detail::vec_tan_float(arg);
+    }
+
+    friend inline vec asin(vec const & arg)
+    {
+        return detail::vec_asin_float(arg);
+    }
+
+    friend inline vec acos(vec const & arg)
+    {
+        return detail::vec_acos_float(arg);
+    }
+
+    friend inline vec atan(vec const & arg)
+    {
+        return detail::vec_atan_float(arg);
+    }
+
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
+    friend inline vec tanh(vec const & arg)
+    {
+        return detail::vec_tanh_float(arg);
+    }
+
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
+    friend inline vec signed_pow(vec const & lhs, vec const & rhs)
+    {
+        return detail::vec_signed_pow(lhs, rhs);
+    }
+
+    friend inline vec signed_sqrt(vec const & arg)
+    {
+        return detail::vec_signed_sqrt(arg);
+    }
+
+    friend inline vec log2(vec const & arg)
+    {
+        return detail::vec_log2_float(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_float(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_float(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
+    }
+
+    friend inline vec log10(vec const & arg)
+    {
+        return detail::vec_log10(arg);
+    }
+
+    friend inline vec undenormalize(vec const & arg)
+    {
+        return detail::vec_undenormalize(arg);
+    }
+    /* @} */
+
+    /* @{ */
+    /** horizontal functions */
+    inline float horizontal_min(void) const
+    {
+        return _mm512_reduce_min_ps(data_);
+    }
+
+    inline float horizontal_max(void) const
+    {
+        return _mm512_reduce_max_ps(data_);
+    }
+
+    inline float horizontal_sum(void) const
+    {
+        return _mm512_reduce_add_ps(data_);
+    }
+    /* @} */
+
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* indices 16 to 31 select from rhs */
+        const __m512i low_index  = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+        const __m512i high_index = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+        low  = _mm512_permutex2var_ps(lhs.data_, low_index, rhs.data_);
+        high = _mm512_permutex2var_ps(lhs.data_, high_index, rhs.data_);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const __m512i even_index = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        const __m512i odd_index  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+        even = _mm512_permutex2var_ps(lhs.data_, even_index, rhs.data_);
+        odd  = _mm512_permutex2var_ps(lhs.data_, odd_index, rhs.data_);
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        /* log2(size) rounds of zipping row i with row i + size/2 */
+        for (int round = 0; round != 4; ++round) {
+            vec zipped[16];
+            for (int i = 0; i != 8; ++i)
+                interleave(rows[i], rows[i + 8], zipped[2*i], zipped[2*i + 1]);
+
+            for (int i = 0; i != 16; ++i)
+                rows[i] = zipped[i];
+        }
+    }
+
+    static inline void transpose_4x4(float * dest, unsigned int dest_stride, const float * src, unsigned int src_stride)
+    {
+        detail::transpose_block_4x4(dest, dest_stride, src, src_stride);
+    }
+
+    static inline void transpose_8x8(float * dest, unsigned int dest_stride, const float * src, unsigned int src_stride)
+    {
+        detail::transpose_block_8x8(dest, dest_stride, src, src_stride);
+    }
+    /* @} */
+
+    /* @{ */
+    typedef nova::detail::int_vec_avx512 int_vec;
+
+    vec (int_vec const & rhs):
+        base(_mm512_castsi512_ps(rhs.data_))
+    {}
+
+    int_vec truncate_to_int(void) const
+    {
+        __m512i int_val = _mm512_cvttps_epi32(data_);
+        return int_vec(int_val);
+    }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const float * base, int_vec const & index)
+    {
+        return _mm512_i32gather_ps(index.data_, base, 4);
+    }
+    /* @} */
+};
+
+} /* namespace nova */
+
+
+#undef always_inline
+
+#endif /* VEC_AVX512_FLOAT_HPP */
@@ -26,6 +26,8 @@
 
 #include "../detail/vec_math.hpp"
 #include "vec_base.hpp"
+#include "vec_int_avx.hpp"
+#include "vec_transpose_avx.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -71,6 +73,16 @@ public:
         return _mm256_set1_pd(u.d);
     }
 
+    static inline __m256d gen_exp_mask(void)
+    {
+        return set_bitmask(0x7FF0000000000000);
+    }
+
+    static inline __m256d gen_exp_mask_1(void)
+    {
+        return set_bitmask(0x3FE0000000000000);
+    }
+
     static inline __m256d gen_one(void)
     {
         return _mm256_set1_pd(1.f);
@@ -101,7 +113,7 @@ public:
     static const int size = 4;
     static const int objects_per_cacheline = 64/sizeof(double);
 
-    static bool is_aligned(double* ptr)
+    static bool is_aligned(const double * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(double) - 1)) == 0;
     }
@@ -160,6 +172,12 @@ public:
         _mm256_stream_pd(dest, data_);
     }
 
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
     void clear(void)
     {
         data_ = gen_zero();
@@ -264,6 +282,11 @@ public:
 
 #undef BITWISE_OPERATOR
 
+    friend inline vec andnot(vec const & lhs, vec const & rhs)
+    {
+        return _mm256_andnot_pd(lhs.data_, rhs.data_);
+    }
+
 #define RELATIONAL_MASK_OPERATOR(op, RELATION) \
     friend vec mask_##op(vec const & lhs, vec const & rhs) \
     { \
@@ -309,6 +332,17 @@ public:
         return _mm256_sqrt_pd(arg.data_);
     }
 
+    /* there is no estimate instruction for double precision */
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return vec(1.0) / sqrt(arg);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return fast_rsqrt(arg);
+    }
+
     friend inline vec cube(vec const & arg)
     {
         return _mm256_mul_pd(arg.data_, _mm256_mul_pd(arg.data_, arg.data_));
@@ -360,23 +394,144 @@ public:
 
     /* @{ */
     /** mathematical functions */
-    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
-    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    typedef nova::detail::int64_vec_avx int_vec;
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    friend inline vec exp(vec const & arg)
+    {
+        return detail::vec_exp_double(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
+    friend inline vec log(vec const & arg)
+    {
+        return detail::vec_log_double(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acos)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
+    friend inline vec pow(vec const & arg1, vec const & arg2)
+    {
+        return detail::vec_pow(arg1, arg2);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
+    friend inline vec sin(vec const & arg)
+    {
+        return detail::vec_sin_double(arg);
+    }
+
+    friend inline vec cos(vec const & arg)
+    {
+        return detail::vec_cos_double(arg);
+    }
+
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_double(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(double)
+
+    friend inline vec tan(vec const & arg)
+    {
+        return detail::vec_tan_double(arg);
+    }
+
+    friend inline vec asin(vec const & arg)
+    {
+        return detail::vec_asin_double(arg);
+    }
+
+    friend inline vec acos(vec const & arg)
+    {
+        return detail::vec_acos_double(arg);
+    }
+
+    friend inline vec atan(vec const & arg)
+    {
+        return detail::vec_atan_double(arg);
+    }
+
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
+    friend inline vec tanh(vec const & arg)
+    {
+        return detail::vec_tanh_double(arg);
+    }
+
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
+    friend inline vec signed_pow(vec const & lhs, vec const & rhs)
+    {
+        return detail::vec_signed_pow(lhs, rhs);
+    }
+
+    friend inline vec log2(vec const & arg)
+    {
+        return detail::vec_log2_double(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_double(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_double(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
+    }
+
+    friend inline vec log10(vec const & arg)
+    {
+        return detail::vec_log10(arg);
+    }
 
     friend inline vec signed_sqrt(vec const & arg)
     {
@@ -387,6 +542,63 @@ public:
         return detail::vec_undenormalize(arg);
     }
     /* @} */
+
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* unpack works on 128bit lanes, the permutation puts the lanes in order */
+        const __m256d lo_lanes = _mm256_unpacklo_pd(lhs.data_, rhs.data_);
+        const __m256d hi_lanes = _mm256_unpackhi_pd(lhs.data_, rhs.data_);
+        low  = _mm256_permute2f128_pd(lo_lanes, hi_lanes, 0x20);
+        high = _mm256_permute2f128_pd(lo_lanes, hi_lanes, 0x31);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const __m256d lo_lanes = _mm256_permute2f128_pd(lhs.data_, rhs.data_, 0x20);
+        const __m256d hi_lanes = _mm256_permute2f128_pd(lhs.data_, rhs.data_, 0x31);
+        even = _mm256_unpacklo_pd(lo_lanes, hi_lanes);
+        odd  = _mm256_unpackhi_pd(lo_lanes, hi_lanes);
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        __m256d data[4];
+        for (int i = 0; i != 4; ++i)
+            data[i] = rows[i].data_;
+
+        detail::transpose_4x4(data);
+
+        for (int i = 0; i != 4; ++i)
+            rows[i] = data[i];
+    }
+    /* @} */
+
+    /* @{ */
+    vec (int_vec const & rhs):
+        base(_mm256_castsi256_pd(rhs.data_))
+    {}
+
+    int_vec truncate_to_int(void) const
+    {
+        __m128i int_val = _mm256_cvttpd_epi32(data_);
+        return int_vec::from_int32(int_val);
+    }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const double * base, int_vec const & index)
+    {
+#ifdef __AVX2__
+        return _mm256_i64gather_pd(base, index.data_, 8);
+#else
+        const __m128i low  = _mm256_castsi256_si128(index.data_);
+        const __m128i high = _mm256_extractf128_si256(index.data_, 1);
+        return _mm256_set_pd(base[_mm_extract_epi32(high, 2)], base[_mm_cvtsi128_si32(high)],
+                             base[_mm_extract_epi32(low, 2)],  base[_mm_cvtsi128_si32(low)]);
+#endif
+    }
+    /* @} */
 };
 
 } /* namespace nova */
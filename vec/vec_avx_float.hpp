@@ -23,6 +23,8 @@
 #include <immintrin.h>
 
 #include "../detail/vec_math.hpp"
+#include "vec_half_sse2.hpp"
+#include "vec_transpose_avx.hpp"
 #include <numeric>
 
 #if defined(__GNUC__) && defined(NDEBUG)
@@ -112,7 +114,7 @@ public:
     static const int size = 8;
     static const int objects_per_cacheline = 64/sizeof(float);
 
-    static bool is_aligned(float* ptr)
+    static bool is_aligned(const float * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(float) - 1)) == 0;
     }
@@ -166,6 +168,93 @@ public:
         _mm256_stream_ps(dest, data_);
     }
 
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
+    /* sign-extends eight int16 samples, they are not scaled */
+#ifdef __AVX2__
+    void load_int16(const int16_t * src)
+    {
+        data_ = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)src)));
+    }
+#else
+    void load_int16(const int16_t * src)
+    {
+        const __m128i samples = _mm_loadu_si128((const __m128i*)src);
+        const __m128i low  = _mm_cvtepi16_epi32(samples);
+        const __m128i high = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(samples, samples));
+        data_ = _mm256_cvtepi32_ps(_mm256_insertf128_si256(_mm256_castsi128_si256(low), high, 1));
+    }
+#endif
+
+#ifdef __F16C__
+    void load_fp16(const uint16_t * src)
+    {
+        data_ = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)src));
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        _mm_storeu_si128((__m128i*)dest, _mm256_cvtps_ph(data_, _MM_FROUND_TO_NEAREST_INT));
+    }
+#else
+    void load_fp16(const uint16_t * src)
+    {
+        const __m128i halves = _mm_loadu_si128((const __m128i*)src);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 low  = detail::fp16_to_float_sse2(_mm_unpacklo_epi16(halves, zero));
+        const __m128 high = detail::fp16_to_float_sse2(_mm_unpackhi_epi16(halves, zero));
+        data_ = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        const __m128i low  = detail::float_to_fp16_sse2(_mm256_castps256_ps128(data_));
+        const __m128i high = detail::float_to_fp16_sse2(_mm256_extractf128_ps(data_, 1));
+        _mm_storeu_si128((__m128i*)dest, _mm_packs_epi32(low, high));
+    }
+#endif
+
+#ifdef __AVX2__
+    void load_bf16(const uint16_t * src)
+    {
+        const __m256i halves = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)src));
+        data_ = _mm256_castsi256_ps(_mm256_slli_epi32(halves, 16));
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        const __m256i bits = _mm256_castps_si256(data_);
+        const __m256i mantissa_odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+        const __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(mantissa_odd, _mm256_set1_epi32(0x7fff)));
+        const __m256i quiet_nan = _mm256_or_si256(bits, _mm256_set1_epi32(0x400000));
+        const __m256i is_nan = _mm256_castps_si256(_mm256_cmp_ps(data_, data_, _CMP_UNORD_Q));
+        const __m256i halves = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quiet_nan, is_nan), 16);
+        _mm_storeu_si128((__m128i*)dest, _mm_packus_epi32(_mm256_castsi256_si128(halves),
+                                                          _mm256_extracti128_si256(halves, 1)));
+    }
+#else
+    /* without avx2, integer operations are only available on 128bit registers */
+    void load_bf16(const uint16_t * src)
+    {
+        const __m128i halves = _mm_loadu_si128((const __m128i*)src);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128 low  = detail::bf16_to_float_sse2(_mm_unpacklo_epi16(halves, zero));
+        const __m128 high = detail::bf16_to_float_sse2(_mm_unpackhi_epi16(halves, zero));
+        data_ = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        const __m128i low  = detail::float_to_bf16_sse2(_mm256_castps256_ps128(data_));
+        const __m128i high = detail::float_to_bf16_sse2(_mm256_extractf128_ps(data_, 1));
+        _mm_storeu_si128((__m128i*)dest, _mm_packs_epi32(low, high));
+    }
+#endif
+
     void clear(void)
     {
         data_ = gen_zero();
@@ -353,6 +442,16 @@ public:
         return _mm256_sqrt_ps(arg.data_);
     }
 
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return _mm256_rsqrt_ps(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return detail::vec_rsqrt_newton<NOVA_SIMD_RSQRT_NEWTON_STEPS>(arg);
+    }
+
     friend inline vec cube(vec const & arg)
     {
         return arg * arg * arg;
@@ -429,6 +528,13 @@ public:
         return detail::vec_cos_float(arg);
     }
 
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_float(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(float)
+
     friend inline vec tan(vec const & arg)
     {
         return detail::vec_tan_float(arg);
@@ -449,11 +555,56 @@ public:
         return detail::vec_atan_float(arg);
     }
 
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
     friend inline vec tanh(vec const & arg)
     {
         return detail::vec_tanh_float(arg);
     }
 
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
     friend inline vec signed_pow(vec const & lhs, vec const & rhs)
     {
         return detail::vec_signed_pow(lhs, rhs);
@@ -466,7 +617,27 @@ public:
 
     friend inline vec log2(vec const & arg)
     {
-        return detail::vec_log2(arg);
+        return detail::vec_log2_float(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_float(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_float(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
     }
 
     friend inline vec log10(vec const & arg)
@@ -480,6 +651,43 @@ public:
     }
     /* @} */
 
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        /* unpack works on 128bit lanes, the permutation puts the lanes in order */
+        const __m256 lo_lanes = _mm256_unpacklo_ps(lhs.data_, rhs.data_);
+        const __m256 hi_lanes = _mm256_unpackhi_ps(lhs.data_, rhs.data_);
+        low  = _mm256_permute2f128_ps(lo_lanes, hi_lanes, 0x20);
+        high = _mm256_permute2f128_ps(lo_lanes, hi_lanes, 0x31);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const __m256 lo_lanes = _mm256_permute2f128_ps(lhs.data_, rhs.data_, 0x20);
+        const __m256 hi_lanes = _mm256_permute2f128_ps(lhs.data_, rhs.data_, 0x31);
+        even = _mm256_shuffle_ps(lo_lanes, hi_lanes, _MM_SHUFFLE(2, 0, 2, 0));
+        odd  = _mm256_shuffle_ps(lo_lanes, hi_lanes, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        __m256 data[8];
+        for (int i = 0; i != 8; ++i)
+            data[i] = rows[i].data_;
+
+        detail::transpose_8x8(data);
+
+        for (int i = 0; i != 8; ++i)
+            rows[i] = data[i];
+    }
+
+    static inline void transpose_4x4(float * dest, unsigned int dest_stride, const float * src, unsigned int src_stride)
+    {
+        detail::transpose_block_4x4(dest, dest_stride, src, src_stride);
+    }
+    /* @} */
+
     /* @{ */
     typedef nova::detail::int_vec_avx int_vec;
 
@@ -492,6 +700,21 @@ public:
         __m256i int_val = _mm256_cvttps_epi32(data_);
         return int_vec(int_val);
     }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const float * base, int_vec const & index)
+    {
+#ifdef __AVX2__
+        return _mm256_i32gather_ps(base, index.data_, 4);
+#else
+        const __m128i low  = _mm256_castsi256_si128(index.data_);
+        const __m128i high = _mm256_extractf128_si256(index.data_, 1);
+        return _mm256_set_ps(base[_mm_extract_epi32(high, 3)], base[_mm_extract_epi32(high, 2)],
+                             base[_mm_extract_epi32(high, 1)], base[_mm_cvtsi128_si32(high)],
+                             base[_mm_extract_epi32(low, 3)],  base[_mm_extract_epi32(low, 2)],
+                             base[_mm_extract_epi32(low, 1)],  base[_mm_cvtsi128_si32(low)]);
+#endif
+    }
     /* @} */
 };
 
@@ -25,6 +25,7 @@
 #include <cstring>
 
 #include "../detail/math.hpp"
+#include "../detail/half_float.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -116,6 +117,50 @@ public:
         store(dest);
     }
 
+    static void stream_fence(void)
+    {}
+
+    /* half precision storage, see detail/half_float.hpp */
+    void load_fp16(const uint16_t * src)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i)
+            u.f[i] = WrappedType(detail::fp16_to_float(src[i]));
+        data_ = u.vec;
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        cast_unit u;
+        u.vec = data_;
+        for (int i = 0; i != size; ++i)
+            dest[i] = detail::float_to_fp16(float(u.f[i]));
+    }
+
+    void load_bf16(const uint16_t * src)
+    {
+        cast_unit u;
+        for (int i = 0; i != size; ++i)
+            u.f[i] = WrappedType(detail::bf16_to_float(src[i]));
+        data_ = u.vec;
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        cast_unit u;
+        u.vec = data_;
+        for (int i = 0; i != size; ++i)
+            dest[i] = detail::float_to_bf16(float(u.f[i]));
+    }
+
+    /* hint to load the cache line containing address */
+    static always_inline void prefetch(const WrappedType * address)
+    {
+#ifdef __GNUC__
+        __builtin_prefetch(address);
+#endif
+    }
+
     void clear(void)
     {
         set_vec(0);
@@ -201,6 +246,20 @@ private:
         return ret.vec;
     }
 
+    template <typename Functor>
+    static always_inline VecType apply_ternary(VecType const & arg1, VecType const & arg2, VecType const & arg3,
+                                               Functor const & f)
+    {
+        cast_unit a1, a2, a3, ret;
+        a1.vec = arg1;
+        a2.vec = arg2;
+        a3.vec = arg3;
+
+        for (int i = 0; i != VecSize; ++i)
+            ret.f[i] = f(a1.f[i], a2.f[i], a3.f[i]);
+        return ret.vec;
+    }
+
 public:
     vec_base operator+(vec_base const & rhs) const
     {
@@ -282,6 +341,12 @@ public:
        return apply_unary(arg, METHOD<WrappedType>);        \
     }
 
+#define DEFINE_TERNARY_STATIC(NAME, METHOD)                                                         \
+    static always_inline VecType NAME(VecType const & arg1, VecType const & arg2, VecType const & arg3) \
+    {                                                                                               \
+       return apply_ternary(arg1, arg2, arg3, METHOD<WrappedType>);                                 \
+    }
+
 #define DEFINE_BINARY_STATIC(NAME, METHOD)                                          \
     static always_inline VecType NAME(VecType const & arg1, VecType const & arg2)   \
     {                                                                               \
@@ -301,11 +366,26 @@ protected:
     DEFINE_UNARY_STATIC(atan, detail::atan)
 
     DEFINE_UNARY_STATIC(tanh, detail::tanh)
+    DEFINE_UNARY_STATIC(sinh, detail::sinh)
+    DEFINE_UNARY_STATIC(cosh, detail::cosh)
+    DEFINE_UNARY_STATIC(asinh, detail::asinh)
+    DEFINE_UNARY_STATIC(acosh, detail::acosh)
+    DEFINE_UNARY_STATIC(atanh, detail::atanh)
+
+    DEFINE_UNARY_STATIC(erf, detail::erf)
+    DEFINE_UNARY_STATIC(erfc, detail::erfc)
 
     DEFINE_UNARY_STATIC(log, detail::log)
     DEFINE_UNARY_STATIC(log2, detail::log2)
     DEFINE_UNARY_STATIC(log10, detail::log10)
     DEFINE_UNARY_STATIC(exp, detail::exp)
+    DEFINE_UNARY_STATIC(exp2, detail::exp2)
+    DEFINE_UNARY_STATIC(expm1, detail::expm1)
+    DEFINE_UNARY_STATIC(log1p, detail::log1p)
+    DEFINE_UNARY_STATIC(sqrt, detail::sqrt)
+    DEFINE_UNARY_STATIC(rsqrt, detail::rsqrt)
+    DEFINE_UNARY_STATIC(fast_rsqrt, detail::fast_rsqrt)
+    DEFINE_UNARY_STATIC(cbrt, detail::cbrt)
     DEFINE_UNARY_STATIC(signed_sqrt, detail::signed_sqrt)
 
     DEFINE_UNARY_STATIC(round, detail::round)
@@ -316,6 +396,8 @@ protected:
 
     DEFINE_BINARY_STATIC(pow, detail::pow)
     DEFINE_BINARY_STATIC(signed_pow, detail::signed_pow)
+    DEFINE_BINARY_STATIC(atan2, detail::atan2)
+    DEFINE_BINARY_STATIC(hypot, detail::hypot)
 
     DEFINE_UNARY_STATIC(abs, detail::fabs)
     DEFINE_UNARY_STATIC(sign, detail::sign)
@@ -325,6 +407,8 @@ protected:
     DEFINE_BINARY_STATIC(max_, detail::max)
     DEFINE_BINARY_STATIC(min_, detail::min)
 
+    DEFINE_TERNARY_STATIC(madd, detail::madd)
+
     DEFINE_UNARY_STATIC(undenormalize, detail::undenormalize)
 
 public:
@@ -385,6 +469,43 @@ protected:
         return base::NAME(arg1.data_, arg2.data_);               \
     }
 
+#define NOVA_SIMD_DELEGATE_TERNARY_TO_BASE(NAME)                                \
+    inline friend vec NAME(vec const & arg1, vec const & arg2, vec const & arg3)  \
+    {                                                                           \
+        return base::NAME(arg1.data_, arg2.data_, arg3.data_);                  \
+    }
+
+#define NOVA_SIMD_DELEGATE_SINCOS_TO_BASE                                         \
+    inline friend void sincos(vec const & arg, vec & sin_result, vec & cos_result) \
+    {                                                                           \
+        sin_result = base::sin(arg.data_);                                      \
+        cos_result = base::cos(arg.data_);                                      \
+    }
+
+/* fast and precise tiers of the math functions, TYPE selects the float or double kernels. backends
+ * without these overloads fall back to the standard tier */
+#define NOVA_SIMD_DEFINE_ACCURACY_TIERS(TYPE)                                                   \
+    inline friend vec exp(vec const & arg, accuracy::fast)      { return detail::vec_exp_fast(arg); }  \
+    inline friend vec log(vec const & arg, accuracy::fast)      { return detail::vec_log_fast(arg); }  \
+    inline friend vec sin(vec const & arg, accuracy::fast)      { return detail::vec_sin_fast(arg); }  \
+    inline friend vec cos(vec const & arg, accuracy::fast)      { return detail::vec_cos_fast(arg); }  \
+    inline friend vec tanh(vec const & arg, accuracy::fast)     { return detail::vec_tanh_fast(arg); } \
+    inline friend vec pow(vec const & arg1, vec const & arg2, accuracy::fast)                   \
+    {                                                                                           \
+        return detail::vec_pow_fast(arg1, arg2);                                                \
+    }                                                                                           \
+                                                                                                \
+    inline friend vec exp(vec const & arg, accuracy::precise)   { return detail::vec_exp_##TYPE##_precise(arg); }  \
+    inline friend vec log(vec const & arg, accuracy::precise)   { return detail::vec_log_##TYPE##_precise(arg); }  \
+    inline friend vec sin(vec const & arg, accuracy::precise)   { return detail::vec_sin_##TYPE##_precise(arg); }  \
+    inline friend vec cos(vec const & arg, accuracy::precise)   { return detail::vec_cos_##TYPE##_precise(arg); }  \
+    inline friend vec tanh(vec const & arg, accuracy::precise)  { return detail::vec_tanh_##TYPE##_precise(arg); } \
+    inline friend vec pow(vec const & arg1, vec const & arg2, accuracy::precise)                \
+    {                                                                                           \
+        return detail::vec_pow_##TYPE##_precise(arg1, arg2);                                    \
+    }
+
+/* madd(a, b, c) = a * b + c. backends with fused multiply-add instructions provide their own version */
 #define NOVA_SIMD_DEFINE_MADD                                   \
     inline friend vec madd(vec const & arg1, vec const & arg2, vec const & arg3)  \
     {                                                           \
@@ -102,7 +102,7 @@ public:
         base(arg)
     {}
 
-    static bool is_aligned(FloatType * ptr)
+    static bool is_aligned(const FloatType * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(sizeof(float) - 1)) == 0;
     }
@@ -149,7 +149,7 @@ public:
     /* @} */
 
     /* @{ */
-    NOVA_SIMD_DEFINE_MADD
+    NOVA_SIMD_DELEGATE_TERNARY_TO_BASE(madd)
 
     friend inline vec select(vec lhs, vec rhs, vec bitmask)
     {
@@ -161,9 +161,51 @@ public:
         return ret;
     }
 
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec lhs, vec rhs, vec & low, vec & high)
+    {
+        for (int i = 0; i != size / 2; ++i) {
+            low.data_[2*i]      = lhs.data_[i];
+            low.data_[2*i + 1]  = rhs.data_[i];
+            high.data_[2*i]     = lhs.data_[size/2 + i];
+            high.data_[2*i + 1] = rhs.data_[size/2 + i];
+        }
+    }
+
+    friend inline void deinterleave(vec lhs, vec rhs, vec & even, vec & odd)
+    {
+        for (int i = 0; i != size / 2; ++i) {
+            even.data_[i]          = lhs.data_[2*i];
+            even.data_[size/2 + i] = rhs.data_[2*i];
+            odd.data_[i]           = lhs.data_[2*i + 1];
+            odd.data_[size/2 + i]  = rhs.data_[2*i + 1];
+        }
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        for (int i = 0; i != size; ++i)
+            for (int j = i + 1; j != size; ++j)
+                std::swap(rows[i].data_[j], rows[j].data_[i]);
+    }
+    /* @} */
+
+    /* lane i is loaded from base[index[i]]. there is no int_vec, the indices are passed as array */
+    static vec gather(const FloatType * base, const int * index)
+    {
+        vec ret;
+        for (int i = 0; i != size; ++i)
+            ret.data_[i] = base[index[i]];
+        return ret;
+    }
+
+
     /** mathematical functions */
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(atan2)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(hypot)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(reciprocal)
 
@@ -171,9 +213,13 @@ public:
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp2)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(expm1)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log1p)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
+    NOVA_SIMD_DELEGATE_SINCOS_TO_BASE
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
@@ -181,7 +227,19 @@ public:
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
-
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atanh)
+
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erf)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erfc)
+
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sqrt)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(rsqrt)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(fast_rsqrt)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cbrt)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(signed_sqrt)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(undenormalize)
     /* @} */
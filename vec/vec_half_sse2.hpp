@@ -0,0 +1,106 @@
+//  sse2 conversion between single and half precision floats
+//
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef VEC_HALF_SSE2_HPP
+#define VEC_HALF_SSE2_HPP
+
+#include <emmintrin.h>
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* vectorized versions of detail/half_float.hpp for cpus without f16c. the halves are zero extended
+ * to 32bit lanes, the results are sign extended, so that they can be narrowed with _mm_packs_epi32 */
+
+namespace nova {
+namespace detail {
+
+always_inline __m128 fp16_to_float_sse2(__m128i arg)
+{
+    const __m128i shifted_exponent = _mm_set1_epi32(0x7c00 << 13);
+
+    const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(arg, _mm_set1_epi32(0x7fff)), 13);
+    const __m128i exponent = _mm_and_si128(magnitude, shifted_exponent);
+    const __m128i is_special = _mm_cmpeq_epi32(exponent, shifted_exponent);  /* inf / nan */
+    const __m128i is_small = _mm_cmpeq_epi32(exponent, _mm_setzero_si128()); /* zero / subnormal */
+
+    __m128i bits = _mm_add_epi32(magnitude, _mm_set1_epi32((127 - 15) << 23));
+    bits = _mm_add_epi32(bits, _mm_and_si128(is_special, _mm_set1_epi32((128 - 16) << 23)));
+
+    const __m128 renormalized = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))),
+                                           _mm_castsi128_ps(_mm_set1_epi32(113 << 23)));
+    bits = _mm_or_si128(_mm_and_si128(is_small, _mm_castps_si128(renormalized)), _mm_andnot_si128(is_small, bits));
+
+    const __m128i sign = _mm_slli_epi32(_mm_and_si128(arg, _mm_set1_epi32(0x8000)), 16);
+    return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+}
+
+always_inline __m128i float_to_fp16_sse2(__m128 arg)
+{
+    const __m128 sign = _mm_and_ps(arg, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)));
+    const __m128 abs_arg = _mm_xor_ps(arg, sign);
+    const __m128i bits = _mm_castps_si128(abs_arg);
+
+    /* overflow, inf or nan */
+    const __m128i is_regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), bits);
+    const __m128i is_nan = _mm_castps_si128(_mm_cmpunord_ps(abs_arg, abs_arg));
+    const __m128i payload = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(0x3ff));
+    const __m128i nan = _mm_and_si128(is_nan, _mm_or_si128(payload, _mm_set1_epi32(0x200)));
+    const __m128i special = _mm_or_si128(nan, _mm_set1_epi32(0x7c00));
+
+    /* subnormal or zero: adding 0.5 aligns the mantissa, the fpu rounds to nearest even */
+    const __m128i is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), bits);
+    const __m128i magic = _mm_set1_epi32((127 - 1) << 23);
+    const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(abs_arg, _mm_castsi128_ps(magic))), magic);
+
+    const __m128i mantissa_odd = _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1));
+    const __m128i biased = _mm_sub_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+    const __m128i rounded = _mm_add_epi32(biased, _mm_add_epi32(mantissa_odd, _mm_set1_epi32(0xfff)));
+    const __m128i normal = _mm_srli_epi32(rounded, 13);
+
+    const __m128i finite = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+    const __m128i result = _mm_or_si128(_mm_and_si128(is_regular, finite), _mm_andnot_si128(is_regular, special));
+    return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+}
+
+always_inline __m128 bf16_to_float_sse2(__m128i arg)
+{
+    return _mm_castsi128_ps(_mm_slli_epi32(arg, 16));
+}
+
+always_inline __m128i float_to_bf16_sse2(__m128 arg)
+{
+    const __m128i bits = _mm_castps_si128(arg);
+    const __m128i mantissa_odd = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_add_epi32(bits, _mm_add_epi32(mantissa_odd, _mm_set1_epi32(0x7fff)));
+    const __m128i quiet_nan = _mm_or_si128(bits, _mm_set1_epi32(0x400000));
+    const __m128i is_nan = _mm_castps_si128(_mm_cmpunord_ps(arg, arg));
+    const __m128i result = _mm_or_si128(_mm_and_si128(is_nan, quiet_nan), _mm_andnot_si128(is_nan, rounded));
+    return _mm_srai_epi32(result, 16);
+}
+
+}
+}
+
+#undef always_inline
+
+#endif /* VEC_HALF_SSE2_HPP */
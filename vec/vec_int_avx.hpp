@@ -52,6 +52,54 @@ struct int_vec_avx
     int_vec_avx(void)
     {}
 
+#ifdef __AVX2__
+    friend int_vec_avx operator+(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_add_epi32(lhs.data_, rhs.data_);
+    }
+
+    friend int_vec_avx operator-(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_sub_epi32(lhs.data_, rhs.data_);
+    }
+
+    friend inline int_vec_avx mask_lt(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_cmpgt_epi32(rhs.data_, lhs.data_);
+    }
+
+    friend inline int_vec_avx mask_gt(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_cmpgt_epi32(lhs.data_, rhs.data_);
+    }
+
+    friend inline int_vec_avx mask_eq(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_cmpeq_epi32(lhs.data_, rhs.data_);
+    }
+
+    friend int_vec_avx operator&(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_and_si256(lhs.data_, rhs.data_);
+    }
+
+    friend inline int_vec_avx andnot(int_vec_avx const & lhs, int_vec_avx const & rhs)
+    {
+        return _mm256_andnot_si256(lhs.data_, rhs.data_);
+    }
+
+    // shift in zeros
+    friend inline int_vec_avx slli(int_vec_avx const & arg, int count)
+    {
+        return _mm256_slli_epi32(arg.data_, count);
+    }
+
+    // shift in zeros
+    friend inline int_vec_avx srli(int_vec_avx const & arg, int count)
+    {
+        return _mm256_srli_epi32(arg.data_, count);
+    }
+#else
 #define APPLY_SSE_FUNCTION(op, function) \
     friend int_vec_avx op(int_vec_avx const & lhs, int_vec_avx const & rhs) \
     { \
@@ -122,6 +170,7 @@ struct int_vec_avx
         result = _mm256_insertf128_ps(result,  newhi, 1);
         return result;
     }
+#endif
 
     __m256 convert_to_float(void) const
     {
@@ -129,6 +178,160 @@ struct int_vec_avx
     }
 };
 
+/* integer vector with 64bit lanes, used by the double-precision math functions */
+struct int64_vec_avx
+{
+    __m256i data_;
+
+    /* cast */
+    explicit int64_vec_avx(int arg):
+        data_(_mm256_set_epi32(arg >> 31, arg, arg >> 31, arg, arg >> 31, arg, arg >> 31, arg))
+    {}
+
+    int64_vec_avx(__m256i arg):
+        data_(arg)
+    {}
+
+    int64_vec_avx(__m256d arg):
+        data_(_mm256_castpd_si256(arg))
+    {}
+
+    int64_vec_avx(int64_vec_avx const & arg):
+        data_(arg.data_)
+    {}
+
+    int64_vec_avx(void)
+    {}
+
+    static inline int64_vec_avx combine(__m128i low, __m128i high)
+    {
+        __m256i result = _mm256_castsi128_si256(low);
+        return _mm256_insertf128_si256(result, high, 1);
+    }
+
+#ifdef __AVX2__
+    friend int64_vec_avx operator+(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_add_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend int64_vec_avx operator-(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_sub_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend inline int64_vec_avx mask_lt(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_cmpgt_epi64(rhs.data_, lhs.data_);
+    }
+
+    friend inline int64_vec_avx mask_gt(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_cmpgt_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend inline int64_vec_avx mask_eq(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_cmpeq_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend int64_vec_avx operator&(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_and_si256(lhs.data_, rhs.data_);
+    }
+
+    friend inline int64_vec_avx andnot(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return _mm256_andnot_si256(lhs.data_, rhs.data_);
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx slli(int64_vec_avx const & arg, int count)
+    {
+        return _mm256_slli_epi64(arg.data_, count);
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx srli(int64_vec_avx const & arg, int count)
+    {
+        return _mm256_srli_epi64(arg.data_, count);
+    }
+#else
+#define APPLY_SSE_FUNCTION(op, function) \
+    friend int64_vec_avx op(int64_vec_avx const & lhs, int64_vec_avx const & rhs) \
+    { \
+        __m128i lhs_low = _mm256_castsi256_si128(lhs.data_);       \
+        __m128i lhs_hi  = _mm256_extractf128_si256(lhs.data_, 1);  \
+        __m128i rhs_low = _mm256_castsi256_si128(rhs.data_);       \
+        __m128i rhs_hi  = _mm256_extractf128_si256(rhs.data_, 1);  \
+\
+        __m128i newlow = function(int64_vec_sse2(lhs_low), int64_vec_sse2(rhs_low)); \
+        __m128i newhi  = function(int64_vec_sse2(lhs_hi),  int64_vec_sse2(rhs_hi)); \
+\
+        return combine(newlow, newhi); \
+    }
+
+    APPLY_SSE_FUNCTION(operator +, std::plus<int64_vec_sse2>());
+    APPLY_SSE_FUNCTION(operator -, std::minus<int64_vec_sse2>());
+
+    APPLY_SSE_FUNCTION(mask_lt, mask_lt)
+    APPLY_SSE_FUNCTION(mask_gt, mask_gt)
+    APPLY_SSE_FUNCTION(mask_eq, mask_eq)
+
+#undef APPLY_SSE_FUNCTION
+
+    friend int64_vec_avx operator&(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return int64_vec_avx(_mm256_and_pd(_mm256_castsi256_pd(lhs.data_),
+                                           _mm256_castsi256_pd(rhs.data_)));
+    }
+
+    friend inline int64_vec_avx andnot(int64_vec_avx const & lhs, int64_vec_avx const & rhs)
+    {
+        return int64_vec_avx(_mm256_andnot_pd(_mm256_castsi256_pd(lhs.data_),
+                                              _mm256_castsi256_pd(rhs.data_)));
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx slli(int64_vec_avx const & arg, int count)
+    {
+        __m128i arg_low = _mm256_castsi256_si128(arg.data_);
+        __m128i arg_hi  = _mm256_extractf128_si256(arg.data_, 1);
+
+        return combine(_mm_slli_epi64(arg_low, count), _mm_slli_epi64(arg_hi, count));
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx srli(int64_vec_avx const & arg, int count)
+    {
+        __m128i arg_low = _mm256_castsi256_si128(arg.data_);
+        __m128i arg_hi  = _mm256_extractf128_si256(arg.data_, 1);
+
+        return combine(_mm_srli_epi64(arg_low, count), _mm_srli_epi64(arg_hi, count));
+    }
+#endif
+
+    /* only the lower 32bit of each lane are converted */
+    __m256d convert_to_float(void) const
+    {
+        __m128 low = _mm_castsi128_ps(_mm256_castsi256_si128(data_));
+        __m128 hi  = _mm_castsi128_ps(_mm256_extractf128_si256(data_, 1));
+        __m128 packed = _mm_shuffle_ps(low, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        return _mm256_cvtepi32_pd(_mm_castps_si128(packed));
+    }
+
+    /* sign-extend four 32bit lanes */
+    static inline int64_vec_avx from_int32(__m128i arg)
+    {
+#ifdef __AVX2__
+        return _mm256_cvtepi32_epi64(arg);
+#else
+        return combine(_mm_cvtepi32_epi64(arg),
+                       _mm_cvtepi32_epi64(_mm_unpackhi_epi64(arg, arg)));
+#endif
+    }
+};
+
 
 }
 }
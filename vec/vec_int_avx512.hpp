@@ -0,0 +1,199 @@
+//  avx512 int vector class
+//
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef VEC_AVX512_INT_HPP
+#define VEC_AVX512_INT_HPP
+
+#include <immintrin.h>
+
+namespace nova   {
+namespace detail {
+
+/* relational operations compute a mask register, which is expanded to a lane-wise bitmask, since
+ * the generic math functions combine masks with the bitwise operators */
+struct int_vec_avx512
+{
+    __m512i data_;
+
+    /* cast */
+    explicit int_vec_avx512(int arg):
+        data_(_mm512_set1_epi32(arg))
+    {}
+
+    int_vec_avx512(__m512i arg):
+        data_(arg)
+    {}
+
+    int_vec_avx512(__m512 arg):
+        data_(_mm512_castps_si512(arg))
+    {}
+
+    int_vec_avx512(int_vec_avx512 const & arg):
+        data_(arg.data_)
+    {}
+
+    int_vec_avx512(void)
+    {}
+
+    static inline __m512i expand_mask(__mmask16 mask)
+    {
+        return _mm512_maskz_mov_epi32(mask, _mm512_set1_epi32(-1));
+    }
+
+    friend int_vec_avx512 operator+(int_vec_avx512 const & lhs, int_vec_avx512 const & rhs)
+    {
+        return _mm512_add_epi32(lhs.data_, rhs.data_);
+    }
+
+    friend int_vec_avx512 operator-(int_vec_avx512 const & lhs, int_vec_avx512 const & rhs)
+    {
+        return _mm512_sub_epi32(lhs.data_, rhs.data_);
+    }
+
+    #define RELATIONAL_MASK_OPERATOR(op, opcode) \
+    friend inline int_vec_avx512 mask_##op(int_vec_avx512 const & lhs, int_vec_avx512 const & rhs) \
+    { \
+        return expand_mask(opcode(lhs.data_, rhs.data_)); \
+    }
+
+    RELATIONAL_MASK_OPERATOR(lt, _mm512_cmplt_epi32_mask)
+    RELATIONAL_MASK_OPERATOR(gt, _mm512_cmpgt_epi32_mask)
+    RELATIONAL_MASK_OPERATOR(eq, _mm512_cmpeq_epi32_mask)
+
+    #undef RELATIONAL_MASK_OPERATOR
+
+    friend int_vec_avx512 operator&(int_vec_avx512 const & lhs, int_vec_avx512 const & rhs)
+    {
+        return _mm512_and_si512(lhs.data_, rhs.data_);
+    }
+
+    friend inline int_vec_avx512 andnot(int_vec_avx512 const & lhs, int_vec_avx512 const & rhs)
+    {
+        return _mm512_andnot_si512(lhs.data_, rhs.data_);
+    }
+
+    // shift in zeros
+    friend inline int_vec_avx512 slli(int_vec_avx512 const & arg, int count)
+    {
+        return _mm512_sll_epi32(arg.data_, _mm_cvtsi32_si128(count));
+    }
+
+    // shift in zeros
+    friend inline int_vec_avx512 srli(int_vec_avx512 const & arg, int count)
+    {
+        return _mm512_srl_epi32(arg.data_, _mm_cvtsi32_si128(count));
+    }
+
+    __m512 convert_to_float(void) const
+    {
+        return _mm512_cvtepi32_ps(data_);
+    }
+};
+
+/* integer vector with 64bit lanes, used by the double-precision math functions */
+struct int64_vec_avx512
+{
+    __m512i data_;
+
+    /* cast */
+    explicit int64_vec_avx512(int arg):
+        data_(_mm512_set1_epi64(arg))
+    {}
+
+    int64_vec_avx512(__m512i arg):
+        data_(arg)
+    {}
+
+    int64_vec_avx512(__m512d arg):
+        data_(_mm512_castpd_si512(arg))
+    {}
+
+    int64_vec_avx512(int64_vec_avx512 const & arg):
+        data_(arg.data_)
+    {}
+
+    int64_vec_avx512(void)
+    {}
+
+    static inline __m512i expand_mask(__mmask8 mask)
+    {
+        return _mm512_maskz_mov_epi64(mask, _mm512_set1_epi64(-1));
+    }
+
+    friend int64_vec_avx512 operator+(int64_vec_avx512 const & lhs, int64_vec_avx512 const & rhs)
+    {
+        return _mm512_add_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend int64_vec_avx512 operator-(int64_vec_avx512 const & lhs, int64_vec_avx512 const & rhs)
+    {
+        return _mm512_sub_epi64(lhs.data_, rhs.data_);
+    }
+
+    #define RELATIONAL_MASK_OPERATOR(op, opcode) \
+    friend inline int64_vec_avx512 mask_##op(int64_vec_avx512 const & lhs, int64_vec_avx512 const & rhs) \
+    { \
+        return expand_mask(opcode(lhs.data_, rhs.data_)); \
+    }
+
+    RELATIONAL_MASK_OPERATOR(lt, _mm512_cmplt_epi64_mask)
+    RELATIONAL_MASK_OPERATOR(gt, _mm512_cmpgt_epi64_mask)
+    RELATIONAL_MASK_OPERATOR(eq, _mm512_cmpeq_epi64_mask)
+
+    #undef RELATIONAL_MASK_OPERATOR
+
+    friend int64_vec_avx512 operator&(int64_vec_avx512 const & lhs, int64_vec_avx512 const & rhs)
+    {
+        return _mm512_and_si512(lhs.data_, rhs.data_);
+    }
+
+    friend inline int64_vec_avx512 andnot(int64_vec_avx512 const & lhs, int64_vec_avx512 const & rhs)
+    {
+        return _mm512_andnot_si512(lhs.data_, rhs.data_);
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx512 slli(int64_vec_avx512 const & arg, int count)
+    {
+        return _mm512_sll_epi64(arg.data_, _mm_cvtsi32_si128(count));
+    }
+
+    // shift in zeros
+    friend inline int64_vec_avx512 srli(int64_vec_avx512 const & arg, int count)
+    {
+        return _mm512_srl_epi64(arg.data_, _mm_cvtsi32_si128(count));
+    }
+
+    /* only the lower 32bit of each lane are converted */
+    __m512d convert_to_float(void) const
+    {
+        return _mm512_cvtepi32_pd(_mm512_cvtepi64_epi32(data_));
+    }
+
+    /* sign-extend eight 32bit lanes */
+    static inline int64_vec_avx512 from_int32(__m256i arg)
+    {
+        return _mm512_cvtepi32_epi64(arg);
+    }
+};
+
+}
+}
+
+#endif /* VEC_AVX512_INT_HPP */
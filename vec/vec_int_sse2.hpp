@@ -22,6 +22,13 @@
 
 #include <emmintrin.h>
 
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
+#ifdef __SSE4_2__
+#include <nmmintrin.h>
+#endif
 
 namespace nova {
 namespace detail {
@@ -107,6 +114,118 @@ struct int_vec_sse2
     }
 };
 
+/* integer vector with 64bit lanes, used by the double-precision math functions */
+struct int64_vec_sse2
+{
+    __m128i data_;
+
+    explicit int64_vec_sse2(int arg):
+        data_(_mm_set_epi32(arg >> 31, arg, arg >> 31, arg))
+    {}
+
+    int64_vec_sse2(__m128d arg):
+        data_((__m128i)arg)
+    {}
+
+    int64_vec_sse2(__m128i arg):
+        data_(arg)
+    {}
+
+    int64_vec_sse2(int64_vec_sse2 const & arg):
+        data_(arg.data_)
+    {}
+
+    int64_vec_sse2(void)
+    {}
+
+    operator __m128i (void) const
+    {
+        return data_;
+    }
+
+    friend int64_vec_sse2 operator+(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+        return _mm_add_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend int64_vec_sse2 operator-(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+        return _mm_sub_epi64(lhs.data_, rhs.data_);
+    }
+
+    friend inline int64_vec_sse2 mask_eq(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+#ifdef __SSE4_1__
+        return _mm_cmpeq_epi64(lhs.data_, rhs.data_);
+#else
+        __m128i eq32 = _mm_cmpeq_epi32(lhs.data_, rhs.data_);
+        __m128i swapped = _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_and_si128(eq32, swapped);
+#endif
+    }
+
+    friend inline int64_vec_sse2 mask_gt(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+#ifdef __SSE4_2__
+        return _mm_cmpgt_epi64(lhs.data_, rhs.data_);
+#else
+        /* signed compare of the high words, unsigned compare of the low words */
+        const __m128i low_sign = _mm_set_epi32(0, 0x80000000, 0, 0x80000000);
+        __m128i high_gt = _mm_cmpgt_epi32(lhs.data_, rhs.data_);
+        __m128i high_eq = _mm_cmpeq_epi32(lhs.data_, rhs.data_);
+        __m128i low_gt  = _mm_cmpgt_epi32(_mm_xor_si128(lhs.data_, low_sign),
+                                          _mm_xor_si128(rhs.data_, low_sign));
+        low_gt = _mm_shuffle_epi32(low_gt, _MM_SHUFFLE(2, 2, 0, 0));
+
+        __m128i gt = _mm_or_si128(high_gt, _mm_and_si128(high_eq, low_gt));
+        return _mm_shuffle_epi32(gt, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+    }
+
+    friend inline int64_vec_sse2 mask_lt(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+        return mask_gt(rhs, lhs);
+    }
+
+    friend int64_vec_sse2 operator&(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+        return int64_vec_sse2(_mm_and_si128(lhs.data_, rhs.data_));
+    }
+
+    friend inline int64_vec_sse2 andnot(int64_vec_sse2 const & lhs, int64_vec_sse2 const & rhs)
+    {
+        return int64_vec_sse2(_mm_andnot_si128(lhs.data_, rhs.data_));
+    }
+
+    // shift in zeros
+    friend inline int64_vec_sse2 slli(int64_vec_sse2 const & arg, int count)
+    {
+        return int64_vec_sse2(_mm_slli_epi64(arg.data_, count));
+    }
+
+    // shift in zeros
+    friend inline int64_vec_sse2 srli(int64_vec_sse2 const & arg, int count)
+    {
+        return int64_vec_sse2(_mm_srli_epi64(arg.data_, count));
+    }
+
+    /* only the lower 32bit of each lane are converted */
+    inline __m128d convert_to_float(void) const
+    {
+        return _mm_cvtepi32_pd(_mm_shuffle_epi32(data_, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+
+    /* sign-extend the two lower 32bit lanes */
+    static inline int64_vec_sse2 from_int32(__m128i arg)
+    {
+#ifdef __SSE4_1__
+        return _mm_cvtepi32_epi64(arg);
+#else
+        return _mm_unpacklo_epi32(arg, _mm_srai_epi32(arg, 31));
+#endif
+    }
+};
+
 }
 }
 
@@ -119,7 +119,7 @@ public:
     static const int objects_per_cacheline = 64/sizeof(float);
     static const bool has_compare_bitmask = true;
 
-    static bool is_aligned(float* ptr)
+    static bool is_aligned(const float * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(float) - 1)) == 0;
     }
@@ -172,6 +172,39 @@ public:
         store(dest);
     }
 
+    /* sign-extends four int16 samples, they are not scaled */
+    void load_int16(const int16_t * src)
+    {
+        base::data_ = vcvtq_f32_s32(vmovl_s16(vld1_s16(src)));
+    }
+
+#if defined(__aarch64__) || (defined(__ARM_FP) && (__ARM_FP & 2))
+    void load_fp16(const uint16_t * src)
+    {
+        base::data_ = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src)));
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        vst1_u16(dest, vreinterpret_u16_f16(vcvt_f16_f32(data_)));
+    }
+#endif
+
+    void load_bf16(const uint16_t * src)
+    {
+        base::data_ = vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(src), 16));
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        const uint32x4_t bits = vreinterpretq_u32_f32(data_);
+        const uint32x4_t mantissa_odd = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        const uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(mantissa_odd, vdupq_n_u32(0x7fff)));
+        const uint32x4_t quiet_nan = vorrq_u32(bits, vdupq_n_u32(0x400000));
+        const uint32x4_t is_number = vceqq_f32(data_, data_);
+        vst1_u16(dest, vshrn_n_u32(vbslq_u32(is_number, rounded, quiet_nan), 16));
+    }
+
     // no particular setzero intrinsic
     void clear(void)
     {
@@ -296,7 +329,11 @@ public:
 
     friend vec madd(vec const & arg1, vec const & arg2, vec const & arg3)
     {
+#ifdef __ARM_FEATURE_FMA
+        return vfmaq_f32(arg3.data_, arg2.data_, arg1.data_);
+#else
         return vmlaq_f32(arg3.data_, arg2.data_, arg1.data_);
+#endif
     }
 
 private:
@@ -440,14 +477,21 @@ public:
 
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(atan2)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(hypot)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp2)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(expm1)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log1p)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cbrt)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
+    NOVA_SIMD_DELEGATE_SINCOS_TO_BASE
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
@@ -455,6 +499,14 @@ public:
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atanh)
+
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erf)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erfc)
 
 private:
     static float32x4_t vsqrtq_f32(float32x4_t arg)
@@ -472,6 +524,16 @@ public:
         return vsqrtq_f32(arg);
     }
 
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return vrsqrteq_f32(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return detail::vec_rsqrt_newton<NOVA_SIMD_RSQRT_NEWTON_STEPS>(arg);
+    }
+
     friend inline vec signed_sqrt(vec const & arg)
     {
         return detail::vec_signed_sqrt(arg);
@@ -489,6 +551,44 @@ public:
         return int_vec(vreinterpretq_u32_s32(vcvtq_s32_f32(data_)));
     }
 
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const float * base, int_vec const & index)
+    {
+        float32x4_t ret = vdupq_n_f32(base[vgetq_lane_u32(index.data_, 0)]);
+        ret = vsetq_lane_f32(base[vgetq_lane_u32(index.data_, 1)], ret, 1);
+        ret = vsetq_lane_f32(base[vgetq_lane_u32(index.data_, 2)], ret, 2);
+        ret = vsetq_lane_f32(base[vgetq_lane_u32(index.data_, 3)], ret, 3);
+        return ret;
+    }
+
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        const float32x4x2_t zipped = vzipq_f32(lhs.data_, rhs.data_);
+        low  = zipped.val[0];
+        high = zipped.val[1];
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        const float32x4x2_t unzipped = vuzpq_f32(lhs.data_, rhs.data_);
+        even = unzipped.val[0];
+        odd  = unzipped.val[1];
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        const float32x4x2_t r01 = vtrnq_f32(rows[0].data_, rows[1].data_);
+        const float32x4x2_t r23 = vtrnq_f32(rows[2].data_, rows[3].data_);
+
+        rows[0] = vcombine_f32(vget_low_f32(r01.val[0]),  vget_low_f32(r23.val[0]));
+        rows[1] = vcombine_f32(vget_low_f32(r01.val[1]),  vget_low_f32(r23.val[1]));
+        rows[2] = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+        rows[3] = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+    }
+    /* @} */
+
     float horizontal_min(void) const
     {
         float32x2_t high = vget_high_f32(data_);
@@ -25,6 +25,7 @@
 #ifdef __SSE2__
 #include <emmintrin.h>
 #include "vec_int_sse2.hpp"
+#include "vec_half_sse2.hpp"
 #endif
 
 #ifdef __SSE3__
@@ -35,7 +36,7 @@
 #include <smmintrin.h>
 #endif
 
-#ifdef __FMA__
+#if defined(__FMA__) || defined(__F16C__)
 #include <immintrin.h>
 #endif
 
@@ -148,7 +149,7 @@ public:
     static const int objects_per_cacheline = 64/sizeof(float);
     static const bool has_compare_bitmask = true;
 
-    static bool is_aligned(float* ptr)
+    static bool is_aligned(const float * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(float) - 1)) == 0;
     }
@@ -201,6 +202,58 @@ public:
         _mm_stream_ps(dest, data_);
     }
 
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
+#ifdef __SSE4_1__
+    /* sign-extends four int16 samples, they are not scaled */
+    void load_int16(const int16_t * src)
+    {
+        data_ = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i*)src)));
+    }
+#endif
+
+#ifdef __F16C__
+    void load_fp16(const uint16_t * src)
+    {
+        data_ = _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*)src));
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        _mm_storel_epi64((__m128i*)dest, _mm_cvtps_ph(data_, _MM_FROUND_TO_NEAREST_INT));
+    }
+#elif defined(__SSE2__)
+    void load_fp16(const uint16_t * src)
+    {
+        const __m128i halves = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)src), _mm_setzero_si128());
+        data_ = detail::fp16_to_float_sse2(halves);
+    }
+
+    void store_fp16(uint16_t * dest) const
+    {
+        const __m128i halves = detail::float_to_fp16_sse2(data_);
+        _mm_storel_epi64((__m128i*)dest, _mm_packs_epi32(halves, halves));
+    }
+#endif
+
+#ifdef __SSE2__
+    void load_bf16(const uint16_t * src)
+    {
+        const __m128i halves = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)src), _mm_setzero_si128());
+        data_ = detail::bf16_to_float_sse2(halves);
+    }
+
+    void store_bf16(uint16_t * dest) const
+    {
+        const __m128i halves = detail::float_to_bf16_sse2(data_);
+        _mm_storel_epi64((__m128i*)dest, _mm_packs_epi32(halves, halves));
+    }
+#endif
+
     void clear(void)
     {
         data_ = gen_zero();
@@ -459,6 +512,16 @@ public:
         return _mm_sqrt_ps(arg.data_);
     }
 
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return _mm_rsqrt_ps(arg.data_);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return detail::vec_rsqrt_newton<NOVA_SIMD_RSQRT_NEWTON_STEPS>(arg);
+    }
+
     friend inline vec cube(vec const & arg)
     {
         return _mm_mul_ps(arg.data_, _mm_mul_ps(arg.data_, arg.data_));
@@ -561,6 +624,13 @@ public:
         return detail::vec_cos_float(arg);
     }
 
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_float(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(float)
+
     friend inline vec tan(vec const & arg)
     {
         return detail::vec_tan_float(arg);
@@ -581,11 +651,56 @@ public:
         return detail::vec_atan_float(arg);
     }
 
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
     friend inline vec tanh(vec const & arg)
     {
         return detail::vec_tanh_float(arg);
     }
 
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
     friend inline vec signed_pow(vec const & lhs, vec const & rhs)
     {
         return detail::vec_signed_pow(lhs, rhs);
@@ -593,7 +708,27 @@ public:
 
     friend inline vec log2(vec const & arg)
     {
-        return detail::vec_log2(arg);
+        return detail::vec_log2_float(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_float(arg);
+    }
+
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_float(arg);
+    }
+
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
+
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
     }
 
     friend inline vec log10(vec const & arg)
@@ -604,14 +739,21 @@ public:
 
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
     NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(atan2)
+    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(hypot)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp2)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(expm1)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log1p)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cbrt)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
+    NOVA_SIMD_DELEGATE_SINCOS_TO_BASE
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
@@ -619,6 +761,14 @@ public:
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
 
     NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asinh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acosh)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atanh)
+
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erf)
+    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(erfc)
 
 #endif
     friend inline vec undenormalize(vec const & arg)
@@ -665,6 +815,28 @@ public:
 #undef HORIZONTAL_OP
     /* @} */
 
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = _mm_unpacklo_ps(lhs.data_, rhs.data_);
+        high = _mm_unpackhi_ps(lhs.data_, rhs.data_);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        even = _mm_shuffle_ps(lhs.data_, rhs.data_, _MM_SHUFFLE(2, 0, 2, 0));
+        odd  = _mm_shuffle_ps(lhs.data_, rhs.data_, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        __m128 r0 = rows[0].data_, r1 = rows[1].data_, r2 = rows[2].data_, r3 = rows[3].data_;
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        rows[0] = r0; rows[1] = r1; rows[2] = r2; rows[3] = r3;
+    }
+    /* @} */
+
 #ifdef __SSE2__
     /* @{ */
 
@@ -678,6 +850,16 @@ public:
         return int_vec(int_val);
     }
 
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const float * base, int_vec const & index)
+    {
+        const int i0 = _mm_cvtsi128_si32(index.data_);
+        const int i1 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index.data_, _MM_SHUFFLE(1, 1, 1, 1)));
+        const int i2 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index.data_, _MM_SHUFFLE(2, 2, 2, 2)));
+        const int i3 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index.data_, _MM_SHUFFLE(3, 3, 3, 3)));
+        return _mm_set_ps(base[i3], base[i2], base[i1], base[i0]);
+    }
+
     /* @} */
 #endif // __SSE2__
 };
@@ -35,6 +35,7 @@
 
 #include "../detail/vec_math.hpp"
 #include "vec_base.hpp"
+#include "vec_int_sse2.hpp"
 
 #if defined(__GNUC__) && defined(NDEBUG)
 #define always_inline inline  __attribute__((always_inline))
@@ -99,6 +100,26 @@ struct vec<double>:
         return ones;
     }
 
+    static inline __m128d set_bitmask(uint64_t mask)
+    {
+        union {
+            uint64_t i;
+            double d;
+        } u;
+        u.i = mask;
+        return _mm_set1_pd(u.d);
+    }
+
+    static inline __m128d gen_exp_mask(void)
+    {
+        return set_bitmask(0x7FF0000000000000);
+    }
+
+    static inline __m128d gen_exp_mask_1(void)
+    {
+        return set_bitmask(0x3FE0000000000000);
+    }
+
 
     vec(__m128d const & arg):
         base(arg)
@@ -109,7 +130,7 @@ public:
     static const int objects_per_cacheline = 64/sizeof(double);
     static const bool has_compare_bitmask = true;
 
-    static bool is_aligned(double* ptr)
+    static bool is_aligned(const double * ptr)
     {
         return ((intptr_t)(ptr) & (intptr_t)(size * sizeof(double) - 1)) == 0;
     }
@@ -167,6 +188,12 @@ public:
         _mm_stream_pd(dest, data_);
     }
 
+    /* orders non-temporal stores before all following stores */
+    static void stream_fence(void)
+    {
+        _mm_sfence();
+    }
+
     void clear(void)
     {
         data_ = gen_zero();
@@ -329,6 +356,17 @@ public:
         return _mm_sqrt_pd(arg.data_);
     }
 
+    /* there is no estimate instruction for double precision */
+    friend inline vec fast_rsqrt(vec const & arg)
+    {
+        return vec(1.0) / sqrt(arg);
+    }
+
+    friend inline vec rsqrt(vec const & arg)
+    {
+        return fast_rsqrt(arg);
+    }
+
     friend inline vec cube(vec const & arg)
     {
         return _mm_mul_pd(arg.data_, _mm_mul_pd(arg.data_, arg.data_));
@@ -355,7 +393,7 @@ public:
 #ifdef __SSE4_1__
         return _mm_round_pd(arg.data_, _MM_FROUND_TO_NEAREST_INT);
 #else
-        return vec::round(arg);
+        return detail::vec_round_double(arg);
 #endif
     }
 
@@ -370,7 +408,7 @@ public:
 #ifdef __SSE4_1__
         return _mm_round_pd(arg.data_, _MM_FROUND_TO_NEG_INF);
 #else
-        return vec::floor(arg);
+        return detail::vec_floor_double(arg);
 #endif
     }
 
@@ -379,7 +417,7 @@ public:
 #ifdef __SSE4_1__
         return _mm_round_pd(arg.data_, _MM_FROUND_TO_POS_INF);
 #else
-        return vec::ceil(arg);
+        return detail::vec_ceil_double(arg);
 #endif
     }
 
@@ -396,23 +434,144 @@ public:
 
     /* @{ */
     /** mathematical functions */
-    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(pow)
-    NOVA_SIMD_DELEGATE_BINARY_TO_BASE(signed_pow)
+    typedef nova::detail::int64_vec_sse2 int_vec;
+
+    friend inline vec exp(vec const & arg)
+    {
+        return detail::vec_exp_double(arg);
+    }
+
+    friend inline vec log(vec const & arg)
+    {
+        return detail::vec_log_double(arg);
+    }
+
+    friend inline vec pow(vec const & arg1, vec const & arg2)
+    {
+        return detail::vec_pow(arg1, arg2);
+    }
+
+    friend inline vec sin(vec const & arg)
+    {
+        return detail::vec_sin_double(arg);
+    }
+
+    friend inline vec cos(vec const & arg)
+    {
+        return detail::vec_cos_double(arg);
+    }
+
+    friend inline void sincos(vec const & arg, vec & sin_result, vec & cos_result)
+    {
+        detail::vec_sincos_double(arg, sin_result, cos_result);
+    }
+
+    NOVA_SIMD_DEFINE_ACCURACY_TIERS(double)
+
+    friend inline vec tan(vec const & arg)
+    {
+        return detail::vec_tan_double(arg);
+    }
+
+    friend inline vec asin(vec const & arg)
+    {
+        return detail::vec_asin_double(arg);
+    }
+
+    friend inline vec acos(vec const & arg)
+    {
+        return detail::vec_acos_double(arg);
+    }
+
+    friend inline vec atan(vec const & arg)
+    {
+        return detail::vec_atan_double(arg);
+    }
+
+    friend inline vec atan2(vec const & y, vec const & x)
+    {
+        return detail::vec_atan2(y, x);
+    }
+
+    friend inline vec hypot(vec const & x, vec const & y)
+    {
+        return detail::vec_hypot(x, y);
+    }
+
+    friend inline vec tanh(vec const & arg)
+    {
+        return detail::vec_tanh_double(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(sin)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(cos)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tan)
+    friend inline vec sinh(vec const & arg)
+    {
+        return detail::vec_sinh(arg);
+    }
+
+    friend inline vec cosh(vec const & arg)
+    {
+        return detail::vec_cosh(arg);
+    }
+
+    friend inline vec asinh(vec const & arg)
+    {
+        return detail::vec_asinh(arg);
+    }
+
+    friend inline vec acosh(vec const & arg)
+    {
+        return detail::vec_acosh(arg);
+    }
+
+    friend inline vec atanh(vec const & arg)
+    {
+        return detail::vec_atanh(arg);
+    }
+
+    friend inline vec erf(vec const & arg)
+    {
+        return detail::vec_erf(arg);
+    }
+
+    friend inline vec erfc(vec const & arg)
+    {
+        return detail::vec_erfc(arg);
+    }
+
+    friend inline vec signed_pow(vec const & lhs, vec const & rhs)
+    {
+        return detail::vec_signed_pow(lhs, rhs);
+    }
+
+    friend inline vec log2(vec const & arg)
+    {
+        return detail::vec_log2_double(arg);
+    }
+
+    friend inline vec exp2(vec const & arg)
+    {
+        return detail::vec_exp2_double(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(asin)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(acos)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(atan)
+    friend inline vec expm1(vec const & arg)
+    {
+        return detail::vec_expm1_double(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log2)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(log10)
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(exp)
+    friend inline vec log1p(vec const & arg)
+    {
+        return detail::vec_log1p(arg);
+    }
 
-    NOVA_SIMD_DELEGATE_UNARY_TO_BASE(tanh)
+    friend inline vec cbrt(vec const & arg)
+    {
+        return detail::vec_cbrt(arg);
+    }
+
+    friend inline vec log10(vec const & arg)
+    {
+        return detail::vec_log10(arg);
+    }
 
     friend inline vec signed_sqrt(vec const & arg)
     {
@@ -450,8 +609,49 @@ public:
     }
     /* @} */
 
+    /* @{ */
+    /** interleaving */
+    friend inline void interleave(vec const & lhs, vec const & rhs, vec & low, vec & high)
+    {
+        low  = _mm_unpacklo_pd(lhs.data_, rhs.data_);
+        high = _mm_unpackhi_pd(lhs.data_, rhs.data_);
+    }
+
+    friend inline void deinterleave(vec const & lhs, vec const & rhs, vec & even, vec & odd)
+    {
+        even = _mm_unpacklo_pd(lhs.data_, rhs.data_);
+        odd  = _mm_unpackhi_pd(lhs.data_, rhs.data_);
+    }
+
+    friend inline void transpose(vec * rows)
+    {
+        const __m128d r0 = rows[0].data_, r1 = rows[1].data_;
+        rows[0] = _mm_unpacklo_pd(r0, r1);
+        rows[1] = _mm_unpackhi_pd(r0, r1);
+    }
+    /* @} */
+
 #undef HORIZONTAL_OP
 
+    /* @{ */
+    vec (int_vec const & rhs):
+        base((__m128d)rhs.data_)
+    {}
+
+    int_vec truncate_to_int(void) const
+    {
+        __m128i int_val = _mm_cvttpd_epi32(data_);
+        return int_vec::from_int32(int_val);
+    }
+
+    /* lane i is loaded from base[index[i]] */
+    static vec gather(const double * base, int_vec const & index)
+    {
+        const int i0 = _mm_cvtsi128_si32(index.data_);
+        const int i1 = _mm_cvtsi128_si32(_mm_unpackhi_epi64(index.data_, index.data_));
+        return _mm_set_pd(base[i1], base[i0]);
+    }
+    /* @} */
 };
 
 } /* namespace nova */
@@ -0,0 +1,120 @@
+//  in-register transposition of 4x4 and 8x8 blocks with sse and avx
+//  Copyright (C) 2026 Tim Blechmann
+//
+//  This program is free software; you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation; either version 2 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program; see the file COPYING.  If not, write to
+//  the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+//  Boston, MA 02111-1307, USA.
+
+#ifndef VEC_TRANSPOSE_AVX_HPP
+#define VEC_TRANSPOSE_AVX_HPP
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) && defined(NDEBUG)
+#define always_inline inline  __attribute__((always_inline))
+#else
+#define always_inline inline
+#endif
+
+/* shared by the avx and avx512 backends: the avx backends use the register transposes for their
+ * vec::transpose, the wider backends transpose blocks, which are narrower than their vectors, with
+ * the 128bit and 256bit halves */
+
+namespace nova {
+namespace detail {
+
+always_inline void transpose_8x8(__m256 * rows)
+{
+    /* 2x2 blocks of pairs, 4x4 blocks within the 128bit lanes, then the lanes */
+    __m256 pairs[8], quads[8];
+    for (int i = 0; i != 8; i += 2) {
+        pairs[i]     = _mm256_unpacklo_ps(rows[i], rows[i + 1]);
+        pairs[i + 1] = _mm256_unpackhi_ps(rows[i], rows[i + 1]);
+    }
+
+    for (int i = 0; i != 8; i += 4) {
+        quads[i]     = _mm256_shuffle_ps(pairs[i],     pairs[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+        quads[i + 1] = _mm256_shuffle_ps(pairs[i],     pairs[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+        quads[i + 2] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+        quads[i + 3] = _mm256_shuffle_ps(pairs[i + 1], pairs[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    for (int i = 0; i != 4; ++i) {
+        rows[i]     = _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x20);
+        rows[i + 4] = _mm256_permute2f128_ps(quads[i], quads[i + 4], 0x31);
+    }
+}
+
+always_inline void transpose_4x4(__m256d * rows)
+{
+    const __m256d r01_low  = _mm256_unpacklo_pd(rows[0], rows[1]);
+    const __m256d r01_high = _mm256_unpackhi_pd(rows[0], rows[1]);
+    const __m256d r23_low  = _mm256_unpacklo_pd(rows[2], rows[3]);
+    const __m256d r23_high = _mm256_unpackhi_pd(rows[2], rows[3]);
+
+    rows[0] = _mm256_permute2f128_pd(r01_low,  r23_low,  0x20);
+    rows[1] = _mm256_permute2f128_pd(r01_high, r23_high, 0x20);
+    rows[2] = _mm256_permute2f128_pd(r01_low,  r23_low,  0x31);
+    rows[3] = _mm256_permute2f128_pd(r01_high, r23_high, 0x31);
+}
+
+/* dest[column * dest_stride + row] = src[row * src_stride + column] */
+always_inline void transpose_block_4x4(float * dest, unsigned int dest_stride, const float * src,
+                                       unsigned int src_stride)
+{
+    __m128 r0 = _mm_loadu_ps(src);
+    __m128 r1 = _mm_loadu_ps(src + src_stride);
+    __m128 r2 = _mm_loadu_ps(src + 2 * src_stride);
+    __m128 r3 = _mm_loadu_ps(src + 3 * src_stride);
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(dest, r0);
+    _mm_storeu_ps(dest + dest_stride, r1);
+    _mm_storeu_ps(dest + 2 * dest_stride, r2);
+    _mm_storeu_ps(dest + 3 * dest_stride, r3);
+}
+
+always_inline void transpose_block_8x8(float * dest, unsigned int dest_stride, const float * src,
+                                       unsigned int src_stride)
+{
+    __m256 rows[8];
+    for (int i = 0; i != 8; ++i)
+        rows[i] = _mm256_loadu_ps(src + i * src_stride);
+
+    transpose_8x8(rows);
+
+    for (int i = 0; i != 8; ++i)
+        _mm256_storeu_ps(dest + i * dest_stride, rows[i]);
+}
+
+always_inline void transpose_block_4x4(double * dest, unsigned int dest_stride, const double * src,
+                                       unsigned int src_stride)
+{
+    __m256d rows[4];
+    for (int i = 0; i != 4; ++i)
+        rows[i] = _mm256_loadu_pd(src + i * src_stride);
+
+    transpose_4x4(rows);
+
+    for (int i = 0; i != 4; ++i)
+        _mm256_storeu_pd(dest + i * dest_stride, rows[i]);
+}
+
+}
+}
+
+#undef always_inline
+
+#endif /* VEC_TRANSPOSE_AVX_HPP */